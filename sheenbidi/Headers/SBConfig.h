@@ -18,6 +18,7 @@
 #define _SB_PUBLIC_CONFIG_H
 
 /* #define SB_CONFIG_LOG */
+/* #define SB_CONFIG_NO_SIMD */
 /* #define SB_CONFIG_UNITY */
 
 #ifdef SB_CONFIG_UNITY
@@ -18,6 +18,16 @@
 #include <stddef.h>
 #include <stdlib.h>
 
+#ifndef SB_CONFIG_NO_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SB_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SB_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 #include "BidiTypeLookup.h"
 #include "SBBase.h"
 #include "SBCodepointSequence.h"
@@ -54,12 +64,165 @@ static void DisposeAlgorithm(SBAlgorithmRef algorithm)
     free(algorithm);
 }
 
+#if defined(SB_SIMD_SSE2) || defined(SB_SIMD_NEON)
+
+#define SIMPLE_BLOCK_LENGTH 8
+
+/*
+ * Classifies a block of code units with range checks on vector registers. Only the most frequent
+ * ranges of English and Arabic script text are checked, which are basic Latin letters, spaces,
+ * European digits and Arabic letters. Upper case letters are folded onto lower case ones by
+ * setting the fifth bit. The types of matched units are written into the array, and a mask of the
+ * units that still need a table lookup is returned. If the block contains a surrogate, all units
+ * are left for the scalar path.
+ */
+static SBUInt32 DetermineSimpleBidiTypes(const SBUInt16 *units, SBBidiType *types)
+{
+#ifdef SB_SIMD_SSE2
+#define IN_RANGE(v, lo, hi)                                                         \
+    _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(v, _mm_set1_epi16((short)(lo))),   \
+                                   _mm_set1_epi16((short)((hi) - (lo)))), zero)
+
+    __m128i zero = _mm_setzero_si128();
+    __m128i codeUnits = _mm_loadu_si128((const __m128i *)units);
+    __m128i folded = _mm_or_si128(codeUnits, _mm_set1_epi16(0x20));
+    __m128i surrogates = IN_RANGE(codeUnits, 0xD800, 0xDFFF);
+    __m128i letters = IN_RANGE(folded, 'a', 'z');
+    __m128i spaces = _mm_cmpeq_epi16(codeUnits, _mm_set1_epi16(' '));
+    __m128i digits = IN_RANGE(codeUnits, '0', '9');
+    __m128i arabic = _mm_or_si128(IN_RANGE(codeUnits, 0x0620, 0x064A), IN_RANGE(codeUnits, 0x0671, 0x06D5));
+    __m128i known;
+    __m128i result;
+
+#undef IN_RANGE
+
+    if (_mm_movemask_epi8(surrogates)) {
+        return 0xFF;
+    }
+
+    known = _mm_or_si128(_mm_or_si128(letters, spaces), _mm_or_si128(digits, arabic));
+    result = _mm_or_si128(
+        _mm_or_si128(_mm_and_si128(letters, _mm_set1_epi16(SBBidiTypeL)),
+                     _mm_and_si128(spaces, _mm_set1_epi16(SBBidiTypeWS))),
+        _mm_or_si128(_mm_and_si128(digits, _mm_set1_epi16(SBBidiTypeEN)),
+                     _mm_and_si128(arabic, _mm_set1_epi16(SBBidiTypeAL))));
+
+    _mm_storel_epi64((__m128i *)types, _mm_packus_epi16(result, zero));
+
+    /* Take one bit of each 16-bit lane from the byte mask. */
+    {
+        SBUInt32 byteMask = (SBUInt32)_mm_movemask_epi8(_mm_packs_epi16(known, zero));
+        return ~byteMask & 0xFF;
+    }
+#else
+#define IN_RANGE(v, lo, hi) \
+    vandq_u16(vcgeq_u16(v, vdupq_n_u16(lo)), vcleq_u16(v, vdupq_n_u16(hi)))
+
+    uint16x8_t codeUnits = vld1q_u16(units);
+    uint16x8_t folded = vorrq_u16(codeUnits, vdupq_n_u16(0x20));
+    uint16x8_t surrogates = IN_RANGE(codeUnits, 0xD800, 0xDFFF);
+    uint16x8_t letters = IN_RANGE(folded, 'a', 'z');
+    uint16x8_t spaces = vceqq_u16(codeUnits, vdupq_n_u16(' '));
+    uint16x8_t digits = IN_RANGE(codeUnits, '0', '9');
+    uint16x8_t arabic = vorrq_u16(IN_RANGE(codeUnits, 0x0620, 0x064A), IN_RANGE(codeUnits, 0x0671, 0x06D5));
+    uint16x8_t known;
+    uint16x8_t result;
+    uint64_t knownBits;
+    SBUInt32 mask = 0;
+    int lane;
+
+#undef IN_RANGE
+
+    if (vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(surrogates)), 0)) {
+        return 0xFF;
+    }
+
+    known = vorrq_u16(vorrq_u16(letters, spaces), vorrq_u16(digits, arabic));
+    result = vorrq_u16(
+        vorrq_u16(vandq_u16(letters, vdupq_n_u16(SBBidiTypeL)),
+                  vandq_u16(spaces, vdupq_n_u16(SBBidiTypeWS))),
+        vorrq_u16(vandq_u16(digits, vdupq_n_u16(SBBidiTypeEN)),
+                  vandq_u16(arabic, vdupq_n_u16(SBBidiTypeAL))));
+
+    vst1_u8(types, vmovn_u16(result));
+
+    knownBits = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(known)), 0);
+    for (lane = 0; lane < SIMPLE_BLOCK_LENGTH; lane++) {
+        if (!((knownBits >> (lane * 8)) & 0xFF)) {
+            mask |= 1 << lane;
+        }
+    }
+
+    return mask;
+#endif
+}
+
+#endif
+
+static void DetermineUTF16BidiTypes(const SBCodepointSequence *sequence, SBBidiType *types)
+{
+    const SBUInt16 *buffer = sequence->stringBuffer;
+    SBUInteger stringLength = sequence->stringLength;
+    SBUInteger stringIndex = 0;
+    SBUInteger blockEnd = 0;
+
+    while (stringIndex < stringLength) {
+        SBUInt16 codeUnit;
+
+#if defined(SB_SIMD_SSE2) || defined(SB_SIMD_NEON)
+        if (stringIndex >= blockEnd && stringLength - stringIndex >= SIMPLE_BLOCK_LENGTH) {
+            SBUInt32 pending = DetermineSimpleBidiTypes(buffer + stringIndex, types + stringIndex);
+
+            if (pending != 0xFF) {
+                SBUInteger lane;
+
+                /* Look up the units that were not covered by the checked ranges. */
+                for (lane = 0; pending; lane++, pending >>= 1) {
+                    if (pending & 1) {
+                        types[stringIndex + lane] = LookupBidiType(buffer[stringIndex + lane]);
+                    }
+                }
+
+                stringIndex += SIMPLE_BLOCK_LENGTH;
+                continue;
+            }
+
+            /* Decode the block containing surrogates one code point at a time. */
+            blockEnd = stringIndex + SIMPLE_BLOCK_LENGTH;
+        }
+#endif
+
+        codeUnit = buffer[stringIndex];
+
+        /* Code units outside surrogate range map to code points directly. */
+        if (!SBCodepointIsSurrogate(codeUnit)) {
+            types[stringIndex] = LookupBidiType(codeUnit);
+            stringIndex += 1;
+        } else {
+            SBUInteger firstIndex = stringIndex;
+            SBCodepoint codepoint = SBCodepointSequenceGetCodepointAt(sequence, &stringIndex);
+
+            types[firstIndex] = LookupBidiType(codepoint);
+
+            /* Subsequent code units get 'BN' type. */
+            while (++firstIndex < stringIndex) {
+                types[firstIndex] = SBBidiTypeBN;
+            }
+        }
+    }
+}
+
 static void DetermineBidiTypes(const SBCodepointSequence *sequence, SBBidiType *types)
 {
     SBUInteger stringIndex = 0;
     SBUInteger firstIndex = 0;
     SBCodepoint codepoint;
 
+    if (sequence->stringEncoding == SBStringEncodingUTF16) {
+        DetermineUTF16BidiTypes(sequence, types);
+        return;
+    }
+
     while ((codepoint = SBCodepointSequenceGetCodepointAt(sequence, &stringIndex)) != SBCodepointInvalid) {
         types[firstIndex] = LookupBidiType(codepoint);
 
@@ -566,6 +566,85 @@ static void SaveLevels(BidiChainRef chain, SBLevel *levels, SBLevel baseLevel)
     }
 }
 
+/*
+ * Determines whether all the characters of a paragraph would receive the same level, which is the
+ * case when it is purely left-to-right without Arabic numbers, or purely right-to-left without any
+ * numbers, and contains no explicit formatting characters. Every weak and neutral type of such a
+ * paragraph resolves to the embedding direction, so the levels can be filled in directly.
+ */
+static SBBoolean DetermineUniformLevel(const SBBidiType *types, SBUInteger length,
+    SBLevel baseLevel, SBLevel *uniformLevel)
+{
+    SBBoolean hasLTR = SBFalse;
+    SBBoolean hasRTL = SBFalse;
+    SBBoolean hasNumber = SBFalse;
+    SBLevel paragraphLevel;
+    SBUInteger index;
+
+    for (index = 0; index < length; index++) {
+        SBBidiType type = types[index];
+
+        switch (type) {
+        case SBBidiTypeL:
+            hasLTR = SBTrue;
+            break;
+
+        case SBBidiTypeR:
+        case SBBidiTypeAL:
+            hasRTL = SBTrue;
+            break;
+
+        case SBBidiTypeEN:
+            hasNumber = SBTrue;
+            break;
+
+        case SBBidiTypeAN:
+            return SBFalse;
+
+        default:
+            if (SBBidiTypeIsFormat(type)) {
+                return SBFalse;
+            }
+            break;
+        }
+    }
+
+    /* Rules P2, P3 */
+    if (baseLevel >= SBLevelMax) {
+        if (hasLTR) {
+            paragraphLevel = 0;
+        } else if (hasRTL) {
+            paragraphLevel = 1;
+        } else {
+            paragraphLevel = (baseLevel != SBLevelDefaultRTL ? 0 : 1);
+        }
+    } else {
+        paragraphLevel = baseLevel;
+    }
+
+    if (paragraphLevel == 0 && !hasRTL) {
+        *uniformLevel = 0;
+        return SBTrue;
+    }
+    if (paragraphLevel == 1 && !hasLTR && !hasNumber) {
+        *uniformLevel = 1;
+        return SBTrue;
+    }
+
+    return SBFalse;
+}
+
+static void FillParagraph(SBParagraphRef paragraph,
+    SBAlgorithmRef algorithm, SBUInteger offset, SBUInteger length, SBLevel resolvedLevel)
+{
+    paragraph->algorithm = SBAlgorithmRetain(algorithm);
+    paragraph->refTypes = algorithm->fixedTypes + offset;
+    paragraph->offset = offset;
+    paragraph->length = length;
+    paragraph->baseLevel = resolvedLevel;
+    paragraph->retainCount = 1;
+}
+
 static SBBoolean ResolveParagraph(SBParagraphRef paragraph,
     SBAlgorithmRef algorithm, SBUInteger offset, SBUInteger length, SBLevel baseLevel)
 {
@@ -574,6 +653,24 @@ static SBBoolean ResolveParagraph(SBParagraphRef paragraph,
     ParagraphContextRef context;
     SBLevel resolvedLevel;
 
+    if (DetermineUniformLevel(bidiTypes, length, baseLevel, &resolvedLevel)) {
+        SBUInteger index;
+
+        paragraph->fixedLevels += 1;
+
+        for (index = 0; index < length; index++) {
+            paragraph->fixedLevels[index] = resolvedLevel;
+        }
+
+        SB_LOG_BLOCK_OPENER("Determined Uniform Level");
+        SB_LOG_STATEMENT("Base Level", 1, SB_LOG_LEVEL(resolvedLevel));
+        SB_LOG_BLOCK_CLOSER();
+
+        FillParagraph(paragraph, algorithm, offset, length, resolvedLevel);
+
+        return SBTrue;
+    }
+
     context = CreateParagraphContext(bidiTypes, paragraph->fixedLevels, length);
 
     if (context) {
@@ -596,12 +693,7 @@ static SBBoolean ResolveParagraph(SBParagraphRef paragraph,
             SB_LOG_STATEMENT("Levels", 1, SB_LOG_LEVELS_ARRAY(paragraph->fixedLevels, length));
             SB_LOG_BLOCK_CLOSER();
 
-            paragraph->algorithm = SBAlgorithmRetain(algorithm);
-            paragraph->refTypes = bidiTypes;
-            paragraph->offset = offset;
-            paragraph->length = length;
-            paragraph->baseLevel = resolvedLevel;
-            paragraph->retainCount = 1;
+            FillParagraph(paragraph, algorithm, offset, length, resolvedLevel);
 
             isSucceeded = SBTrue;
         }
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include <SheenBidi.h>
+}
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+static const size_t CORPUS_LENGTH = 1 << 20;
+static const int ITERATION_COUNT = 200;
+
+static vector<uint16_t> makeCorpus(const u16string &sample) {
+    vector<uint16_t> units;
+    units.reserve(CORPUS_LENGTH);
+
+    while (units.size() < CORPUS_LENGTH) {
+        units.insert(units.end(), sample.begin(), sample.end());
+    }
+    units.resize(CORPUS_LENGTH);
+
+    return units;
+}
+
+static void measure(const char *name, const u16string &sample) {
+    vector<uint16_t> units = makeCorpus(sample);
+
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF16;
+    sequence.stringBuffer = units.data();
+    sequence.stringLength = units.size();
+
+    /* Warm up the caches and the allocator before timing. */
+    SBAlgorithmRelease(SBAlgorithmCreate(&sequence));
+
+    auto start = steady_clock::now();
+    for (int i = 0; i < ITERATION_COUNT; i++) {
+        SBAlgorithmRelease(SBAlgorithmCreate(&sequence));
+    }
+    auto elapsed = duration_cast<duration<double>>(steady_clock::now() - start).count();
+
+    double megaUnits = double(CORPUS_LENGTH) * ITERATION_COUNT / 1e6;
+    cout << name << ": " << (megaUnits / elapsed) << " M code units/s" << endl;
+}
+
+int main(int argc, const char *argv[]) {
+    measure("English", u"The quick brown fox jumps over the lazy dog, 1234567890 times.\n");
+    measure("Urdu", u"اردو ایک بہت خوبصورت زبان ہے۔\n");
+    measure("Mixed", u"یہ Tehreer لائبری 2023 میں بنی۔\n");
+    measure("Emoji", u"Smile \U0001F600 and wave \U0001F44B!\n");
+
+    return 0;
+}
@@ -0,0 +1,375 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Utilities/ArrayBuilder.h"
+#include "Utilities/Converter.h"
+#include "Utilities/FileBuilder.h"
+#include "Utilities/Math.h"
+#include "Utilities/TextBuilder.h"
+
+#include "BreakLookupGenerator.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+using namespace SheenBidi::Generator;
+using namespace SheenBidi::Generator::Utilities;
+
+static const size_t MIN_MAIN_SEGMENT_SIZE = 8;
+static const size_t MAX_MAIN_SEGMENT_SIZE = 512;
+
+static const size_t MIN_BRANCH_SEGMENT_SIZE = 8;
+static const size_t MAX_BRANCH_SEGMENT_SIZE = 512;
+
+static const string DATA_ARRAY_TYPE = "static const uint16_t";
+static const string DATA_ARRAY_NAME = "PrimaryBreakData";
+
+static const string MAIN_INDEXES_ARRAY_TYPE = "static const uint16_t";
+static const string MAIN_INDEXES_ARRAY_NAME = "MainBreakIndexes";
+
+static const string BRANCH_INDEXES_ARRAY_TYPE = "static const uint16_t";
+static const string BRANCH_INDEXES_ARRAY_NAME = "BranchBreakIndexes";
+
+/* Must be kept in sync with LineBreak::Class of BreakLookup.h. */
+static const vector<string> LINE_BREAK_CLASSES = {
+    "AL", "B2", "BA", "BB", "BK", "CB", "CL", "CM",
+    "CP", "CR", "EB", "EM", "EX", "GL", "H2", "H3",
+    "HL", "HY", "ID", "IN", "IS", "JL", "JT", "JV",
+    "LF", "NL", "NS", "NU", "OP", "PO", "PR", "QU",
+    "RI", "SP", "SY", "WJ", "ZW", "ZWJ"
+};
+
+/* Must be kept in sync with GraphemeBreak::Class of BreakLookup.h. */
+static const vector<string> GRAPHEME_BREAK_CLASSES = {
+    "Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator",
+    "Prepend", "SpacingMark", "L", "V", "T", "LV", "LVT"
+};
+
+static const uint16_t LINE_FLAG_EAST_ASIAN = 1 << 6;
+static const uint16_t LINE_FLAG_UNASSIGNED_PICTOGRAPHIC = 1 << 7;
+static const uint16_t GRAPHEME_FLAG_EXTENDED_PICTOGRAPHIC = 1 << 4;
+
+static const string EXTENDED_PICTOGRAPHIC = "Extended_Pictographic";
+
+static uint16_t classNumber(const vector<string> &classes, const string &name) {
+    auto match = find(classes.begin(), classes.end(), name);
+    if (match == classes.end()) {
+        cout << "Unknown break class: " << name << endl;
+        return 0;
+    }
+
+    return static_cast<uint16_t>(distance(classes.begin(), match));
+}
+
+BreakLookupGenerator::MainDataSegment::MainDataSegment(size_t index, MainDataSet dataset)
+    : index(index)
+    , dataset(dataset)
+{
+}
+
+const string BreakLookupGenerator::MainDataSegment::hintLine() const {
+    return ("/* DATA_BLOCK: -- 0x" + Converter::toHex(index, 4) + "..0x" + Converter::toHex(index + dataset->size() - 1, 4) + " -- */");
+}
+
+BreakLookupGenerator::BranchDataSegment::BranchDataSegment(size_t index, BranchDataSet dataset)
+    : index(index)
+    , dataset(dataset)
+{
+}
+
+const string BreakLookupGenerator::BranchDataSegment::hintLine() const {
+    return ("/* INDEX_BLOCK: -- 0x" + Converter::toHex(index, 4) + "..0x" + Converter::toHex(index + dataset->size() - 1, 4) + " -- */");
+}
+
+BreakLookupGenerator::BreakLookupGenerator(const LineBreak &lineBreak,
+                                           const GraphemeBreakProperty &graphemeBreakProperty,
+                                           const EmojiData &emojiData,
+                                           const EastAsianWidth &eastAsianWidth,
+                                           const UnicodeData &unicodeData)
+    : m_lineBreak(lineBreak)
+    , m_graphemeBreakProperty(graphemeBreakProperty)
+    , m_emojiData(emojiData)
+    , m_eastAsianWidth(eastAsianWidth)
+    , m_generalCategoryDetector(GeneralCategoryDetector(unicodeData))
+    , m_properties(0x110000)
+    , m_lastCodePoint(0)
+    , m_mainSegmentSize(0)
+    , m_branchSegmentSize(0)
+{
+    for (uint32_t codePoint = 0; codePoint < 0x110000; codePoint++) {
+        uint16_t properties = resolveProperties(codePoint);
+        m_properties[codePoint] = properties;
+
+        if (properties != 0) {
+            m_lastCodePoint = codePoint;
+        }
+    }
+}
+
+void BreakLookupGenerator::setMainSegmentSize(size_t segmentSize) {
+    m_mainSegmentSize = min(MAX_MAIN_SEGMENT_SIZE, max(MIN_MAIN_SEGMENT_SIZE, segmentSize));
+}
+
+void BreakLookupGenerator::setBranchSegmentSize(size_t segmentSize) {
+    m_branchSegmentSize = min(MAX_BRANCH_SEGMENT_SIZE, max(MIN_BRANCH_SEGMENT_SIZE, segmentSize));
+}
+
+uint16_t BreakLookupGenerator::resolveProperties(uint32_t codePoint) const {
+    const string &generalCategory = m_generalCategoryDetector.nameForCodePoint(codePoint);
+    string lineClass = m_lineBreak.lineBreakForCodePoint(codePoint);
+
+    /* LB1: Resolve the ambiguous, surrogate, unknown, complex context and conditional classes. */
+    if (lineClass == "AI" || lineClass == "SG" || lineClass == "XX") {
+        lineClass = "AL";
+    } else if (lineClass == "SA") {
+        lineClass = (generalCategory == "Mn" || generalCategory == "Mc" ? "CM" : "AL");
+    } else if (lineClass == "CJ") {
+        lineClass = "NS";
+    }
+
+    const string &width = m_eastAsianWidth.eastAsianWidthForCodePoint(codePoint);
+    bool isPictographic = m_emojiData.hasProperty(codePoint, EXTENDED_PICTOGRAPHIC);
+
+    uint16_t lineByte = classNumber(LINE_BREAK_CLASSES, lineClass);
+    if (width == "F" || width == "W" || width == "H") {
+        lineByte |= LINE_FLAG_EAST_ASIAN;
+    }
+    if (isPictographic && generalCategory == "Cn") {
+        lineByte |= LINE_FLAG_UNASSIGNED_PICTOGRAPHIC;
+    }
+
+    const string &graphemeClass = m_graphemeBreakProperty.graphemeBreakForCodePoint(codePoint);
+
+    uint16_t graphemeByte = classNumber(GRAPHEME_BREAK_CLASSES, graphemeClass);
+    if (isPictographic) {
+        graphemeByte |= GRAPHEME_FLAG_EXTENDED_PICTOGRAPHIC;
+    }
+
+    return static_cast<uint16_t>((graphemeByte << 8) | lineByte);
+}
+
+void BreakLookupGenerator::collectMainData() {
+    size_t segmentCount = Math::FastCeil(m_lastCodePoint + 1, m_mainSegmentSize * m_branchSegmentSize) * m_branchSegmentSize;
+
+    m_dataSegments.clear();
+    m_dataSegments.reserve(segmentCount);
+
+    m_dataReferences.clear();
+    m_dataReferences.reserve(segmentCount);
+
+    m_dataSize = 0;
+
+    for (size_t i = 0; i < segmentCount; i++) {
+        size_t segmentStart = i * m_mainSegmentSize;
+
+        MainDataSet dataset(new UnsafeMainDataSet());
+        dataset->reserve(m_mainSegmentSize);
+
+        for (size_t j = 0; j < m_mainSegmentSize; j++) {
+            size_t codePoint = segmentStart + j;
+            dataset->push_back(codePoint <= m_lastCodePoint ? m_properties[codePoint] : 0);
+        }
+
+        size_t segmentIndex = SIZE_MAX;
+        size_t existingCount = m_dataSegments.size();
+        for (size_t j = 0; j < existingCount; j++) {
+            if (*m_dataSegments[j].dataset == *dataset) {
+                segmentIndex = j;
+                break;
+            }
+        }
+
+        if (segmentIndex == SIZE_MAX) {
+            segmentIndex = m_dataSegments.size();
+            m_dataSegments.push_back(MainDataSegment(m_dataSize, dataset));
+            m_dataSize += dataset->size();
+        }
+
+        m_dataReferences.push_back(&m_dataSegments.at(segmentIndex));
+    }
+}
+
+void BreakLookupGenerator::collectBranchData() {
+    size_t segmentCount = m_dataReferences.size() / m_branchSegmentSize;
+
+    m_branchSegments.clear();
+    m_branchSegments.reserve(segmentCount);
+
+    m_branchReferences.clear();
+    m_branchReferences.reserve(segmentCount);
+
+    m_mainIndexesSize = 0;
+
+    for (size_t i = 0; i < segmentCount; i++) {
+        size_t segmentStart = i * m_branchSegmentSize;
+
+        BranchDataSet dataset(new UnsafeBranchDataSet());
+        dataset->reserve(m_branchSegmentSize);
+
+        for (size_t j = 0; j < m_branchSegmentSize; j++) {
+            dataset->push_back(m_dataReferences.at(segmentStart + j));
+        }
+
+        size_t segmentIndex = SIZE_MAX;
+        size_t existingCount = m_branchSegments.size();
+        for (size_t j = 0; j < existingCount; j++) {
+            if (*m_branchSegments[j].dataset == *dataset) {
+                segmentIndex = j;
+                break;
+            }
+        }
+
+        if (segmentIndex == SIZE_MAX) {
+            segmentIndex = m_branchSegments.size();
+            m_branchSegments.push_back(BranchDataSegment(m_mainIndexesSize, dataset));
+            m_mainIndexesSize += dataset->size();
+        }
+
+        m_branchReferences.push_back(&m_branchSegments.at(segmentIndex));
+    }
+
+    m_branchIndexesSize = m_branchReferences.size();
+}
+
+void BreakLookupGenerator::generateFile(const string &directory) {
+    collectMainData();
+    collectBranchData();
+
+    ArrayBuilder arrData;
+    arrData.setDataType(DATA_ARRAY_TYPE);
+    arrData.setName(DATA_ARRAY_NAME);
+    arrData.setSizeDescriptor(Converter::toString((int)m_dataSize));
+
+    auto dataPtr = m_dataSegments.begin();
+    auto dataEnd = m_dataSegments.end();
+    for (; dataPtr != dataEnd; dataPtr++) {
+        const MainDataSegment &segment = *dataPtr;
+        bool isLast = (dataPtr == (dataEnd - 1));
+
+        arrData.append(segment.hintLine());
+        arrData.newLine();
+
+        size_t length = segment.dataset->size();
+
+        for (size_t j = 0; j < length; j++) {
+            arrData.appendElement("0x" + Converter::toHex(segment.dataset->at(j), 4));
+
+            if (!isLast || j != (length - 1)) {
+                arrData.newElement();
+            }
+        }
+
+        if (!isLast) {
+            arrData.newLine();
+        }
+    }
+
+    ArrayBuilder arrMainIndexes;
+    arrMainIndexes.setDataType(MAIN_INDEXES_ARRAY_TYPE);
+    arrMainIndexes.setName(MAIN_INDEXES_ARRAY_NAME);
+    arrMainIndexes.setSizeDescriptor(Converter::toString((int)m_mainIndexesSize));
+
+    auto mainIndexPtr = m_branchSegments.begin();
+    auto mainIndexEnd = m_branchSegments.end();
+    for (; mainIndexPtr != mainIndexEnd; mainIndexPtr++) {
+        const BranchDataSegment &segment = *mainIndexPtr;
+        bool isLast = (mainIndexPtr == (mainIndexEnd - 1));
+
+        arrMainIndexes.append(segment.hintLine());
+        arrMainIndexes.newLine();
+
+        size_t length = segment.dataset->size();
+
+        for (size_t j = 0; j < length; j++) {
+            arrMainIndexes.appendElement("0x" + Converter::toHex(segment.dataset->at(j)->index, 4));
+
+            if (!isLast || j != (length - 1)) {
+                arrMainIndexes.newElement();
+            }
+        }
+
+        if (!isLast) {
+            arrMainIndexes.newLine();
+        }
+    }
+
+    ArrayBuilder arrBranchIndexes;
+    arrBranchIndexes.setDataType(BRANCH_INDEXES_ARRAY_TYPE);
+    arrBranchIndexes.setName(BRANCH_INDEXES_ARRAY_NAME);
+    arrBranchIndexes.setSizeDescriptor(Converter::toString((int)m_branchIndexesSize));
+
+    auto branchIndexPtr = m_branchReferences.begin();
+    auto branchIndexEnd = m_branchReferences.end();
+    for (; branchIndexPtr != branchIndexEnd; branchIndexPtr++) {
+        const BranchDataSegment &segment = **branchIndexPtr;
+        bool isLast = (branchIndexPtr == (branchIndexEnd - 1));
+
+        arrBranchIndexes.appendElement("0x" + Converter::toHex(segment.index, 4));
+        if (!isLast) {
+            arrBranchIndexes.newElement();
+        }
+    }
+
+    TextBuilder lookupFunction;
+    string maxCodePoint = "0x" + Converter::toHex(m_lastCodePoint, 4);
+    string mainDivider = "0x" + Converter::toHex(m_mainSegmentSize, 4);
+    string branchDivider = "0x" + Converter::toHex(m_mainSegmentSize * m_branchSegmentSize, 4);
+    lookupFunction.append("uint16_t Tehreer::lookupBreakProperties(uint32_t codePoint)").newLine();
+    lookupFunction.append("{").newLine();
+    lookupFunction.appendTabs(1).append("if (codePoint <= " + maxCodePoint + ") {").newLine();
+    lookupFunction.appendTabs(2).append("return PrimaryBreakData[").newLine();
+    lookupFunction.appendTabs(2).append("        MainBreakIndexes[").newLine();
+    lookupFunction.appendTabs(2).append("         BranchBreakIndexes[").newLine();
+    lookupFunction.appendTabs(2).append("              codePoint / " + branchDivider).newLine();
+    lookupFunction.appendTabs(2).append("         ] + (codePoint % " + branchDivider + ") / " + mainDivider).newLine();
+    lookupFunction.appendTabs(2).append("        ] + (codePoint % " + mainDivider + ")").newLine();
+    lookupFunction.appendTabs(2).append("       ];").newLine();
+    lookupFunction.appendTabs(1).append("}").newLine();
+    lookupFunction.newLine();
+    lookupFunction.appendTabs(1).append("return 0;").newLine();
+    lookupFunction.append("}").newLine();
+
+    size_t requiredMemory = (m_dataSize + m_mainIndexesSize + m_branchIndexesSize) * 2;
+
+    FileBuilder source(directory + "/BreakLookup.cpp");
+    source.append("/*").newLine();
+    source.append(" * Automatically generated by SheenBidiGenerator tool from LineBreak.txt,").newLine();
+    source.append(" * GraphemeBreakProperty.txt, emoji-data.txt and EastAsianWidth.txt of Unicode "
+                  + m_lineBreak.version().versionString() + ".").newLine();
+    source.append(" * DO NOT EDIT!!").newLine();
+    source.append(" *").newLine();
+    source.append(" * REQUIRED MEMORY: (" + Converter::toString((int)m_dataSize)
+                  + "*2)+(" + Converter::toString((int)m_mainIndexesSize) + "*2)+("
+                  + Converter::toString((int)m_branchIndexesSize) + "*2) = "
+                  + Converter::toString((int)requiredMemory) + " Bytes").newLine();
+    source.append(" */").newLine();
+    source.newLine();
+    source.append("#include <cstdint>").newLine();
+    source.newLine();
+    source.append("#include \"BreakLookup.h\"").newLine();
+    source.newLine();
+    source.append("using namespace Tehreer;").newLine();
+    source.newLine();
+    source.append(arrData).newLine();
+    source.append(arrMainIndexes).newLine();
+    source.append(arrBranchIndexes).newLine();
+    source.append(lookupFunction);
+}
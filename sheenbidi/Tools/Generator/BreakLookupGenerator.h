@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHEENBIDI_GENERATOR_BREAK_LOOKUP_GENERATOR_H
+#define SHEENBIDI_GENERATOR_BREAK_LOOKUP_GENERATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Parser/EastAsianWidth.h>
+#include <Parser/EmojiData.h>
+#include <Parser/GraphemeBreakProperty.h>
+#include <Parser/LineBreak.h>
+#include <Parser/UnicodeData.h>
+
+#include "Utilities/GeneralCategoryDetector.h"
+
+namespace SheenBidi {
+namespace Generator {
+
+/*
+ * Generates the break properties lookup of Tehreer, packing the line break class, East Asian
+ * width and unassigned pictographic flags in the low byte, and the grapheme cluster break class
+ * and Extended_Pictographic flag in the high byte of each code point.
+ */
+class BreakLookupGenerator {
+public:
+    BreakLookupGenerator(const Parser::LineBreak &lineBreak,
+                         const Parser::GraphemeBreakProperty &graphemeBreakProperty,
+                         const Parser::EmojiData &emojiData,
+                         const Parser::EastAsianWidth &eastAsianWidth,
+                         const Parser::UnicodeData &unicodeData);
+
+    void setMainSegmentSize(size_t);
+    void setBranchSegmentSize(size_t);
+
+    void generateFile(const std::string &directory);
+
+private:
+    typedef std::vector<uint16_t> UnsafeMainDataSet;
+    typedef std::shared_ptr<UnsafeMainDataSet> MainDataSet;
+
+    struct MainDataSegment {
+        const size_t index;
+        const MainDataSet dataset;
+
+        MainDataSegment(size_t index, MainDataSet dataset);
+        const std::string hintLine() const;
+    };
+
+    typedef std::vector<MainDataSegment *> UnsafeBranchDataSet;
+    typedef std::shared_ptr<UnsafeBranchDataSet> BranchDataSet;
+
+    struct BranchDataSegment {
+        const size_t index;
+        const BranchDataSet dataset;
+
+        BranchDataSegment(size_t index, BranchDataSet dataset);
+        const std::string hintLine() const;
+    };
+
+    const Parser::LineBreak &m_lineBreak;
+    const Parser::GraphemeBreakProperty &m_graphemeBreakProperty;
+    const Parser::EmojiData &m_emojiData;
+    const Parser::EastAsianWidth &m_eastAsianWidth;
+    const Utilities::GeneralCategoryDetector m_generalCategoryDetector;
+
+    std::vector<uint16_t> m_properties;
+    uint32_t m_lastCodePoint;
+
+    size_t m_mainSegmentSize;
+    size_t m_branchSegmentSize;
+
+    std::vector<MainDataSegment> m_dataSegments;
+    std::vector<MainDataSegment *> m_dataReferences;
+
+    std::vector<BranchDataSegment> m_branchSegments;
+    std::vector<BranchDataSegment *> m_branchReferences;
+
+    size_t m_dataSize;
+    size_t m_mainIndexesSize;
+    size_t m_branchIndexesSize;
+
+    uint16_t resolveProperties(uint32_t codePoint) const;
+
+    void collectMainData();
+    void collectBranchData();
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Utilities/ArrayBuilder.h"
+#include "Utilities/Converter.h"
+#include "Utilities/FileBuilder.h"
+
+#include "JoiningLookupGenerator.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+using namespace SheenBidi::Generator;
+using namespace SheenBidi::Generator::Utilities;
+
+static const uint32_t FIRST_CODE_POINT = 0x0600;
+static const uint32_t LAST_CODE_POINT = 0x08FF;
+
+static const size_t ROW_LENGTH = 8;
+static const size_t BLOCK_LENGTH = 16;
+
+static const string DATA_ARRAY_TYPE = "static const uint8_t";
+static const string DATA_ARRAY_NAME = "JoiningData";
+
+/* Must be kept in sync with Joining::Type of JoiningLookup.h. */
+static const vector<pair<string, string>> JOINING_TYPE_MACROS = {
+    { "U", "NON_JOINING" },
+    { "R", "RIGHT_JOINING" },
+    { "L", "LEFT_JOINING" },
+    { "D", "DUAL_JOINING" },
+    { "C", "JOIN_CAUSING" },
+    { "T", "TRANSPARENT" },
+};
+
+/* Must be kept in sync with Joining::Group of JoiningLookup.h. */
+static const map<string, string> KASHIDA_GROUPS = {
+    { "SEEN", "SEEN" }, { "SAD", "SEEN" },
+    { "TEH MARBUTA", "HEH" }, { "TEH MARBUTA GOAL", "HEH" }, { "HEH", "HEH" },
+    { "HEH GOAL", "HEH" }, { "DAL", "HEH" },
+    { "ALEF", "ALEF" }, { "TAH", "ALEF" }, { "LAM", "ALEF" }, { "KAF", "ALEF" },
+    { "GAF", "ALEF" }, { "SWASH KAF", "ALEF" },
+    { "WAW", "WAW" }, { "STRAIGHT WAW", "WAW" }, { "AIN", "WAW" }, { "QAF", "WAW" },
+    { "FEH", "WAW" }, { "AFRICAN FEH", "WAW" }, { "AFRICAN QAF", "WAW" },
+    { "REH", "REH" }, { "YEH BARREE", "REH" }, { "BURUSHASKI YEH BARREE", "REH" },
+    { "YEH", "YEH" }, { "FARSI YEH", "YEH" }, { "YEH WITH TAIL", "YEH" },
+    { "ROHINGYA YEH", "YEH" }, { "THIN YEH", "YEH" },
+    { "BEH", "BEH" }, { "NOON", "BEH" }, { "AFRICAN NOON", "BEH" }, { "NYA", "BEH" },
+};
+
+static bool isArabicLetterBlock(uint32_t codePoint) {
+    /* Arabic, Arabic Supplement and Arabic Extended-A blocks; Syriac, NKo and others excluded. */
+    return (codePoint >= 0x0600 && codePoint <= 0x06FF)
+        || (codePoint >= 0x0750 && codePoint <= 0x077F)
+        || (codePoint >= 0x08A0 && codePoint <= 0x08FF);
+}
+
+JoiningLookupGenerator::JoiningLookupGenerator(const ArabicShaping &arabicShaping)
+    : m_arabicShaping(arabicShaping)
+{
+}
+
+string JoiningLookupGenerator::elementForCodePoint(uint32_t codePoint) const {
+    const string &joiningType = m_arabicShaping.joiningTypeForCodePoint(codePoint);
+    bool isKnownType = false;
+
+    for (auto &macro : JOINING_TYPE_MACROS) {
+        if (macro.first == joiningType) {
+            isKnownType = true;
+            break;
+        }
+    }
+
+    if (!isKnownType) {
+        cout << "Unknown joining type: " << joiningType << endl;
+        return "U";
+    }
+
+    string element = joiningType;
+
+    if (isArabicLetterBlock(codePoint)) {
+        auto group = KASHIDA_GROUPS.find(m_arabicShaping.joiningGroupForCodePoint(codePoint));
+        if (group != KASHIDA_GROUPS.end()) {
+            element += "|" + group->second;
+        }
+    }
+
+    return element;
+}
+
+void JoiningLookupGenerator::generateFile(const string &directory) {
+    size_t dataSize = LAST_CODE_POINT - FIRST_CODE_POINT + 1;
+
+    ArrayBuilder arrData;
+    arrData.setDataType(DATA_ARRAY_TYPE);
+    arrData.setName(DATA_ARRAY_NAME);
+    arrData.setSizeDescriptor(Converter::toString((int)dataSize));
+
+    for (uint32_t codePoint = FIRST_CODE_POINT; codePoint <= LAST_CODE_POINT; codePoint++) {
+        size_t offset = codePoint - FIRST_CODE_POINT;
+
+        if (offset % BLOCK_LENGTH == 0) {
+            arrData.append("/* 0x" + Converter::toHex(codePoint, 4)
+                           + "..0x" + Converter::toHex(codePoint + BLOCK_LENGTH - 1, 4) + " */");
+            arrData.newLine();
+        }
+
+        arrData.appendElement(elementForCodePoint(codePoint));
+
+        if (codePoint != LAST_CODE_POINT) {
+            arrData.newElement();
+
+            if ((offset + 1) % ROW_LENGTH == 0) {
+                arrData.newLine();
+            }
+        }
+    }
+
+    FileBuilder source(directory + "/JoiningLookup.cpp");
+    source.append("/*").newLine();
+    source.append(" * Automatically generated by SheenBidiGenerator tool from ArabicShaping.txt of").newLine();
+    source.append(" * Unicode " + m_arabicShaping.version().versionString() + ".").newLine();
+    source.append(" * DO NOT EDIT!!").newLine();
+    source.append(" *").newLine();
+    source.append(" * REQUIRED MEMORY: " + Converter::toString((int)dataSize) + " Bytes").newLine();
+    source.append(" */").newLine();
+    source.newLine();
+    source.append("#include <cstdint>").newLine();
+    source.newLine();
+    source.append("#include \"JoiningLookup.h\"").newLine();
+    source.newLine();
+    source.append("using namespace Tehreer;").newLine();
+    source.append("using namespace Tehreer::Joining;").newLine();
+    source.newLine();
+    for (auto &macro : JOINING_TYPE_MACROS) {
+        string name = macro.first + string(7 - macro.first.length(), ' ');
+        source.append("#define " + name + macro.second).newLine();
+    }
+    source.newLine();
+    source.append(arrData).newLine();
+    for (auto &macro : JOINING_TYPE_MACROS) {
+        source.append("#undef " + macro.first).newLine();
+    }
+    source.newLine();
+    source.append("uint8_t Tehreer::lookupJoiningProperties(uint32_t codePoint)").newLine();
+    source.append("{").newLine();
+    source.appendTabs(1).append("if (codePoint >= 0x" + Converter::toHex(FIRST_CODE_POINT, 4)
+                                + " && codePoint <= 0x" + Converter::toHex(LAST_CODE_POINT, 4) + ") {").newLine();
+    source.appendTabs(2).append("return JoiningData[codePoint - 0x" + Converter::toHex(FIRST_CODE_POINT, 4) + "];").newLine();
+    source.appendTabs(1).append("}").newLine();
+    source.newLine();
+    source.appendTabs(1).append("return NON_JOINING;").newLine();
+    source.append("}").newLine();
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHEENBIDI_GENERATOR_JOINING_LOOKUP_GENERATOR_H
+#define SHEENBIDI_GENERATOR_JOINING_LOOKUP_GENERATOR_H
+
+#include <cstdint>
+#include <string>
+
+#include <Parser/ArabicShaping.h>
+
+namespace SheenBidi {
+namespace Generator {
+
+/*
+ * Generates the joining properties lookup of Tehreer for the Arabic blocks, packing the joining
+ * type in the low three bits and the kashida group in the next three bits of each code point.
+ */
+class JoiningLookupGenerator {
+public:
+    JoiningLookupGenerator(const Parser::ArabicShaping &arabicShaping);
+
+    void generateFile(const std::string &directory);
+
+private:
+    const Parser::ArabicShaping &m_arabicShaping;
+
+    std::string elementForCodePoint(uint32_t codePoint) const;
+};
+
+}
+}
+
+#endif
@@ -18,17 +18,24 @@
 #include <iostream>
 #include <string>
 
+#include <Parser/ArabicShaping.h>
 #include <Parser/BidiBrackets.h>
 #include <Parser/BidiCharacterTest.h>
 #include <Parser/BidiMirroring.h>
 #include <Parser/DerivedBidiClass.h>
+#include <Parser/EastAsianWidth.h>
+#include <Parser/EmojiData.h>
+#include <Parser/GraphemeBreakProperty.h>
+#include <Parser/LineBreak.h>
 #include <Parser/PropertyValueAliases.h>
 #include <Parser/Scripts.h>
 #include <Parser/UnicodeData.h>
 #include <Parser/UnicodeVersion.h>
 
 #include "BidiTypeLookupGenerator.h"
+#include "BreakLookupGenerator.h"
 #include "GeneralCategoryLookupGenerator.h"
+#include "JoiningLookupGenerator.h"
 #include "PairingLookupGenerator.h"
 #include "ScriptLookupGenerator.h"
 
@@ -40,6 +47,7 @@ int main(int argc, const char * argv[])
 {
     const string in = "/path/to/input";
     const string out = "/path/to/output";
+    const string tehreerOut = "/path/to/tehreer/jni";
 
     UnicodeData unicodeData(in);
     BidiMirroring bidiMirroring(in);
@@ -47,6 +55,11 @@ int main(int argc, const char * argv[])
     DerivedBidiClass derivedBidiClass(in);
     Scripts scripts(in);
     PropertyValueAliases propertyValueAliases(in);
+    LineBreak lineBreak(in);
+    GraphemeBreakProperty graphemeBreakProperty(in);
+    EmojiData emojiData(in);
+    EastAsianWidth eastAsianWidth(in);
+    ArabicShaping arabicShaping(in, unicodeData);
 
     cout << "Generating files." << endl;
 
@@ -69,6 +82,14 @@ int main(int argc, const char * argv[])
     scriptLookup.setBranchSegmentSize(32);
     scriptLookup.generateFile(out);
 
+    BreakLookupGenerator breakLookup(lineBreak, graphemeBreakProperty, emojiData, eastAsianWidth, unicodeData);
+    breakLookup.setMainSegmentSize(8);
+    breakLookup.setBranchSegmentSize(64);
+    breakLookup.generateFile(tehreerOut);
+
+    JoiningLookupGenerator joiningLookup(arabicShaping);
+    joiningLookup.generateFile(tehreerOut);
+
     cout << "Finished.";
 
     getchar();
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "UnicodeData.h"
+#include "UnicodeVersion.h"
+#include "ArabicShaping.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+
+static const string FILE_ARABIC_SHAPING = "ArabicShaping.txt";
+static const string JOINING_TYPE_UNLISTED = "";
+static const string JOINING_TYPE_NON_JOINING = "U";
+static const string JOINING_TYPE_TRANSPARENT = "T";
+static const string JOINING_GROUP_MISSING = "No_Joining_Group";
+
+static inline uint8_t getNameNumber(vector<string> &obj, const string &name) {
+    auto begin = obj.begin();
+    auto end = obj.end();
+    auto match = find(begin, end, name);
+    if (match != end) {
+        return static_cast<uint8_t>(distance(begin, match));
+    }
+
+    uint8_t number = static_cast<uint8_t>(obj.size());
+    obj.push_back(name);
+
+    return number;
+}
+
+static inline string trimField(const string &field) {
+    size_t start = field.find_first_not_of(' ');
+    size_t end = field.find_last_not_of(' ');
+
+    if (start == string::npos) {
+        return string();
+    }
+
+    return field.substr(start, end - start + 1);
+}
+
+ArabicShaping::ArabicShaping(const string &directory, const UnicodeData &unicodeData) :
+    m_unicodeData(unicodeData),
+    m_firstCodePoint(0),
+    m_lastCodePoint(0),
+    m_typeNames(),
+    m_typeNumbers(0x110000),
+    m_groupNames(),
+    m_groupNumbers(0x110000)
+{
+    m_typeNames.push_back(JOINING_TYPE_UNLISTED);
+    m_groupNames.push_back(JOINING_GROUP_MISSING);
+    ifstream stream(directory + "/" + FILE_ARABIC_SHAPING, ios::in);
+
+    string versionLine;
+    getline(stream, versionLine);
+    m_version = new UnicodeVersion(versionLine);
+
+    string line;
+    while (getline(stream, line)) {
+        if (!line.empty() && line[0] != '#') {
+            /* Fields: code point; schematic name; joining type; joining group */
+            size_t first = line.find(';');
+            size_t second = line.find(';', first + 1);
+            size_t third = line.find(';', second + 1);
+
+            auto codePoint = static_cast<uint32_t>(strtoul(line.c_str(), nullptr, 16));
+            string joiningType = trimField(line.substr(second + 1, third - second - 1));
+            string joiningGroup = trimField(line.substr(third + 1));
+
+            m_typeNumbers[codePoint] = getNameNumber(m_typeNames, joiningType);
+            m_groupNumbers[codePoint] = getNameNumber(m_groupNames, joiningGroup);
+
+            if (codePoint > m_lastCodePoint) {
+                m_lastCodePoint = codePoint;
+            }
+        }
+    }
+}
+
+ArabicShaping::~ArabicShaping() {
+    delete m_version;
+}
+
+uint32_t ArabicShaping::firstCodePoint() const {
+    return m_firstCodePoint;
+}
+
+uint32_t ArabicShaping::lastCodePoint() const {
+    return m_lastCodePoint;
+}
+
+UnicodeVersion &ArabicShaping::version() const {
+    return *m_version;
+}
+
+const string &ArabicShaping::joiningTypeForCodePoint(uint32_t codePoint) const {
+    if (codePoint <= m_lastCodePoint) {
+        const string &joiningType = m_typeNames.at(m_typeNumbers.at(codePoint));
+        if (!joiningType.empty()) {
+            return joiningType;
+        }
+    }
+
+    /*
+     * Unlisted code points of general category Mn, Me or Cf are transparent, all others are
+     * non-joining.
+     */
+    string generalCategory;
+    m_unicodeData.getGeneralCategory(codePoint, generalCategory);
+
+    if (generalCategory == "Mn" || generalCategory == "Me" || generalCategory == "Cf") {
+        return JOINING_TYPE_TRANSPARENT;
+    }
+
+    return JOINING_TYPE_NON_JOINING;
+}
+
+const string &ArabicShaping::joiningGroupForCodePoint(uint32_t codePoint) const {
+    if (codePoint <= m_lastCodePoint) {
+        return m_groupNames.at(m_groupNumbers.at(codePoint));
+    }
+
+    return JOINING_GROUP_MISSING;
+}
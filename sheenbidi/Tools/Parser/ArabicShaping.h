@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHEENBIDI_PARSER_ARABIC_SHAPING_H
+#define SHEENBIDI_PARSER_ARABIC_SHAPING_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "UnicodeData.h"
+#include "UnicodeVersion.h"
+
+namespace SheenBidi {
+namespace Parser {
+
+class ArabicShaping {
+public:
+    ArabicShaping(const std::string &directory, const UnicodeData &unicodeData);
+    ~ArabicShaping();
+
+    uint32_t firstCodePoint() const;
+    uint32_t lastCodePoint() const;
+
+    UnicodeVersion &version() const;
+    const std::string &joiningTypeForCodePoint(uint32_t) const;
+    const std::string &joiningGroupForCodePoint(uint32_t) const;
+
+private:
+    const UnicodeData &m_unicodeData;
+
+    uint32_t m_firstCodePoint;
+    uint32_t m_lastCodePoint;
+
+    UnicodeVersion *m_version;
+    std::vector<std::string> m_typeNames;
+    std::vector<uint8_t> m_typeNumbers;
+    std::vector<std::string> m_groupNames;
+    std::vector<uint8_t> m_groupNumbers;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include "BreakTest.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+
+static const string BREAK_SIGN = "\xC3\xB7";        /* U+00F7 DIVISION SIGN */
+static const string NO_BREAK_SIGN = "\xC3\x97";     /* U+00D7 MULTIPLICATION SIGN */
+
+static inline void initializeTestCase(BreakTest::TestCase &testCase)
+{
+    const int DefaultLength = 32;
+
+    testCase.text.reserve(DefaultLength);
+    testCase.breaks.reserve(DefaultLength);
+}
+
+static inline bool isSpace(char ch)
+{
+    return (ch == ' ' || ch == '\t' || ch == '\r');
+}
+
+static bool readTestCase(BreakTest::TestCase &testCase, const char *line)
+{
+    testCase.text.clear();
+    testCase.breaks.clear();
+
+    const char *field = line;
+
+    while (*field != '\0' && *field != '#') {
+        if (isSpace(*field)) {
+            field++;
+            continue;
+        }
+
+        const char *end = field;
+        while (*end != '\0' && *end != '#' && !isSpace(*end)) {
+            end++;
+        }
+
+        string token(field, end);
+
+        if (token == BREAK_SIGN || token == NO_BREAK_SIGN) {
+            /* The sign before the first code point marks the start of text which is not tested. */
+            if (!testCase.text.empty()) {
+                testCase.breaks.push_back(token == BREAK_SIGN);
+            }
+        } else {
+            testCase.text.push_back((uint32_t)strtoul(token.c_str(), nullptr, 16));
+        }
+
+        field = end;
+    }
+
+    return (!testCase.text.empty() && testCase.breaks.size() == testCase.text.size());
+}
+
+BreakTest::BreakTest(const string &directory, const string &fileName) :
+    m_FileName(fileName),
+    m_Stream(directory + "/" + fileName, ios::binary),
+    m_LineNumber(0)
+{
+    initializeTestCase(m_TestCase);
+}
+
+BreakTest::~BreakTest() {
+    m_Stream.close();
+}
+
+const string &BreakTest::fileName() const {
+    return m_FileName;
+}
+
+const BreakTest::TestCase &BreakTest::testCase() const {
+    return m_TestCase;
+}
+
+bool BreakTest::fetchNext() {
+    string line;
+
+    while (getline(m_Stream, line)) {
+        m_LineNumber++;
+
+        if (readTestCase(m_TestCase, line.c_str())) {
+            m_TestCase.lineNumber = m_LineNumber;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void BreakTest::reset() {
+    m_Stream.clear();
+    m_Stream.seekg(0);
+    m_LineNumber = 0;
+}
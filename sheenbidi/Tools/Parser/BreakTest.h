@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef SHEENBIDI_PARSER_BREAK_TEST_H
+#define SHEENBIDI_PARSER_BREAK_TEST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace SheenBidi {
+namespace Parser {
+
+/*
+ * Reads the break test files of UCD, i.e. GraphemeBreakTest.txt and LineBreakTest.txt, which share
+ * a single format. A missing file yields no test case.
+ */
+class BreakTest {
+public:
+    struct TestCase {
+        size_t lineNumber;
+        std::vector<uint32_t> text;
+        /* Tells whether a break is allowed after the code point at the same index. */
+        std::vector<bool> breaks;
+    };
+
+    BreakTest(const std::string &directory, const std::string &fileName);
+    ~BreakTest();
+
+    const std::string &fileName() const;
+    const TestCase &testCase() const;
+
+    bool fetchNext();
+    void reset();
+
+private:
+    std::string m_FileName;
+    std::ifstream m_Stream;
+    size_t m_LineNumber;
+    TestCase m_TestCase;
+};
+
+}
+}
+
+#endif
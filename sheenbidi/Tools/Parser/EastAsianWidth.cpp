@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "UnicodeVersion.h"
+#include "EastAsianWidth.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+
+static const string FILE_EAST_ASIAN_WIDTH = "EastAsianWidth.txt";
+static const string EAST_ASIAN_WIDTH_MISSING = "N";
+
+static inline uint8_t getWidthNumber(vector<string> &obj, const string &width) {
+    auto begin = obj.begin();
+    auto end = obj.end();
+    auto match = find(begin, end, width);
+    if (match != end) {
+        return static_cast<uint8_t>(distance(begin, match));
+    }
+
+    uint8_t number = static_cast<uint8_t>(obj.size());
+    obj.push_back(width);
+
+    return number;
+}
+
+static inline char *readCodePointRange(char *field, uint32_t *first, uint32_t *last) {
+    *first = static_cast<uint32_t>(strtoul(field, &field, 16));
+
+    if (*field == '.') {
+        *last = static_cast<uint32_t>(strtoul(field + 2, &field, 16));
+    } else {
+        *last = *first;
+    }
+
+    while (*field++ != ';');
+
+    return field;
+}
+
+static inline char *readPropertyValue(char *field, string *value) {
+    char *start = field;
+    while (*start == ' ') {
+        start++;
+    }
+
+    char *end = start;
+    while (*end != '\0' && *end != ' ' && *end != '#') {
+        end++;
+    }
+
+    *value = string(start, static_cast<size_t>(distance(start, end)));
+
+    return end;
+}
+
+EastAsianWidth::EastAsianWidth(const string &directory) :
+    m_firstCodePoint(0),
+    m_lastCodePoint(0),
+    m_widthNames(),
+    m_widthNumbers(0x110000)
+{
+    m_widthNames.push_back(EAST_ASIAN_WIDTH_MISSING);
+    ifstream stream(directory + "/" + FILE_EAST_ASIAN_WIDTH, ios::in);
+
+    string versionLine;
+    getline(stream, versionLine);
+    m_version = new UnicodeVersion(versionLine);
+
+    string line;
+    while (getline(stream, line)) {
+        if (!line.empty() && line[0] != '#') {
+            uint32_t firstCodePoint = 0;
+            uint32_t lastCodePoint = 0;
+            string width;
+
+            char *field = &line[0];
+            field = readCodePointRange(field, &firstCodePoint, &lastCodePoint);
+            field = readPropertyValue(field, &width);
+
+            uint8_t number = getWidthNumber(m_widthNames, width);
+            for (uint32_t codePoint = firstCodePoint; codePoint <= lastCodePoint; codePoint++) {
+                m_widthNumbers[codePoint] = number;
+            }
+
+            if (lastCodePoint > m_lastCodePoint) {
+                m_lastCodePoint = lastCodePoint;
+            }
+        }
+    }
+}
+
+EastAsianWidth::~EastAsianWidth() {
+    delete m_version;
+}
+
+uint32_t EastAsianWidth::firstCodePoint() const {
+    return m_firstCodePoint;
+}
+
+uint32_t EastAsianWidth::lastCodePoint() const {
+    return m_lastCodePoint;
+}
+
+UnicodeVersion &EastAsianWidth::version() const {
+    return *m_version;
+}
+
+const string &EastAsianWidth::eastAsianWidthForCodePoint(uint32_t codePoint) const {
+    if (codePoint <= m_lastCodePoint) {
+        return m_widthNames.at(m_widthNumbers.at(codePoint));
+    }
+
+    return EAST_ASIAN_WIDTH_MISSING;
+}
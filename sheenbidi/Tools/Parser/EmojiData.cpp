@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "UnicodeVersion.h"
+#include "EmojiData.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+
+static const string FILE_EMOJI_DATA = "emoji-data.txt";
+
+static inline uint8_t getPropertyMask(vector<string> &obj, const string &property) {
+    auto begin = obj.begin();
+    auto end = obj.end();
+    auto match = find(begin, end, property);
+    if (match != end) {
+        return static_cast<uint8_t>(1 << distance(begin, match));
+    }
+
+    uint8_t mask = static_cast<uint8_t>(1 << obj.size());
+    obj.push_back(property);
+
+    return mask;
+}
+
+static inline char *readCodePointRange(char *field, uint32_t *first, uint32_t *last) {
+    *first = static_cast<uint32_t>(strtoul(field, &field, 16));
+
+    if (*field == '.') {
+        *last = static_cast<uint32_t>(strtoul(field + 2, &field, 16));
+    } else {
+        *last = *first;
+    }
+
+    while (*field++ != ';');
+
+    return field;
+}
+
+static inline char *readPropertyName(char *field, string *name) {
+    char *start = field;
+    while (*start == ' ') {
+        start++;
+    }
+
+    char *end = start;
+    while (*end != '\0' && *end != ' ' && *end != '#') {
+        end++;
+    }
+
+    *name = string(start, static_cast<size_t>(distance(start, end)));
+
+    return end;
+}
+
+EmojiData::EmojiData(const string &directory) :
+    m_firstCodePoint(0),
+    m_lastCodePoint(0),
+    m_propertyNames(),
+    m_propertyMasks(0x110000)
+{
+    ifstream stream(directory + "/" + FILE_EMOJI_DATA, ios::in);
+
+    string versionLine;
+    getline(stream, versionLine);
+    m_version = new UnicodeVersion(versionLine);
+
+    string line;
+    while (getline(stream, line)) {
+        if (!line.empty() && line[0] != '#') {
+            uint32_t firstCodePoint = 0;
+            uint32_t lastCodePoint = 0;
+            string property;
+
+            char *field = &line[0];
+            field = readCodePointRange(field, &firstCodePoint, &lastCodePoint);
+            field = readPropertyName(field, &property);
+
+            uint8_t mask = getPropertyMask(m_propertyNames, property);
+            for (uint32_t codePoint = firstCodePoint; codePoint <= lastCodePoint; codePoint++) {
+                m_propertyMasks[codePoint] |= mask;
+            }
+
+            if (lastCodePoint > m_lastCodePoint) {
+                m_lastCodePoint = lastCodePoint;
+            }
+        }
+    }
+}
+
+EmojiData::~EmojiData() {
+    delete m_version;
+}
+
+uint32_t EmojiData::firstCodePoint() const {
+    return m_firstCodePoint;
+}
+
+uint32_t EmojiData::lastCodePoint() const {
+    return m_lastCodePoint;
+}
+
+UnicodeVersion &EmojiData::version() const {
+    return *m_version;
+}
+
+bool EmojiData::hasProperty(uint32_t codePoint, const string &property) const {
+    if (codePoint <= m_lastCodePoint) {
+        auto begin = m_propertyNames.begin();
+        auto end = m_propertyNames.end();
+        auto match = find(begin, end, property);
+        if (match != end) {
+            uint8_t mask = static_cast<uint8_t>(1 << distance(begin, match));
+            return (m_propertyMasks.at(codePoint) & mask) != 0;
+        }
+    }
+
+    return false;
+}
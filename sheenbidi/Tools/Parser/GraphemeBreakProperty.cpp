@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "UnicodeVersion.h"
+#include "GraphemeBreakProperty.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+
+static const string FILE_GRAPHEME_BREAK_PROPERTY = "GraphemeBreakProperty.txt";
+static const string GRAPHEME_BREAK_MISSING = "Other";
+
+static inline uint8_t getGraphemeBreakNumber(vector<string> &obj, const string &graphemeBreak) {
+    auto begin = obj.begin();
+    auto end = obj.end();
+    auto match = find(begin, end, graphemeBreak);
+    if (match != end) {
+        return static_cast<uint8_t>(distance(begin, match));
+    }
+
+    uint8_t number = static_cast<uint8_t>(obj.size());
+    obj.push_back(graphemeBreak);
+
+    return number;
+}
+
+static inline char *readCodePointRange(char *field, uint32_t *first, uint32_t *last) {
+    *first = static_cast<uint32_t>(strtoul(field, &field, 16));
+
+    if (*field == '.') {
+        *last = static_cast<uint32_t>(strtoul(field + 2, &field, 16));
+    } else {
+        *last = *first;
+    }
+
+    while (*field++ != ';');
+
+    return field;
+}
+
+static inline char *readPropertyValue(char *field, string *value) {
+    char *start = field;
+    while (*start == ' ') {
+        start++;
+    }
+
+    char *end = start;
+    while (*end != '\0' && *end != ' ' && *end != '#') {
+        end++;
+    }
+
+    *value = string(start, static_cast<size_t>(distance(start, end)));
+
+    return end;
+}
+
+GraphemeBreakProperty::GraphemeBreakProperty(const string &directory) :
+    m_firstCodePoint(0),
+    m_lastCodePoint(0),
+    m_graphemeBreakNames(),
+    m_graphemeBreakNumbers(0x110000)
+{
+    m_graphemeBreakNames.push_back(GRAPHEME_BREAK_MISSING);
+    ifstream stream(directory + "/" + FILE_GRAPHEME_BREAK_PROPERTY, ios::in);
+
+    string versionLine;
+    getline(stream, versionLine);
+    m_version = new UnicodeVersion(versionLine);
+
+    string line;
+    while (getline(stream, line)) {
+        if (!line.empty() && line[0] != '#') {
+            uint32_t firstCodePoint = 0;
+            uint32_t lastCodePoint = 0;
+            string graphemeBreak;
+
+            char *field = &line[0];
+            field = readCodePointRange(field, &firstCodePoint, &lastCodePoint);
+            field = readPropertyValue(field, &graphemeBreak);
+
+            uint8_t number = getGraphemeBreakNumber(m_graphemeBreakNames, graphemeBreak);
+            for (uint32_t codePoint = firstCodePoint; codePoint <= lastCodePoint; codePoint++) {
+                m_graphemeBreakNumbers[codePoint] = number;
+            }
+
+            if (lastCodePoint > m_lastCodePoint) {
+                m_lastCodePoint = lastCodePoint;
+            }
+        }
+    }
+}
+
+GraphemeBreakProperty::~GraphemeBreakProperty() {
+    delete m_version;
+}
+
+uint32_t GraphemeBreakProperty::firstCodePoint() const {
+    return m_firstCodePoint;
+}
+
+uint32_t GraphemeBreakProperty::lastCodePoint() const {
+    return m_lastCodePoint;
+}
+
+UnicodeVersion &GraphemeBreakProperty::version() const {
+    return *m_version;
+}
+
+const string &GraphemeBreakProperty::graphemeBreakForCodePoint(uint32_t codePoint) const {
+    if (codePoint <= m_lastCodePoint) {
+        return m_graphemeBreakNames.at(m_graphemeBreakNumbers.at(codePoint));
+    }
+
+    return GRAPHEME_BREAK_MISSING;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "UnicodeVersion.h"
+#include "LineBreak.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+
+static const string FILE_LINE_BREAK = "LineBreak.txt";
+static const string LINE_BREAK_MISSING = "XX";
+
+static inline uint8_t getLineBreakNumber(vector<string> &obj, const string &lineBreak) {
+    auto begin = obj.begin();
+    auto end = obj.end();
+    auto match = find(begin, end, lineBreak);
+    if (match != end) {
+        return static_cast<uint8_t>(distance(begin, match));
+    }
+
+    uint8_t number = static_cast<uint8_t>(obj.size());
+    obj.push_back(lineBreak);
+
+    return number;
+}
+
+static inline char *readCodePointRange(char *field, uint32_t *first, uint32_t *last) {
+    *first = static_cast<uint32_t>(strtoul(field, &field, 16));
+
+    if (*field == '.') {
+        *last = static_cast<uint32_t>(strtoul(field + 2, &field, 16));
+    } else {
+        *last = *first;
+    }
+
+    while (*field++ != ';');
+
+    return field;
+}
+
+static inline char *readPropertyValue(char *field, string *value) {
+    char *start = field;
+    while (*start == ' ') {
+        start++;
+    }
+
+    char *end = start;
+    while (*end != '\0' && *end != ' ' && *end != '#') {
+        end++;
+    }
+
+    *value = string(start, static_cast<size_t>(distance(start, end)));
+
+    return end;
+}
+
+LineBreak::LineBreak(const string &directory) :
+    m_firstCodePoint(0),
+    m_lastCodePoint(0),
+    m_lineBreakNames(),
+    m_lineBreakNumbers(0x110000)
+{
+    m_lineBreakNames.push_back(LINE_BREAK_MISSING);
+    ifstream stream(directory + "/" + FILE_LINE_BREAK, ios::in);
+
+    string versionLine;
+    getline(stream, versionLine);
+    m_version = new UnicodeVersion(versionLine);
+
+    string line;
+    while (getline(stream, line)) {
+        if (!line.empty() && line[0] != '#') {
+            uint32_t firstCodePoint = 0;
+            uint32_t lastCodePoint = 0;
+            string lineBreak;
+
+            char *field = &line[0];
+            field = readCodePointRange(field, &firstCodePoint, &lastCodePoint);
+            field = readPropertyValue(field, &lineBreak);
+
+            uint8_t number = getLineBreakNumber(m_lineBreakNames, lineBreak);
+            for (uint32_t codePoint = firstCodePoint; codePoint <= lastCodePoint; codePoint++) {
+                m_lineBreakNumbers[codePoint] = number;
+            }
+
+            if (lastCodePoint > m_lastCodePoint) {
+                m_lastCodePoint = lastCodePoint;
+            }
+        }
+    }
+}
+
+LineBreak::~LineBreak() {
+    delete m_version;
+}
+
+uint32_t LineBreak::firstCodePoint() const {
+    return m_firstCodePoint;
+}
+
+uint32_t LineBreak::lastCodePoint() const {
+    return m_lastCodePoint;
+}
+
+UnicodeVersion &LineBreak::version() const {
+    return *m_version;
+}
+
+const string &LineBreak::lineBreakForCodePoint(uint32_t codePoint) const {
+    if (codePoint <= m_lastCodePoint) {
+        return m_lineBreakNames.at(m_lineBreakNumbers.at(codePoint));
+    }
+
+    return LINE_BREAK_MISSING;
+}
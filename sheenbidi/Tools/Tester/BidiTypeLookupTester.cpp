@@ -15,10 +15,13 @@
  */
 
 extern "C" {
+#include <Headers/SBAlgorithm.h>
 #include <Headers/SBBase.h>
 #include <Headers/SBBidiType.h>
+#include <Headers/SBCodepointSequence.h>
 #include <Headers/SBConfig.h>
 #include <Source/BidiTypeLookup.h>
+#include <Source/SBAlgorithm.h>
 }
 
 #include <cassert>
@@ -26,6 +29,7 @@ extern "C" {
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include <Parser/DerivedBidiClass.h>
 
@@ -74,7 +78,67 @@ void BidiTypeLookupTester::test() {
         }
     }
 
+    failCounter += testUTF16Types();
+
     cout << failCounter << " error/s." << endl;
     cout << endl;
 #endif
 }
+
+size_t BidiTypeLookupTester::testUTF16Types() {
+    size_t failCounter = 0;
+
+#ifndef SB_CONFIG_UNITY
+    vector<uint16_t> units;
+
+    /* Place all code points in a single string to exercise both the block and scalar paths. */
+    for (uint32_t codePoint = 0; codePoint <= Unicode::MAX_CODE_POINT; codePoint++) {
+        if (codePoint < 0xD800 || (codePoint > 0xDFFF && codePoint <= 0xFFFF)) {
+            units.push_back(static_cast<uint16_t>(codePoint));
+        } else if (codePoint > 0xFFFF) {
+            uint32_t offset = codePoint - 0x10000;
+            units.push_back(static_cast<uint16_t>(0xD800 + (offset >> 10)));
+            units.push_back(static_cast<uint16_t>(0xDC00 + (offset & 0x3FF)));
+        }
+    }
+    /* Append lone surrogates mixed with simple text. */
+    const uint16_t trailingUnits[] = { 0xDC00, 'a', 'B', ' ', '1', 0x0627, 0xD800, 'x', 0xDFFF };
+    units.insert(units.end(), begin(trailingUnits), end(trailingUnits));
+
+    SBCodepointSequence sequence;
+    sequence.stringEncoding = SBStringEncodingUTF16;
+    sequence.stringBuffer = units.data();
+    sequence.stringLength = units.size();
+
+    SBAlgorithmRef algorithm = SBAlgorithmCreate(&sequence);
+    SBUInteger stringIndex = 0;
+    SBUInteger firstIndex = 0;
+    SBCodepoint codepoint;
+
+    while ((codepoint = SBCodepointSequenceGetCodepointAt(&sequence, &stringIndex)) != SBCodepointInvalid) {
+        SBBidiType expType = LookupBidiType(codepoint);
+
+        for (; firstIndex < stringIndex; firstIndex++) {
+            SBBidiType genType = algorithm->fixedTypes[firstIndex];
+
+            if (genType != expType) {
+                if (Configuration::DISPLAY_ERROR_DETAILS) {
+                    cout << "Invalid UTF-16 char type found: " << endl
+                         << "  Code Unit Index: " << firstIndex << endl
+                         << "  Expected Char Type: " << Convert::bidiTypeToString(expType) << endl
+                         << "  Generated Char Type: " << Convert::bidiTypeToString(genType) << endl;
+                }
+
+                failCounter++;
+            }
+
+            /* Subsequent code units get 'BN' type. */
+            expType = SBBidiTypeBN;
+        }
+    }
+
+    SBAlgorithmRelease(algorithm);
+#endif
+
+    return failCounter;
+}
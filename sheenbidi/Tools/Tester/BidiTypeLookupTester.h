@@ -17,6 +17,8 @@
 #ifndef _SHEENBIDI__TESTER__BIDI_TYPE_LOOKUP_TESTER_H
 #define _SHEENBIDI__TESTER__BIDI_TYPE_LOOKUP_TESTER_H
 
+#include <cstddef>
+
 #include <Parser/DerivedBidiClass.h>
 
 namespace SheenBidi {
@@ -29,6 +31,8 @@ public:
     void test();
 
 private:
+    size_t testUTF16Types();
+
     const Parser::DerivedBidiClass &m_derivedBidiClass;
 };
 
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <BreakClassifier.h>
+#include <BreakLookup.h>
+#include <JavaBridge.h>
+
+#include <Parser/BreakTest.h>
+
+#include "Configuration.h"
+#include "BreakClassifierTester.h"
+
+using namespace std;
+using namespace SheenBidi::Parser;
+using namespace SheenBidi::Tester;
+
+/* The classifier is tested in isolation, so its native methods are never registered. */
+jint Tehreer::JavaBridge::registerClass(JNIEnv *, const char *, const JNINativeMethod *, jint)
+{
+    return JNI_ERR;
+}
+
+static Tehreer::LineBreak::Class lineBreakClass(uint32_t codePoint)
+{
+    using namespace Tehreer::LineBreak;
+
+    return static_cast<Class>(Tehreer::lookupBreakProperties(codePoint) & CLASS_MASK);
+}
+
+/*
+ * Tells whether a line break test case exercises a sequence which the classifier resolves with
+ * the tailorings of ICU instead of the default rules of UAX #14.
+ */
+static bool isTailoredLineBreakCase(const vector<uint32_t> &text)
+{
+    using namespace Tehreer::LineBreak;
+
+    for (size_t i = 0; i + 1 < text.size(); i++) {
+        Class currClass = lineBreakClass(text[i]);
+        Class nextClass = lineBreakClass(text[i + 1]);
+
+        /* LB13 (tailored): A space followed by an infix separator starting a number. */
+        if (currClass == SP && nextClass == IS) {
+            for (size_t j = i + 2; j < text.size(); j++) {
+                Class numberClass = lineBreakClass(text[j]);
+                if (numberClass != CM && numberClass != ZWJ) {
+                    if (numberClass == NU) {
+                        return true;
+                    }
+                    break;
+                }
+            }
+        }
+
+        /* LB20 (tailored): A word-initial hyphen followed by a letter. */
+        if ((currClass == HY || text[i] == 0x2010) && nextClass == AL) {
+            Class prevClass = (i > 0 ? lineBreakClass(text[i - 1]) : SP);
+            if (prevClass == SP || prevClass == BK || prevClass == CR || prevClass == LF
+                || prevClass == NL || prevClass == ZW || prevClass == CB) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+static void displayTestCase(const BreakTest &breakTest, const vector<int8_t> &breakData,
+                            const vector<size_t> &charEnds, int8_t breakType)
+{
+    const BreakTest::TestCase &testCase = breakTest.testCase();
+
+    cout << "Test failed due to break mismatch." << endl
+         << "  File: " << breakTest.fileName() << endl
+         << "  Line Number: " << testCase.lineNumber << endl
+         << "  Code Points:";
+    for (uint32_t codePoint : testCase.text) {
+        cout << " " << hex << uppercase << setw(4) << setfill('0') << codePoint;
+    }
+    cout << dec << setfill(' ') << endl;
+
+    cout << "  Expected Breaks:";
+    for (bool isBreak : testCase.breaks) {
+        cout << " " << (isBreak ? 1 : 0);
+    }
+    cout << endl;
+
+    cout << "  Discovered Breaks:";
+    for (size_t charEnd : charEnds) {
+        cout << " " << ((breakData[charEnd - 1] & breakType) ? 1 : 0);
+    }
+    cout << endl;
+}
+
+BreakClassifierTester::BreakClassifierTester(BreakTest *graphemeBreakTest, BreakTest *lineBreakTest)
+    : m_graphemeBreakTest(graphemeBreakTest)
+    , m_lineBreakTest(lineBreakTest)
+{
+}
+
+void BreakClassifierTester::loadText(const vector<uint32_t> &text)
+{
+    m_charArray.clear();
+    m_charEnds.clear();
+
+    for (uint32_t codePoint : text) {
+        if (codePoint >= 0x10000) {
+            codePoint -= 0x10000;
+            m_charArray.push_back(static_cast<uint16_t>(0xD800 + (codePoint >> 10)));
+            m_charArray.push_back(static_cast<uint16_t>(0xDC00 + (codePoint & 0x3FF)));
+        } else {
+            m_charArray.push_back(static_cast<uint16_t>(codePoint));
+        }
+
+        m_charEnds.push_back(m_charArray.size());
+    }
+
+    m_breakData.assign(m_charArray.size(), 0);
+}
+
+void BreakClassifierTester::analyzeBreakTest(BreakTest &breakTest, int8_t breakType, bool isLineTest)
+{
+    breakTest.reset();
+
+    while (breakTest.fetchNext()) {
+        const BreakTest::TestCase &testCase = breakTest.testCase();
+
+        if (isLineTest && isTailoredLineBreakCase(testCase.text)) {
+            skipCounter++;
+            continue;
+        }
+
+        loadText(testCase.text);
+
+        Tehreer::BreakClassifier breakClassifier(m_charArray.data(), m_breakData.data());
+        breakClassifier.classify(0, static_cast<jint>(m_charArray.size()));
+
+        bool passed = true;
+
+        for (size_t i = 0; i < m_charEnds.size(); i++) {
+            bool isBreak = (m_breakData[m_charEnds[i] - 1] & breakType);
+
+            if (isBreak != testCase.breaks[i]) {
+                passed = false;
+                break;
+            }
+        }
+
+        if (!passed) {
+            if (Configuration::DISPLAY_ERROR_DETAILS) {
+                displayTestCase(breakTest, m_breakData, m_charEnds, breakType);
+            }
+
+            failCounter++;
+        }
+
+        testCounter++;
+    }
+}
+
+void BreakClassifierTester::test()
+{
+    cout << "Running break classifier tester." << endl;
+
+    testCounter = 0;
+    skipCounter = 0;
+    failCounter = 0;
+
+    if (m_graphemeBreakTest) {
+        analyzeBreakTest(*m_graphemeBreakTest, Tehreer::BreakClassifier::BreakTypeCharacter, false);
+    }
+    if (m_lineBreakTest) {
+        analyzeBreakTest(*m_lineBreakTest, Tehreer::BreakClassifier::BreakTypeLine, true);
+    }
+
+    if (testCounter > 0) {
+        cout << skipCounter << " test/s skipped for tailorings." << endl;
+        cout << failCounter << " error/s." << endl;
+    } else {
+        cout << "No test case found for break classifier tester." << endl;
+    }
+
+    cout << endl;
+}
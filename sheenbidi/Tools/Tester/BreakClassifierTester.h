@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef SHEENBIDI_TESTER_BREAK_CLASSIFIER_TESTER_H
+#define SHEENBIDI_TESTER_BREAK_CLASSIFIER_TESTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Parser/BreakTest.h>
+
+namespace SheenBidi {
+namespace Tester {
+
+/*
+ * Checks the break classifier of Tehreer against the grapheme and line break tests of UCD.
+ */
+class BreakClassifierTester {
+public:
+    BreakClassifierTester(Parser::BreakTest *graphemeBreakTest, Parser::BreakTest *lineBreakTest);
+
+    void test();
+
+private:
+    Parser::BreakTest *m_graphemeBreakTest;
+    Parser::BreakTest *m_lineBreakTest;
+
+    size_t testCounter;
+    size_t skipCounter;
+    size_t failCounter;
+
+    std::vector<uint16_t> m_charArray;
+    std::vector<size_t> m_charEnds;
+    std::vector<int8_t> m_breakData;
+
+    void loadText(const std::vector<uint32_t> &text);
+    void analyzeBreakTest(Parser::BreakTest &breakTest, int8_t breakType, bool isLineTest);
+};
+
+}
+}
+
+#endif
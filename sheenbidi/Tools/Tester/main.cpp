@@ -24,6 +24,7 @@ extern "C" {
 #include <Parser/BidiCharacterTest.h>
 #include <Parser/BidiMirroring.h>
 #include <Parser/BidiTest.h>
+#include <Parser/BreakTest.h>
 #include <Parser/DerivedBidiClass.h>
 #include <Parser/PropertyValueAliases.h>
 #include <Parser/Scripts.h>
@@ -32,6 +33,9 @@ extern "C" {
 #include "AlgorithmTester.h"
 #include "BidiTypeLookupTester.h"
 #include "BracketLookupTester.h"
+#ifdef SB_TESTER_BREAK_CLASSIFIER
+#include "BreakClassifierTester.h"
+#endif
 #include "CodepointSequenceTester.h"
 #include "GeneralCategoryLookupTester.h"
 #include "MirrorLookupTester.h"
@@ -53,6 +57,10 @@ int main(int argc, const char *argv[]) {
     DerivedBidiClass derivedBidiClass(dir);
     Scripts scripts(dir);
     PropertyValueAliases propertyValueAliases(dir);
+#ifdef SB_TESTER_BREAK_CLASSIFIER
+    BreakTest graphemeBreakTest(dir, "GraphemeBreakTest.txt");
+    BreakTest lineBreakTest(dir, "LineBreakTest.txt");
+#endif
 
     BidiTypeLookupTester bidiTypeLookupTester(derivedBidiClass);
     CodepointSequenceTester codepointSequenceTester;
@@ -62,6 +70,9 @@ int main(int argc, const char *argv[]) {
     ScriptLookupTester scriptLookupTester(scripts, propertyValueAliases);
     AlgorithmTester algorithmTester(&bidiTest, &bidiCharacterTest, &bidiMirroring);
     ScriptLocatorTester scriptLocatorTester;
+#ifdef SB_TESTER_BREAK_CLASSIFIER
+    BreakClassifierTester breakClassifierTester(&graphemeBreakTest, &lineBreakTest);
+#endif
 
     bidiTypeLookupTester.test();
     codepointSequenceTester.test();
@@ -71,6 +82,9 @@ int main(int argc, const char *argv[]) {
     scriptLookupTester.test();
     algorithmTester.test();
     scriptLocatorTester.test();
+#ifdef SB_TESTER_BREAK_CLASSIFIER
+    breakClassifierTester.test();
+#endif
 
     return 0;
 }
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.graphics;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
+
+import android.graphics.Bitmap;
+import android.graphics.Canvas;
+import android.graphics.Color;
+
+import com.mta.tehreer.collections.FloatList;
+import com.mta.tehreer.collections.IntList;
+import com.mta.tehreer.collections.PointList;
+import com.mta.tehreer.internal.PaintProbe;
+import com.mta.tehreer.util.TypefaceStore;
+
+import org.junit.Before;
+import org.junit.Test;
+
+public class PaintGraphTest {
+    // Glyphs of PaintTest.ttf, each painting the unit square of the em held by glyph 1.
+    private static final int SQUARE = 1;
+    private static final int LINEAR = 2;
+    private static final int LAYERS = 3;
+    private static final int COMPOSITE = 4;
+    private static final int SWEEP = 5;
+    private static final int REPEAT = 6;
+
+    private static final int TYPE_SIZE = 100;
+    private static final int MARGIN = 10;
+
+    private Typeface typeface;
+
+    @Before
+    public void setUp() {
+        typeface = TypefaceStore.getPaintTest();
+    }
+
+    private String describeGraph(int glyphId) {
+        return PaintProbe.describeGraph(typeface.nativeTypeface, glyphId);
+    }
+
+    private Bitmap drawGlyph(int glyphId) {
+        int size = TYPE_SIZE + MARGIN * 2;
+        Bitmap bitmap = Bitmap.createBitmap(size, size, Bitmap.Config.ARGB_8888);
+        Canvas canvas = new Canvas(bitmap);
+        canvas.translate(MARGIN, MARGIN + TYPE_SIZE);
+
+        Renderer renderer = new Renderer();
+        renderer.setTypeface(typeface);
+        renderer.setTypeSize(TYPE_SIZE);
+        renderer.drawGlyphs(canvas, IntList.of(glyphId),
+                            PointList.of(new float[2]), FloatList.of(TYPE_SIZE));
+
+        return bitmap;
+    }
+
+    private static int pixelAt(Bitmap bitmap, int x, int y) {
+        return bitmap.getPixel(MARGIN + x, MARGIN + y);
+    }
+
+    private static void assertReddish(int color) {
+        assertTrue(Integer.toHexString(color), Color.red(color) > Color.blue(color) * 2);
+    }
+
+    private static void assertBluish(int color) {
+        assertTrue(Integer.toHexString(color), Color.blue(color) > Color.red(color) * 2);
+    }
+
+    @Test
+    public void testDecodeUnpaintedGlyph() {
+        assertNull(describeGraph(0));
+        assertNull(describeGraph(SQUARE));
+    }
+
+    @Test
+    public void testDecodeLinearGradient() {
+        assertEquals("glyph(1, linear(0 0 1000 0 0 1000; extend 0; 0:0@1 1:1@1))",
+                     describeGraph(LINEAR));
+    }
+
+    @Test
+    public void testDecodeLayersWithTranslation() {
+        assertEquals("layers(glyph(1, solid(2@1)), "
+                     + "transform(1 0 500 0 1 0, "
+                     + "glyph(1, radial(0 500 0 0 500 500; extend 0; 0:0@1 1:1@1))))",
+                     describeGraph(LAYERS));
+    }
+
+    @Test
+    public void testDecodeComposite() {
+        assertEquals("composite(5, glyph(1, solid(0@1)), glyph(1, solid(1@0.5)))",
+                     describeGraph(COMPOSITE));
+    }
+
+    @Test
+    public void testDecodeSweepGradient() {
+        // Angles are stored in half turns and decoded into degrees.
+        assertEquals("glyph(1, sweep(500 500 0 90; extend 2; 0:0@1 1:1@1))",
+                     describeGraph(SWEEP));
+    }
+
+    @Test
+    public void testDecodeRepeatingGradient() {
+        assertEquals("glyph(1, linear(250 0 500 0 250 1000; extend 1; 0:0@1 1:1@1))",
+                     describeGraph(REPEAT));
+    }
+
+    @Test
+    public void testRenderLinearGradient() {
+        Bitmap bitmap = drawGlyph(LINEAR);
+
+        // The color line runs from red on the left edge to blue on the right one.
+        assertReddish(pixelAt(bitmap, 5, 50));
+        assertBluish(pixelAt(bitmap, 95, 50));
+        assertEquals(Color.TRANSPARENT, bitmap.getPixel(MARGIN / 2, MARGIN + 50));
+    }
+
+    @Test
+    public void testRenderRepeatingGradient() {
+        Bitmap bitmap = drawGlyph(REPEAT);
+
+        // The color line spans a quarter of the em and restarts beyond both of its ends.
+        assertReddish(pixelAt(bitmap, 30, 50));
+        assertBluish(pixelAt(bitmap, 45, 50));
+        assertReddish(pixelAt(bitmap, 80, 50));
+        assertBluish(pixelAt(bitmap, 95, 50));
+    }
+
+    @Test
+    public void testRenderLayers() {
+        Bitmap bitmap = drawGlyph(LAYERS);
+
+        // The green square stays visible outside the translated radial gradient.
+        int left = pixelAt(bitmap, 25, 50);
+        assertEquals(Color.GREEN, left);
+
+        // The radial gradient turns blue towards the edge of its circle.
+        assertBluish(pixelAt(bitmap, 95, 95));
+    }
+
+    @Test
+    public void testRenderComposite() {
+        Bitmap bitmap = drawGlyph(COMPOSITE);
+        int color = pixelAt(bitmap, 50, 50);
+
+        // Source in keeps the red source within the half transparent blue backdrop.
+        assertEquals(128, Color.alpha(color), 2);
+        assertReddish(color);
+    }
+}
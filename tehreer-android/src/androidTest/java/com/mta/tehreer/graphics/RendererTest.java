@@ -20,6 +20,7 @@ import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertNull;
 
 import android.graphics.Color;
+import android.graphics.Path;
 import android.graphics.RectF;
 
 import com.mta.tehreer.collections.FloatList;
@@ -64,6 +65,57 @@ public class RendererTest {
         assertEquals(subject.getShadowColor(), Color.TRANSPARENT);
     }
 
+    private RectF computePathBounds(WritingDirection writingDirection, int glyphCount,
+                                    float yOffset, float advance) {
+        int glyphId = typeface.getGlyphId('H');
+        int[] glyphIds = new int[glyphCount];
+        float[] offsets = new float[glyphCount * 2];
+        float[] advances = new float[glyphCount];
+
+        for (int i = 0; i < glyphCount; i++) {
+            glyphIds[i] = glyphId;
+            offsets[i * 2 + 1] = yOffset;
+            advances[i] = advance;
+        }
+
+        subject.setTypeface(typeface);
+        subject.setTypeSize(typeSize);
+        subject.setWritingDirection(writingDirection);
+
+        Path path = subject.generatePath(IntList.of(glyphIds), PointList.of(offsets), FloatList.of(advances));
+        RectF bounds = new RectF();
+        path.computeBounds(bounds, true);
+
+        return bounds;
+    }
+
+    @Test
+    public void testGeneratePathAdvancesHorizontally() {
+        RectF single = computePathBounds(WritingDirection.LEFT_TO_RIGHT, 1, 0.0f, 20.0f);
+        RectF twice = computePathBounds(WritingDirection.LEFT_TO_RIGHT, 2, 0.0f, 20.0f);
+
+        assertEquals(single.width() + 20.0f, twice.width(), 0.01f);
+        assertEquals(single.height(), twice.height(), 0.01f);
+    }
+
+    @Test
+    public void testGeneratePathAdvancesVertically() {
+        RectF single = computePathBounds(WritingDirection.TOP_TO_BOTTOM, 1, 0.0f, 40.0f);
+        RectF twice = computePathBounds(WritingDirection.TOP_TO_BOTTOM, 2, 0.0f, 40.0f);
+
+        assertEquals(single.width(), twice.width(), 0.01f);
+        assertEquals(single.height() + 40.0f, twice.height(), 0.01f);
+    }
+
+    @Test
+    public void testGeneratePathRaisesPositiveYOffset() {
+        RectF plain = computePathBounds(WritingDirection.LEFT_TO_RIGHT, 1, 0.0f, 20.0f);
+        RectF raised = computePathBounds(WritingDirection.LEFT_TO_RIGHT, 1, 8.0f, 20.0f);
+
+        // Offsets point upwards like in drawing, while the path grows downwards.
+        assertEquals(plain.top - 8.0f, raised.top, 0.01f);
+    }
+
     @Test
     public void testFillColorProperty() {
         // Given
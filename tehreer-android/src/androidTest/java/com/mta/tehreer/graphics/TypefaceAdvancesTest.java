@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.graphics;
+
+import static org.junit.Assert.assertEquals;
+
+import com.mta.tehreer.util.TypefaceStore;
+
+import org.junit.Test;
+
+public class TypefaceAdvancesTest {
+    private static final float TYPE_SIZE = 24.0f;
+
+    @Test
+    public void testBatchMatchesSingleAdvances() {
+        Typeface typeface = TypefaceStore.getNafeesWeb();
+        int[] glyphIds = new int[] {
+            typeface.getGlyphId('a'), typeface.getGlyphId(0x0628), typeface.getGlyphId(0x0644), 0
+        };
+        float[] advances = new float[glyphIds.length];
+
+        typeface.getGlyphAdvances(glyphIds, TYPE_SIZE, false, advances);
+
+        for (int i = 0; i < glyphIds.length; i++) {
+            float expected = typeface.getGlyphAdvance(glyphIds[i], TYPE_SIZE, false);
+            // The single advance may be hinted to whole pixels.
+            assertEquals(expected, advances[i], 1.0f);
+        }
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testShortAdvancesArray() {
+        Typeface typeface = TypefaceStore.getNafeesWeb();
+        typeface.getGlyphAdvances(new int[2], TYPE_SIZE, false, new float[1]);
+    }
+}
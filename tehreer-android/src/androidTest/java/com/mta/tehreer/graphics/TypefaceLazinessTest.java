@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.graphics;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertTrue;
+
+import android.content.res.AssetManager;
+
+import androidx.test.platform.app.InstrumentationRegistry;
+
+import org.junit.Test;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+public class TypefaceLazinessTest {
+    private static final String[] FONT_FILES = { "NafeesWeb.ttf", "RocherColor.ttf", "Sudo.ttf" };
+
+    private static Typeface createTypeface(String fileName) {
+        AssetManager assetManager = InstrumentationRegistry.getInstrumentation().getContext().getAssets();
+        return new Typeface(assetManager, fileName);
+    }
+
+    @Test
+    public void testColorInstanceDescription() {
+        Typeface typeface = createTypeface("RocherColor.ttf");
+        int[] colors = typeface.getPredefinedPalettes().get(0).colors();
+        Typeface instance = typeface.getColorInstance(colors);
+
+        assertNotNull(instance);
+        assertEquals(typeface.getFamilyName(), instance.getFamilyName());
+        assertEquals(typeface.getStyleName(), instance.getStyleName());
+        assertEquals(typeface.getFullName(), instance.getFullName());
+        assertEquals(typeface.getWeight(), instance.getWeight());
+        assertEquals(typeface.getWidth(), instance.getWidth());
+        assertEquals(typeface.getSlope(), instance.getSlope());
+    }
+
+    @Test
+    public void testConcurrentDescription() throws Exception {
+        final Typeface typeface = createTypeface("NafeesWeb.ttf");
+        final ExecutorService executor = Executors.newFixedThreadPool(4);
+        final List<Future<String>> results = new ArrayList<>();
+
+        for (int i = 0; i < 16; i++) {
+            results.add(executor.submit(typeface::getFullName));
+        }
+
+        String expected = createTypeface("NafeesWeb.ttf").getFullName();
+        for (Future<String> result : results) {
+            assertEquals(expected, result.get());
+        }
+
+        executor.shutdown();
+    }
+
+    @Test
+    public void testRegistrationLeavesTypefacesUndescribed() {
+        final List<Typeface> typefaces = new ArrayList<>();
+
+        for (String fileName : FONT_FILES) {
+            Typeface typeface = createTypeface(fileName);
+            TypefaceManager.registerTypeface(typeface, null);
+            typefaces.add(typeface);
+
+            assertFalse(typeface.isDescribed());
+        }
+
+        for (Typeface typeface : typefaces) {
+            assertNotNull(typeface.getFullName());
+            assertTrue(typeface.isDescribed());
+
+            TypefaceManager.unregisterTypeface(typeface);
+        }
+    }
+}
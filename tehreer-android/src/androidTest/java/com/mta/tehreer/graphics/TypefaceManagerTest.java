@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.graphics;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertSame;
+import static org.junit.Assert.assertTrue;
+
+import android.content.res.AssetManager;
+
+import androidx.test.platform.app.InstrumentationRegistry;
+
+import com.mta.tehreer.util.TypefaceStore;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+public class TypefaceManagerTest {
+    private Typeface typeface;
+
+    @Before
+    public void setUp() {
+        typeface = TypefaceStore.getNafeesWeb();
+        TypefaceManager.registerTypeface(typeface, null);
+    }
+
+    @After
+    public void tearDown() {
+        TypefaceManager.unregisterTypeface(typeface);
+    }
+
+    @Test
+    public void testFamilyLookupIgnoresCase() {
+        String familyName = typeface.getFamilyName();
+        TypeFamily typeFamily = TypefaceManager.getTypeFamily(familyName.toUpperCase());
+
+        assertNotNull(typeFamily);
+        assertTrue(typeFamily.getTypefaces().contains(typeface));
+        assertSame(typeface, TypefaceManager.getTypefaceByName(typeface.getFullName().toLowerCase()));
+    }
+
+    @Test
+    public void testFamilyKeepsQueriedName() {
+        String familyName = typeface.getFamilyName().toUpperCase();
+        TypeFamily typeFamily = TypefaceManager.getTypeFamily(familyName);
+
+        assertNotNull(typeFamily);
+        assertEquals(familyName, typeFamily.getFamilyName());
+        assertSame(TypefaceManager.getTypeFamily(typeface.getFamilyName()).getTypefaces().get(0),
+                   typeFamily.getTypefaces().get(0));
+    }
+
+    @Test
+    public void testCoverageLookupDescribesOnlyMatches() {
+        AssetManager assetManager = InstrumentationRegistry.getInstrumentation().getContext().getAssets();
+        Typeface latinTypeface = new Typeface(assetManager, "Sudo.ttf");
+        TypefaceManager.registerTypeface(latinTypeface, null);
+
+        try {
+            assertFalse(latinTypeface.isDescribed());
+            assertFalse(TypefaceManager.getTypefacesForCodePoint(0x0628).contains(latinTypeface));
+            assertFalse(latinTypeface.isDescribed());
+
+            assertTrue(TypefaceManager.getAvailableTypefaces().contains(latinTypeface));
+            assertTrue(latinTypeface.isDescribed());
+        } finally {
+            TypefaceManager.unregisterTypeface(latinTypeface);
+        }
+    }
+
+    @Test
+    public void testStyleMatchIsStable() {
+        TypeFamily typeFamily = TypefaceManager.getTypeFamily(typeface.getFamilyName());
+        assertNotNull(typeFamily);
+
+        Typeface first = typeFamily.getTypefaceByStyle(TypeWidth.NORMAL, TypeWeight.BOLD, TypeSlope.ITALIC);
+        Typeface second = typeFamily.getTypefaceByStyle(TypeWidth.NORMAL, TypeWeight.BOLD, TypeSlope.ITALIC);
+
+        assertSame(first, second);
+    }
+
+    @Test
+    public void testCoverageLookup() {
+        assertTrue(TypefaceManager.getTypefacesForCodePoint(0x0628).contains(typeface));
+        assertFalse(TypefaceManager.getTypefacesForCodePoint(0xE000).contains(typeface));
+    }
+
+    @Test
+    public void testIndexIsRefreshedOnUnregister() {
+        TypefaceManager.unregisterTypeface(typeface);
+
+        try {
+            assertNull(TypefaceManager.getTypefaceByName(typeface.getFullName()));
+            assertFalse(TypefaceManager.getTypefacesForCodePoint(0x0628).contains(typeface));
+        } finally {
+            TypefaceManager.registerTypeface(typeface, null);
+        }
+    }
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.graphics;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNotEquals;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
+
+import androidx.test.platform.app.InstrumentationRegistry;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+
+public class TypefaceMetadataCacheTest {
+    private File cacheDir;
+    private File cacheFile;
+    private File fontFile;
+
+    @Before
+    public void setUp() throws IOException {
+        cacheDir = InstrumentationRegistry.getInstrumentation().getTargetContext().getCacheDir();
+        cacheFile = new File(cacheDir, "typeface-metadata.bin");
+        cacheFile.delete();
+
+        fontFile = new File(cacheDir, "Sample.ttf");
+        writeFile(fontFile, new byte[] { 0, 1, 0, 0 });
+    }
+
+    @After
+    public void tearDown() {
+        TypefaceManager.setMetadataCacheFile(null);
+        cacheFile.delete();
+        fontFile.delete();
+    }
+
+    private static void writeFile(File file, byte[] bytes) throws IOException {
+        FileOutputStream output = new FileOutputStream(file);
+        try {
+            output.write(bytes);
+        } finally {
+            output.close();
+        }
+    }
+
+    private File copyAsset(String fileName) throws IOException {
+        File file = new File(cacheDir, fileName);
+        InputStream input = InstrumentationRegistry.getInstrumentation().getContext().getAssets().open(fileName);
+        FileOutputStream output = new FileOutputStream(file);
+
+        try {
+            byte[] buffer = new byte[8192];
+            int count;
+
+            while ((count = input.read(buffer)) > 0) {
+                output.write(buffer, 0, count);
+            }
+        } finally {
+            input.close();
+            output.close();
+        }
+
+        return file;
+    }
+
+    private static TypefaceMetadataCache.Entry createEntry() {
+        return new TypefaceMetadataCache.Entry("Sample", "Bold Italic", "Sample Bold Italic",
+                                               TypeWeight.BOLD, TypeWidth.CONDENSED, TypeSlope.ITALIC);
+    }
+
+    @Test
+    public void testRoundTrip() throws IOException {
+        TypefaceMetadataCache.Key key = new TypefaceMetadataCache.Key(fontFile);
+
+        TypefaceMetadataCache cache = new TypefaceMetadataCache(cacheFile);
+        cache.put(key, createEntry());
+        cache.save();
+
+        TypefaceMetadataCache loaded = new TypefaceMetadataCache(cacheFile);
+        TypefaceMetadataCache.Entry entry = loaded.get(key);
+
+        assertNotNull(entry);
+        assertEquals("Sample", entry.familyName);
+        assertEquals("Bold Italic", entry.styleName);
+        assertEquals("Sample Bold Italic", entry.fullName);
+        assertEquals(TypeWeight.BOLD, entry.weight);
+        assertEquals(TypeWidth.CONDENSED, entry.width);
+        assertEquals(TypeSlope.ITALIC, entry.slope);
+
+        assertNull(loaded.get(new TypefaceMetadataCache.Key(key.path, key.length, key.lastModified + 1)));
+    }
+
+    @Test
+    public void testCorruptedFile() throws IOException {
+        FileOutputStream output = new FileOutputStream(cacheFile);
+        output.write(new byte[] { 'T', 'M', 'D', 'C', 0, 0, 0, 1, 0, 0, 0, 9, 0 });
+        output.close();
+
+        TypefaceMetadataCache cache = new TypefaceMetadataCache(cacheFile);
+        assertNull(cache.get(new TypefaceMetadataCache.Key("", 0, 0)));
+    }
+
+    @Test
+    public void testOversizedStringLength() throws IOException {
+        writeFile(cacheFile, new byte[] {
+            'T', 'M', 'D', 'C', 0, 0, 0, 1, 0, 0, 0, 1,
+            0x7F, (byte) 0xFF, (byte) 0xFF, (byte) 0xFF,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0
+        });
+
+        TypefaceMetadataCache cache = new TypefaceMetadataCache(cacheFile);
+        assertNull(cache.get(new TypefaceMetadataCache.Key("", 0, 0)));
+    }
+
+    @Test
+    public void testOversizedEntryCount() throws IOException {
+        writeFile(cacheFile, new byte[] {
+            'T', 'M', 'D', 'C', 0, 0, 0, 1, 0x7F, (byte) 0xFF, (byte) 0xFF, (byte) 0xFF
+        });
+
+        TypefaceMetadataCache cache = new TypefaceMetadataCache(cacheFile);
+        assertNull(cache.get(new TypefaceMetadataCache.Key("", 0, 0)));
+    }
+
+    @Test
+    public void testStaleEntriesArePruned() throws IOException {
+        TypefaceMetadataCache.Key oldKey = new TypefaceMetadataCache.Key(fontFile.getAbsolutePath(), 4, 0);
+        TypefaceMetadataCache.Key key = new TypefaceMetadataCache.Key(fontFile);
+        File removedFile = new File(cacheDir, "Removed.ttf");
+        writeFile(removedFile, new byte[] { 0, 1, 0, 0 });
+        TypefaceMetadataCache.Key removedKey = new TypefaceMetadataCache.Key(removedFile);
+
+        TypefaceMetadataCache cache = new TypefaceMetadataCache(cacheFile);
+        cache.put(oldKey, createEntry());
+        cache.put(key, createEntry());
+        cache.put(removedKey, createEntry());
+
+        // A newer version of the same file replaces the older entry.
+        assertNull(cache.get(oldKey));
+
+        assertTrue(removedFile.delete());
+        cache.save();
+
+        TypefaceMetadataCache loaded = new TypefaceMetadataCache(cacheFile);
+        assertNotNull(loaded.get(key));
+        assertNull(loaded.get(removedKey));
+    }
+
+    @Test
+    public void testCachedTypefaceOpensFileOnFirstUse() throws IOException {
+        File sudoFile = copyAsset("Sudo.ttf");
+
+        try {
+            TypefaceManager.setMetadataCacheFile(cacheFile);
+            Typeface described = new Typeface(sudoFile);
+            String fullName = described.getFullName();
+            int unitsPerEm = described.getUnitsPerEm();
+            TypefaceManager.saveMetadataCache();
+
+            TypefaceManager.setMetadataCacheFile(cacheFile);
+            Typeface typeface = new Typeface(sudoFile);
+            TypefaceManager.registerTypeface(typeface, null);
+
+            assertEquals(0, typeface.nativeTypeface);
+            assertTrue(typeface.isDescribed());
+            assertEquals(fullName, typeface.getFullName());
+            assertEquals(0, typeface.nativeTypeface);
+
+            assertEquals(unitsPerEm, typeface.getUnitsPerEm());
+            assertNotEquals(0, typeface.nativeTypeface);
+
+            TypefaceManager.unregisterTypeface(typeface);
+        } finally {
+            sudoFile.delete();
+        }
+    }
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.internal;
+
+public final class PaintProbe {
+    static {
+        TestJNI.loadLibrary();
+    }
+
+    /**
+     * Decodes the COLRv1 paint graph of a glyph afresh and describes it as nested calls, such as
+     * <code>glyph(1, solid(0@1))</code>. Returns <code>null</code> if the glyph is not painted.
+     */
+    public static native String describeGraph(long typefaceHandle, int glyphId);
+
+    private PaintProbe() {
+    }
+}
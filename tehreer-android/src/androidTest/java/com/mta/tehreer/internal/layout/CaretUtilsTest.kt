@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.internal.layout
+
+import com.mta.tehreer.collections.FloatList
+import org.junit.Assert.assertEquals
+import org.junit.Test
+import kotlin.random.Random
+
+internal class CaretUtilsTest {
+    /**
+     * The linear scan that the binary search replaced.
+     */
+    private fun scanNearestIndex(
+        caretEdges: FloatList, isRTL: Boolean,
+        firstIndex: Int, lastIndex: Int, distance: Float
+    ): Int {
+        val leftMargin = CaretUtils.getLeftMargin(caretEdges, isRTL, firstIndex, lastIndex)
+
+        var leadingIndex = -1
+        var trailingIndex = -1
+        var leadingEdge = 0.0f
+        var trailingEdge = 0.0f
+
+        var index = if (isRTL) lastIndex else firstIndex
+        val next = if (isRTL) -1 else 1
+
+        while (index in firstIndex..lastIndex) {
+            val caretEdge = caretEdges[index] - leftMargin
+
+            if (caretEdge <= distance) {
+                leadingIndex = index
+                leadingEdge = caretEdge
+            } else {
+                trailingIndex = index
+                trailingEdge = caretEdge
+                break
+            }
+
+            index += next
+        }
+
+        if (leadingIndex == -1) {
+            return firstIndex
+        }
+        if (trailingIndex == -1) {
+            return lastIndex
+        }
+
+        return if (distance <= (leadingEdge + trailingEdge) / 2.0f) leadingIndex else trailingIndex
+    }
+
+    private fun createEdges(random: Random, count: Int, isRTL: Boolean): FloatList {
+        val edges = FloatArray(count)
+        var edge = 0.0f
+
+        for (i in 0 until count) {
+            // Repeat some edges as the characters of a ligature might share them.
+            if (random.nextInt(4) != 0) {
+                edge += random.nextInt(1, 20).toFloat()
+            }
+            edges[i] = edge
+        }
+        if (isRTL) {
+            edges.reverse()
+        }
+
+        return FloatList.of(*edges)
+    }
+
+    private fun assertMatches(caretEdges: FloatList, isRTL: Boolean, firstIndex: Int, lastIndex: Int) {
+        val leftMargin = CaretUtils.getLeftMargin(caretEdges, isRTL, firstIndex, lastIndex)
+        val distances = mutableListOf(-1.0f, 0.0f, Float.MAX_VALUE)
+
+        for (i in firstIndex..lastIndex) {
+            val edge = caretEdges[i] - leftMargin
+            distances += listOf(edge, edge - 0.5f, edge + 0.5f)
+
+            if (i < lastIndex) {
+                distances.add((edge + caretEdges[i + 1] - leftMargin) / 2.0f)
+            }
+        }
+
+        for (distance in distances) {
+            val expected = scanNearestIndex(caretEdges, isRTL, firstIndex, lastIndex, distance)
+            val actual = CaretUtils.computeNearestIndex(caretEdges, isRTL, firstIndex, lastIndex, distance)
+
+            assertEquals("rtl: $isRTL, range: [$firstIndex, $lastIndex], distance: $distance", expected, actual)
+        }
+    }
+
+    @Test
+    fun computeNearestIndex_shouldMatchLinearScan() {
+        val random = Random(59)
+
+        for (isRTL in booleanArrayOf(false, true)) {
+            repeat(50) {
+                val count = random.nextInt(1, 40)
+                val edges = createEdges(random, count, isRTL)
+
+                assertMatches(edges, isRTL, 0, count - 1)
+
+                val firstIndex = random.nextInt(count)
+                val lastIndex = random.nextInt(firstIndex, count)
+                assertMatches(edges, isRTL, firstIndex, lastIndex)
+            }
+        }
+    }
+
+    @Test
+    fun computeNearestIndex_shouldSearchRTLEdgesVisually() {
+        val edges = FloatList.of(30.0f, 20.0f, 20.0f, 10.0f, 0.0f)
+
+        assertEquals(4, CaretUtils.computeNearestIndex(edges, true, 4.0f))
+        assertEquals(3, CaretUtils.computeNearestIndex(edges, true, 6.0f))
+        assertEquals(2, CaretUtils.computeNearestIndex(edges, true, 19.0f))
+        assertEquals(1, CaretUtils.computeNearestIndex(edges, true, 20.0f))
+        assertEquals(0, CaretUtils.computeNearestIndex(edges, true, 26.0f))
+
+        // Distances outside the edges resolve to the ends of the range as the scan did.
+        assertEquals(0, CaretUtils.computeNearestIndex(edges, true, -1.0f))
+        assertEquals(4, CaretUtils.computeNearestIndex(edges, true, 50.0f))
+    }
+}
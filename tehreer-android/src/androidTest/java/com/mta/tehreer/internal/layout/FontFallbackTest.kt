@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.internal.layout
+
+import com.mta.tehreer.graphics.Typeface
+import com.mta.tehreer.util.FontFileStore
+import com.mta.tehreer.util.TypefaceStore
+import org.junit.Assert.assertArrayEquals
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+
+internal class FontFallbackTest {
+    private lateinit var typefaces: Array<Typeface>
+
+    @Before
+    fun setUp() {
+        typefaces = arrayOf(
+            FontFileStore.getSudo().typefaces[0],
+            TypefaceStore.getNafeesWeb()
+        )
+    }
+
+    private fun segment(text: String): IntArray {
+        return FontFallback.segment(text, 0, text.length, typefaces)
+    }
+
+    private fun covers(typeface: Typeface, text: String): Boolean {
+        return text.all { typeface.getGlyphId(it.code) != 0 }
+    }
+
+    @Test
+    fun segment_shouldKeepCoveredTextInPrimaryTypeface() {
+        assertArrayEquals(intArrayOf(5, 0), segment("Hello"))
+    }
+
+    @Test
+    fun segment_shouldFallbackForUncoveredText() {
+        val text = "abc بت def"
+
+        // Sudo has no Arabic letters while Nafees Web has all of them.
+        assertFalse(covers(typefaces[0], "بت"))
+        assertTrue(covers(typefaces[1], "بت"))
+
+        assertArrayEquals(intArrayOf(4, 0, 6, 1, 10, 0), segment(text))
+    }
+
+    @Test
+    fun segment_shouldNotSplitGraphemeClusters() {
+        val text = "بَبُ"
+        val segments = segment(text)
+
+        for (i in segments.indices step 2) {
+            val runEnd = segments[i]
+            assertTrue(runEnd == text.length || text[runEnd] == 'ب')
+        }
+    }
+
+    @Test
+    fun segment_shouldKeepSurrogatePairsTogether() {
+        val text = "a😀b"
+        val segments = segment(text)
+
+        for (i in segments.indices step 2) {
+            val runEnd = segments[i]
+            assertTrue(runEnd != 2)
+        }
+        assertEquals(text.length, segments[segments.size - 2])
+    }
+
+    @Test
+    fun findCovering_shouldReturnIndexesOfCoveringTypefaces() {
+        assertArrayEquals(intArrayOf(1), FontFallback.findCovering(0x0628, typefaces))
+        assertArrayEquals(intArrayOf(), FontFallback.findCovering(0xE000, typefaces))
+
+        val latin = FontFallback.findCovering('a'.code, typefaces)
+        assertEquals(typefaces.filter { covers(it, "a") }.size, latin.size)
+        assertEquals(0, latin[0])
+    }
+}
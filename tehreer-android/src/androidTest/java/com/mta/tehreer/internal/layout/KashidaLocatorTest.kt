@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.internal.layout
+
+import com.mta.tehreer.util.TypefaceStore
+import org.junit.Assert.assertArrayEquals
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNotEquals
+import org.junit.Test
+
+internal class KashidaLocatorTest {
+    private fun locate(text: String, clusterMap: IntArray = IntArray(text.length) { it }): IntArray {
+        return KashidaLocator.locate(text, 0, text.length, clusterMap)
+    }
+
+    @Test
+    fun locate_shouldPickOneOpportunityPerWord() {
+        val text = "بسم الله الرحمن الرحيم"
+        val expected = intArrayOf(2, 2, 7, 3, 11, 6, 18, 6)
+
+        assertArrayEquals(expected, locate(text))
+    }
+
+    @Test
+    fun locate_shouldPreferExistingTatweel() {
+        assertArrayEquals(intArrayOf(2, 1), locate("كـتاب"))
+    }
+
+    @Test
+    fun locate_shouldPreferFinalLettersOverMedialBeh() {
+        assertArrayEquals(intArrayOf(3, 3), locate("محمد"))
+        assertArrayEquals(intArrayOf(2, 4), locate("كتاب"))
+        assertArrayEquals(intArrayOf(1, 7), locate("بيت"))
+    }
+
+    @Test
+    fun locate_shouldSkipLigatures() {
+        assertArrayEquals(intArrayOf(), locate("لا", intArrayOf(0, 0)))
+    }
+
+    @Test
+    fun locate_shouldIgnoreNonJoiningText() {
+        assertArrayEquals(intArrayOf(), locate("abc"))
+    }
+
+    @Test
+    fun locate_shouldReturnAbsoluteIndexes() {
+        val text = "abc سلام"
+        val opportunities = KashidaLocator.locate(text, 4, text.length, IntArray(4) { it })
+
+        assertArrayEquals(intArrayOf(5, 2), opportunities)
+    }
+
+    @Test
+    fun getTatweelGlyphId_shouldReturnSameGlyphForTypeface() {
+        val typeface = TypefaceStore.getNafeesWeb()
+        val glyphId = KashidaLocator.getTatweelGlyphId(typeface)
+
+        assertNotEquals(0, glyphId)
+        assertEquals(glyphId, KashidaLocator.getTatweelGlyphId(typeface))
+    }
+
+    @Test
+    fun getTatweelGlyphId_shouldReturnZeroWithoutTatweel() {
+        assertEquals(0, KashidaLocator.getTatweelGlyphId(TypefaceStore.getPaintTest()))
+    }
+}
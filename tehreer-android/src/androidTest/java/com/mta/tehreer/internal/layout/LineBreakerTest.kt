@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.internal.layout
+
+import com.mta.tehreer.unicode.BreakClassifier
+import org.junit.Assert.assertArrayEquals
+import org.junit.Before
+import org.junit.Test
+
+internal class LineBreakerTest {
+    private val text = "Hello World Again"
+
+    private lateinit var breaks: BreakClassifier
+    private lateinit var advanceSums: DoubleArray
+
+    @Before
+    fun setUp() {
+        breaks = BreakClassifier(text)
+        advanceSums = DoubleArray(text.length + 1) { it * 10.0 }
+    }
+
+    private fun breakLines(extent: Float, maxLines: Int = Int.MAX_VALUE): IntArray {
+        return LineBreaker.breakLines(
+            text, breaks.breakData, advanceSums,
+            0, text.length,
+            extent, 1,
+            extent, maxLines
+        )
+    }
+
+    @Test
+    fun breakLines_shouldHangTrailingWhitespace() {
+        assertArrayEquals(intArrayOf(6, 12, 17), breakLines(50.0f))
+    }
+
+    @Test
+    fun breakLines_shouldTakeWholeRangeIfItFits() {
+        assertArrayEquals(intArrayOf(17), breakLines(170.0f))
+    }
+
+    @Test
+    fun breakLines_shouldFallbackToCharacterBreaks() {
+        assertArrayEquals(intArrayOf(3, 6, 9, 12, 15, 17), breakLines(30.0f))
+    }
+
+    @Test
+    fun breakLines_shouldTakeAtLeastOneCharacter() {
+        assertArrayEquals(intArrayOf(1, 2, 3), breakLines(5.0f, 3))
+    }
+
+    @Test
+    fun breakLines_shouldUseLeadingExtent() {
+        val lineEnds = LineBreaker.breakLines(
+            text, breaks.breakData, advanceSums,
+            0, text.length,
+            110.0f, 1,
+            50.0f, Int.MAX_VALUE
+        )
+
+        assertArrayEquals(intArrayOf(12, 17), lineEnds)
+    }
+
+    @Test
+    fun breakLines_shouldMeasureExactlyAfterLargeOffset() {
+        // Sums that start far into a document must still resolve sub-pixel differences.
+        val offset = 1.0e7
+        val sums = DoubleArray(text.length + 1) { offset + it * 10.0 }
+        sums[text.length] -= 0.25
+
+        val lineEnds = LineBreaker.breakLines(
+            text, breaks.breakData, sums,
+            0, text.length,
+            169.8f, 1,
+            169.8f, Int.MAX_VALUE
+        )
+
+        assertArrayEquals(intArrayOf(17), lineEnds)
+    }
+
+    private fun breakParagraphOptimally(lookahead: Int, maxLines: Int = Int.MAX_VALUE): IntArray {
+        val paragraph = "aaa bb cc ddddd e ffff gg hhh iiii j kkkkk"
+        val paragraphBreaks = BreakClassifier(paragraph)
+        val paragraphSums = DoubleArray(paragraph.length + 1) { it * 10.0 }
+
+        return LineBreaker.breakLinesOptimally(
+            paragraph, paragraphBreaks.breakData, paragraphSums,
+            0, paragraph.length,
+            100.0f, 100.0f, 1,
+            100.0f, 100.0f,
+            10.0f, 25.0f, 10.0f,
+            lookahead, maxLines
+        )
+    }
+
+    @Test
+    fun breakLinesOptimally_shouldAvoidWidow() {
+        assertArrayEquals(intArrayOf(10, 18, 26, 35, 42), breakParagraphOptimally(0))
+    }
+
+    @Test
+    fun breakLinesOptimally_shouldMatchGreedyForSingleLineLookahead() {
+        assertArrayEquals(intArrayOf(10, 18, 26, 37, 42), breakParagraphOptimally(1))
+    }
+
+    @Test
+    fun breakLinesOptimally_shouldAvoidWidowWithinLookahead() {
+        assertArrayEquals(intArrayOf(10, 18, 26, 35, 42), breakParagraphOptimally(2))
+        assertArrayEquals(intArrayOf(10, 18, 26, 35, 42), breakParagraphOptimally(3))
+    }
+
+    @Test
+    fun breakLinesOptimally_shouldStopAtMaxLinesWithLookahead() {
+        assertArrayEquals(intArrayOf(10, 18), breakParagraphOptimally(2, 2))
+    }
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.layout
+
+import android.graphics.RectF
+import com.mta.tehreer.util.TypefaceStore
+import org.junit.Assert.assertArrayEquals
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Test
+import kotlin.math.max
+import kotlin.math.min
+
+/**
+ * Checks the searches of hit testing and selection against the linear scans they replaced.
+ */
+internal class HitTestingTest {
+    private val text = buildString {
+        repeat(12) {
+            append("یہ ایک مثالی جملہ ہے جس میں English words اور 123 نمبر ہیں۔ ")
+            append("A line with عربی text in between. ")
+            if (it % 4 == 3) {
+                append('\n')
+            }
+        }
+    }
+
+    private val typesetter = Typesetter(text, TypefaceStore.getNafeesWeb(), 16.0f)
+
+    private fun createFrame(lineHeightMultiplier: Float): ComposedFrame {
+        val resolver = FrameResolver()
+        resolver.setTypesetter(typesetter)
+        resolver.setFrameBounds(RectF(0.0f, 0.0f, 240.0f, Float.POSITIVE_INFINITY))
+        resolver.setLineHeightMultiplier(lineHeightMultiplier)
+
+        return resolver.createFrame(0, text.length)
+    }
+
+    private fun createLines(): List<ComposedLine> {
+        val lines = mutableListOf<ComposedLine>()
+        val places = TruncationPlace.values()
+        var charStart = 0
+
+        // Truncated lines place a token run over the characters it hides.
+        while (charStart < text.length) {
+            val charEnd = min(text.length, charStart + 90)
+
+            lines.add(typesetter.createSimpleLine(charStart, charEnd))
+            for (place in places) {
+                lines.add(typesetter.createTruncatedLine(charStart, charEnd, 150.0f, BreakMode.CHARACTER, place))
+            }
+
+            charStart = charEnd
+        }
+
+        return lines
+    }
+
+    private fun scanLineIndex(frame: ComposedFrame, y: Float): Int {
+        val lines = frame.lines
+
+        for (i in lines.indices) {
+            val top = lines[i].top
+            val bottom = top + lines[i].height
+            if (y >= top && y <= bottom) {
+                return i
+            }
+        }
+
+        return lines.size - 1
+    }
+
+    private fun scanCharDistance(line: ComposedLine, charIndex: Int): Float {
+        var distance = 0.0f
+
+        for (run in line.runs) {
+            if (charIndex >= run.charStart && charIndex < run.charEnd) {
+                distance += run.computeCharDistance(charIndex)
+                break
+            }
+
+            distance += run.width
+        }
+
+        return distance
+    }
+
+    private fun scanNearestCharIndex(line: ComposedLine, distance: Float): Int {
+        val runs = line.runs
+        var runIndex = runs.size - 1
+
+        while (runIndex > 0 && runs[runIndex].originX > distance) {
+            runIndex--
+        }
+
+        return runs[runIndex].computeNearestCharIndex(distance - runs[runIndex].originX)
+    }
+
+    private fun scanSelectionRects(frame: ComposedFrame, charStart: Int, charEnd: Int): FloatArray {
+        val rects = mutableListOf<Float>()
+        val frameWidth = frame.width
+
+        fun addParts(line: ComposedLine, start: Int, end: Int, top: Float, bottom: Float) {
+            val edges = line.computeVisualEdges(start, end)
+            for (i in edges.indices step 2) {
+                rects += listOf(max(edges[i] + line.left, 0.0f), top, min(edges[i + 1] + line.left, frameWidth), bottom)
+            }
+        }
+
+        val firstLine = frame.lines[frame.getLineIndexForChar(charStart)]
+        val lastLine = frame.lines[frame.getLineIndexForChar(charEnd - 1)]
+        val isRTL = (lastLine.paragraphLevel.toInt() and 1) == 1
+
+        if (firstLine === lastLine) {
+            addParts(firstLine, charStart, charEnd, firstLine.top, lastLine.bottom)
+        } else {
+            addParts(firstLine, charStart, firstLine.charEnd, firstLine.top, firstLine.bottom)
+            rects += if (isRTL) {
+                listOf(0.0f, firstLine.top, firstLine.left, firstLine.bottom)
+            } else {
+                listOf(firstLine.right, firstLine.top, frameWidth, firstLine.bottom)
+            }
+
+            val firstIndex = frame.lines.indexOf(firstLine)
+            val lastIndex = frame.lines.indexOf(lastLine)
+            for (i in firstIndex + 1 until lastIndex) {
+                val midLine = frame.lines[i]
+                rects += listOf(0.0f, midLine.top, frameWidth, midLine.bottom)
+            }
+
+            rects += if (isRTL) {
+                listOf(lastLine.right, lastLine.top, frameWidth, lastLine.bottom)
+            } else {
+                listOf(0.0f, lastLine.top, lastLine.left, lastLine.bottom)
+            }
+            addParts(lastLine, lastLine.charStart, charEnd, lastLine.top, lastLine.bottom)
+        }
+
+        return rects.toFloatArray()
+    }
+
+    @Test
+    fun getLineIndexForPosition_shouldMatchLinearScan() {
+        // A small multiplier makes the lines overlap each other.
+        for (multiplier in floatArrayOf(1.0f, 0.5f, 2.0f)) {
+            val frame = createFrame(multiplier)
+            val frameHeight = frame.height
+            var y = -10.0f
+
+            while (y <= frameHeight + 10.0f) {
+                assertEquals("y: $y", scanLineIndex(frame, y), frame.getLineIndexForPosition(0.0f, y))
+                y += 0.75f
+            }
+
+            for (line in frame.lines) {
+                assertEquals(scanLineIndex(frame, line.top), frame.getLineIndexForPosition(0.0f, line.top))
+                assertEquals(scanLineIndex(frame, line.bottom), frame.getLineIndexForPosition(0.0f, line.bottom))
+            }
+        }
+    }
+
+    @Test
+    fun computeCharDistance_shouldMatchLinearScan() {
+        for (line in createLines()) {
+            for (charIndex in line.charStart..line.charEnd) {
+                assertEquals("char: $charIndex", scanCharDistance(line, charIndex), line.computeCharDistance(charIndex), 0.001f)
+            }
+        }
+    }
+
+    @Test
+    fun computeNearestCharIndex_shouldMatchLinearScan() {
+        for (line in createLines()) {
+            var distance = -5.0f
+
+            while (distance <= line.width + 5.0f) {
+                assertEquals("distance: $distance", scanNearestCharIndex(line, distance), line.computeNearestCharIndex(distance))
+                distance += 0.5f
+            }
+
+            // Run boundaries are where the search changes its decision.
+            for (run in line.runs) {
+                val origin = run.originX
+                assertEquals(scanNearestCharIndex(line, origin), line.computeNearestCharIndex(origin))
+                assertEquals(scanNearestCharIndex(line, origin + run.width), line.computeNearestCharIndex(origin + run.width))
+            }
+        }
+    }
+
+    @Test
+    fun computeSelectionRects_shouldMatchLinearScan() {
+        val frame = createFrame(1.0f)
+        val ranges = listOf(
+            0 to 1, 0 to text.length, 5 to 40, 30 to 300,
+            text.length - 50 to text.length, 200 to 201
+        )
+
+        for ((charStart, charEnd) in ranges) {
+            val expected = scanSelectionRects(frame, charStart, charEnd)
+            val actual = frame.computeSelectionRects(charStart, charEnd)
+
+            assertArrayEquals("range: [$charStart, $charEnd)", expected, actual, 0.0f)
+        }
+    }
+
+    @Test
+    fun generateSelectionPath_shouldCoverSelectionRects() {
+        val frame = createFrame(1.0f)
+        val rects = frame.computeSelectionRects(10, 250)
+        val union = RectF(rects[0], rects[1], rects[2], rects[3])
+
+        for (i in rects.indices step 4) {
+            union.union(rects[i], rects[i + 1], rects[i + 2], rects[i + 3])
+        }
+
+        val bounds = RectF()
+        frame.generateSelectionPath(10, 250).computeBounds(bounds, true)
+
+        assertTrue(rects.size > 4)
+        assertEquals(union, bounds)
+    }
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.layout
+
+import android.graphics.RectF
+import android.text.SpannableString
+import android.text.Spanned
+import com.mta.tehreer.layout.style.TypeSizeSpan
+import com.mta.tehreer.layout.style.TypefaceSpan
+import com.mta.tehreer.util.TypefaceStore
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertSame
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+internal class IncrementalLayoutTest {
+    private val text = listOf(
+        "The quick brown fox jumps over the lazy dog, again and again and again.",
+        "بسم الله الرحمن الرحيم، الحمد لله رب العالمين، الرحمن الرحيم",
+        "Mixed English and عربی text with 123 numbers in between.",
+        "The last paragraph has no separator at its end."
+    ).joinToString("\n")
+
+    private fun createSpanned(text: String): Spanned {
+        val spanned = SpannableString(text)
+        spanned.setSpan(TypefaceSpan(TypefaceStore.getNafeesWeb()), 0, text.length, Spanned.SPAN_INCLUSIVE_INCLUSIVE)
+        spanned.setSpan(TypeSizeSpan(16.0f), 0, text.length, Spanned.SPAN_INCLUSIVE_INCLUSIVE)
+
+        return spanned
+    }
+
+    private fun createFrame(typesetter: Typesetter, previousFrame: ComposedFrame? = null): ComposedFrame {
+        val resolver = FrameResolver()
+        resolver.setTypesetter(typesetter)
+        resolver.setFrameBounds(RectF(0.0f, 0.0f, 180.0f, Float.POSITIVE_INFINITY))
+        resolver.setJustificationEnabled(true)
+
+        val length = typesetter.spanned.length
+
+        return if (previousFrame != null) {
+            resolver.createFrame(0, length, previousFrame)
+        } else {
+            resolver.createFrame(0, length)
+        }
+    }
+
+    private fun assertRunsEqual(expected: GlyphRun, actual: GlyphRun) {
+        assertEquals(expected.charStart, actual.charStart)
+        assertEquals(expected.charEnd, actual.charEnd)
+        assertEquals(expected.bidiLevel, actual.bidiLevel)
+        assertEquals(expected.glyphIds, actual.glyphIds)
+        assertEquals(expected.clusterMap, actual.clusterMap)
+
+        for (i in 0 until expected.glyphCount) {
+            assertEquals(expected.glyphAdvances[i], actual.glyphAdvances[i], 0.001f)
+        }
+    }
+
+    private fun assertFramesEqual(expected: ComposedFrame, actual: ComposedFrame) {
+        assertEquals(expected.charStart, actual.charStart)
+        assertEquals(expected.charEnd, actual.charEnd)
+        assertEquals(expected.lines.size, actual.lines.size)
+
+        for (i in expected.lines.indices) {
+            val expectedLine = expected.lines[i]
+            val actualLine = actual.lines[i]
+
+            assertEquals(expectedLine.charStart, actualLine.charStart)
+            assertEquals(expectedLine.charEnd, actualLine.charEnd)
+            assertEquals(expectedLine.originX, actualLine.originX, 0.001f)
+            assertEquals(expectedLine.originY, actualLine.originY, 0.001f)
+            assertEquals(expectedLine.width, actualLine.width, 0.001f)
+            assertEquals(expectedLine.runs.size, actualLine.runs.size)
+
+            for (j in expectedLine.runs.indices) {
+                assertRunsEqual(expectedLine.runs[j], actualLine.runs[j])
+            }
+        }
+    }
+
+    /**
+     * Replaces a range of the text, lays it out incrementally and checks the result against a
+     * layout of the edited text from scratch.
+     */
+    private fun edit(oldText: String, editStart: Int, oldEnd: Int, replacement: String): Typesetter {
+        val newText = oldText.substring(0, editStart) + replacement + oldText.substring(oldEnd)
+        val newEnd = editStart + replacement.length
+
+        val previous = Typesetter(createSpanned(oldText))
+        val previousFrame = createFrame(previous)
+
+        val edited = Typesetter(previous, createSpanned(newText), editStart, oldEnd, newEnd)
+        val editedFrame = createFrame(edited, previousFrame)
+
+        val fresh = Typesetter(createSpanned(newText))
+        val freshFrame = createFrame(fresh)
+
+        assertFramesEqual(freshFrame, editedFrame)
+
+        return edited
+    }
+
+    @Test
+    fun edit_shouldShapeOnlyTheEditedParagraph() {
+        val paragraphStart = text.indexOf('\n') + 1
+        val paragraphEnd = text.indexOf('\n', paragraphStart) + 1
+        val editStart = paragraphStart + 4
+
+        val typesetter = edit(text, editStart, editStart, "کتاب ")
+
+        assertEquals(paragraphStart, typesetter.shapedStart)
+        assertEquals(paragraphEnd + 5, typesetter.shapedEnd)
+        assertEquals(5, typesetter.charShift)
+    }
+
+    @Test
+    fun edit_shouldMatchFullLayoutWhenInserting() {
+        edit(text, 10, 10, "very ")
+    }
+
+    @Test
+    fun edit_shouldMatchFullLayoutWhenDeleting() {
+        edit(text, 4, 10, "")
+    }
+
+    @Test
+    fun edit_shouldMatchFullLayoutWhenJoiningParagraphs() {
+        val separator = text.indexOf('\n')
+        edit(text, separator - 3, separator + 4, "")
+    }
+
+    @Test
+    fun edit_shouldMatchFullLayoutWhenSplittingParagraph() {
+        edit(text, 20, 20, "\n")
+    }
+
+    @Test
+    fun edit_shouldMatchFullLayoutWhenJoiningCarriageReturnAndLineFeed() {
+        val crText = text.replace('\n', '\r')
+        val separator = crText.indexOf('\r')
+
+        edit(crText, separator + 1, separator + 1, "\n")
+    }
+
+    @Test
+    fun edit_shouldMatchFullLayoutAtTextBounds() {
+        edit(text, 0, 0, "Start ")
+        edit(text, text.length, text.length, " End")
+    }
+
+    @Test
+    fun edit_shouldMatchFullLayoutWhenReplacingWholeText() {
+        edit(text, 0, text.length, "Replaced\nالنص")
+    }
+
+    @Test
+    fun edit_shouldKeepLinesBeforeTheEdit() {
+        val editStart = text.lastIndexOf('\n') + 5
+
+        val previous = Typesetter(createSpanned(text))
+        val previousFrame = createFrame(previous)
+
+        val newText = text.substring(0, editStart) + "very " + text.substring(editStart)
+        val edited = Typesetter(previous, createSpanned(newText), editStart, editStart, editStart + 5)
+        val editedFrame = createFrame(edited, previousFrame)
+
+        for (i in previousFrame.lines.indices) {
+            if (previousFrame.lines[i].charEnd > editStart) {
+                break
+            }
+
+            assertSame(previousFrame.lines[i], editedFrame.lines[i])
+        }
+    }
+
+    @Test
+    fun edit_shouldMatchFullLayoutWhenResyncingLongParagraph() {
+        val longText = (1..12).joinToString(" ") { "Sentence number $it of a long paragraph." }
+
+        edit(longText, 9, 9, "extra ")
+        edit(longText, 9, 15, "")
+    }
+
+    @Test
+    fun createFrame_shouldNotJustifyLastLineOfAnyParagraph() {
+        val typesetter = Typesetter(createSpanned("Short line\u2029Another"))
+        val frame = createFrame(typesetter)
+        val simpleLine = typesetter.createSimpleLine(0, 11)
+
+        assertEquals(simpleLine.width, frame.lines[0].width, 0.001f)
+        assertTrue(frame.lines[0].width < 180.0f)
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.layout
+
+import com.mta.tehreer.internal.layout.KashidaLocator
+import com.mta.tehreer.util.TypefaceStore
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+
+class JustifiedLineTest {
+    private val typeSize = 16.0f
+    private val delta = 0.01f
+
+    private var kashidaAdvance = 0.0f
+
+    @Before
+    fun setUp() {
+        val typeface = TypefaceStore.getNafeesWeb()
+        val kashidaGlyphId = KashidaLocator.getTatweelGlyphId(typeface)
+
+        kashidaAdvance = typeface.getGlyphAdvance(kashidaGlyphId, typeSize, false)
+        assertTrue(kashidaAdvance > 0.0f)
+    }
+
+    private class Growth(val letters: Float, val spaces: FloatArray, val maxLetter: Float)
+
+    private fun measureGrowth(text: String, simple: ComposedLine, justified: ComposedLine): Growth {
+        assertEquals(simple.runs.size, justified.runs.size)
+
+        var letters = 0.0f
+        var maxLetter = 0.0f
+        val spaces = mutableListOf<Float>()
+
+        for (r in simple.runs.indices) {
+            val simpleRun = simple.runs[r]
+            val justifiedRun = justified.runs[r]
+            val spaceGlyphs = (simpleRun.charStart until simpleRun.charEnd)
+                .filter { text[it] == ' ' }
+                .map { simpleRun.getLeadingGlyphIndex(it) }
+                .toSet()
+
+            for (g in 0 until simpleRun.glyphCount) {
+                val growth = justifiedRun.glyphAdvances[g] - simpleRun.glyphAdvances[g]
+                if (g in spaceGlyphs) {
+                    spaces.add(growth)
+                } else {
+                    letters += growth
+                    maxLetter = maxOf(maxLetter, growth)
+                }
+            }
+        }
+
+        return Growth(letters, spaces.toFloatArray(), maxLetter)
+    }
+
+    private fun justify(text: String, extraWidth: Float): Growth {
+        val typesetter = Typesetter(text, TypefaceStore.getNafeesWeb(), typeSize)
+        val simple = typesetter.createSimpleLine(0, text.length)
+        val justified = typesetter.createJustifiedLine(0, text.length, 1.0f, simple.width + extraWidth)
+
+        assertEquals(simple.width + extraWidth, justified.width, delta)
+
+        return measureGrowth(text, simple, justified)
+    }
+
+    @Test
+    fun justify_shouldElongateLettersBeforeSpaces() {
+        val growth = justify("بسم الله الرحمن الرحيم", kashidaAdvance)
+
+        assertEquals(kashidaAdvance, growth.letters, delta)
+        for (space in growth.spaces) {
+            assertEquals(0.0f, space, delta)
+        }
+    }
+
+    @Test
+    fun justify_shouldLimitKashidasAndWidenSpaces() {
+        val growth = justify("بسم الله الرحمن الرحيم", kashidaAdvance * 100)
+
+        assertTrue(growth.maxLetter <= kashidaAdvance * 3 + delta)
+        assertTrue(growth.letters > 0.0f)
+
+        val spaceGrowth = growth.spaces[0]
+        assertTrue(spaceGrowth > 0.0f)
+        for (space in growth.spaces) {
+            assertEquals(spaceGrowth, space, delta)
+        }
+    }
+
+    @Test
+    fun justify_shouldOnlyWidenSpacesOfNonJoiningText() {
+        val growth = justify("abc def ghi", 20.0f)
+
+        assertEquals(0.0f, growth.letters, delta)
+        for (space in growth.spaces) {
+            assertEquals(10.0f, space, delta)
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.layout
+
+import android.graphics.RectF
+import android.text.SpannableString
+import com.mta.tehreer.layout.style.TypeSizeSpan
+import com.mta.tehreer.layout.style.TypefaceSpan
+import com.mta.tehreer.sfnt.WritingDirection
+import com.mta.tehreer.util.TypefaceStore
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+internal class VerticalFrameTest {
+    private val text = "A column of text that needs a few columns to fit in the frame."
+    private val frameWidth = 200.0f
+    private val frameHeight = 150.0f
+
+    private fun createTypesetter(writingMode: WritingMode): Typesetter {
+        val spans = listOf<Any>(TypefaceSpan(TypefaceStore.getNafeesWeb()), TypeSizeSpan(16.0f))
+        return Typesetter(SpannableString(text), spans, writingMode)
+    }
+
+    private fun createFrame(typesetter: Typesetter): ComposedFrame {
+        val resolver = FrameResolver()
+        resolver.setTypesetter(typesetter)
+        resolver.setFrameBounds(RectF(0.0f, 0.0f, frameWidth, frameHeight))
+
+        return resolver.createFrame(0, text.length)
+    }
+
+    @Test
+    fun frame_shouldBreakColumnsAlongFrameHeight() {
+        val frame = createFrame(createTypesetter(WritingMode.VERTICAL))
+
+        assertTrue(frame.isVertical)
+        assertEquals(frameWidth, frame.width, 0.0f)
+        assertEquals(frameHeight, frame.height, 0.0f)
+        assertTrue(frame.lines.size > 1)
+
+        for (line in frame.lines) {
+            assertTrue(line.width - line.trailingWhitespaceExtent <= frameHeight)
+
+            for (run in line.runs) {
+                assertEquals(WritingDirection.TOP_TO_BOTTOM, run.writingDirection)
+            }
+        }
+    }
+
+    @Test
+    fun frame_shouldPlaceColumnsFromRightToLeft() {
+        val frame = createFrame(createTypesetter(WritingMode.VERTICAL))
+        val secondLine = frame.lines[1]
+        val secondCenter = frameWidth - (secondLine.top + secondLine.bottom) / 2.0f
+
+        assertEquals(0, frame.getLineIndexForPosition(frameWidth - 1.0f, 0.0f))
+        assertEquals(1, frame.getLineIndexForPosition(secondCenter, 0.0f))
+    }
+
+    @Test
+    fun selection_shouldCoverColumnsInFrameCoordinates() {
+        val frame = createFrame(createTypesetter(WritingMode.VERTICAL))
+        val firstLine = frame.lines[0]
+        val rects = frame.computeSelectionRects(firstLine.charStart, firstLine.charEnd)
+
+        for (i in rects.indices step 4) {
+            assertEquals(frameWidth - firstLine.bottom, rects[i], 0.001f)
+            assertEquals(frameWidth - firstLine.top, rects[i + 2], 0.001f)
+            assertTrue(rects[i + 1] >= 0.0f && rects[i + 3] <= frameHeight)
+        }
+    }
+
+    @Test
+    fun typesetter_shouldKeepWritingModeAcrossEdits() {
+        val previous = createTypesetter(WritingMode.VERTICAL)
+        val edited = SpannableString(text.replaceFirst("few", "couple of"))
+        val typesetter = Typesetter(previous, edited, 30, 33, 39)
+
+        assertEquals(WritingMode.VERTICAL, typesetter.writingMode)
+        assertFalse(createFrame(createTypesetter(WritingMode.HORIZONTAL)).isVertical)
+    }
+}
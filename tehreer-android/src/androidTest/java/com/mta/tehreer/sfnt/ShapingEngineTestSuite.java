@@ -299,6 +299,27 @@ public abstract class ShapingEngineTestSuite extends DisposableTestSuite<Shaping
         });
     }
 
+    @Test
+    public void testShapeTextForVerticalDirection() {
+        typeface = TypefaceStore.getNafeesWeb();
+
+        buildSubject((subject) -> {
+            // Given
+            subject.setWritingDirection(WritingDirection.TOP_TO_BOTTOM);
+
+            // When
+            ShapingResult result = subject.shapeText(text, 0, text.length());
+
+            // Then
+            assertTrue(result.isVertical());
+            assertTrue(result.getGlyphCount() > 0);
+
+            for (int i = 0; i < result.getGlyphCount(); i++) {
+                assertTrue(result.getGlyphAdvances().get(i) >= 0.0f);
+            }
+        });
+    }
+
     @Test
     public void testToString() {
         buildSubject((subject) -> {
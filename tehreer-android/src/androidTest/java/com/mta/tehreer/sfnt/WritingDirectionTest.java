@@ -24,18 +24,21 @@ import org.junit.Test;
 public class WritingDirectionTest {
     private static final int LEFT_TO_RIGHT = 0;
     private static final int RIGHT_TO_LEFT = 1;
-    private static final int LIMIT = 2;
+    private static final int TOP_TO_BOTTOM = 2;
+    private static final int LIMIT = 3;
 
     @Test
     public void testValues() {
         assertEquals(WritingDirection.LEFT_TO_RIGHT.value, LEFT_TO_RIGHT);
         assertEquals(WritingDirection.RIGHT_TO_LEFT.value, RIGHT_TO_LEFT);
+        assertEquals(WritingDirection.TOP_TO_BOTTOM.value, TOP_TO_BOTTOM);
     }
 
     @Test
     public void testValueOf() {
         assertEquals(WritingDirection.valueOf(LEFT_TO_RIGHT), WritingDirection.LEFT_TO_RIGHT);
         assertEquals(WritingDirection.valueOf(RIGHT_TO_LEFT), WritingDirection.RIGHT_TO_LEFT);
+        assertEquals(WritingDirection.valueOf(TOP_TO_BOTTOM), WritingDirection.TOP_TO_BOTTOM);
         assertNull(WritingDirection.valueOf(LIMIT));
     }
 }
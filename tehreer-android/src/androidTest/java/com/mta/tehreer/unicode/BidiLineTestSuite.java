@@ -172,6 +172,23 @@ public abstract class BidiLineTestSuite extends DisposableTestSuite<BidiLine, Bi
         });
     }
 
+    @Test
+    public void testGetVisualRunArray() {
+        buildSubject((subject) -> {
+            // When
+            int[] runArray = subject.getVisualRunArray();
+
+            // Then
+            assertEquals(runArray.length, DEFAULT_VISUAL_RUNS.length * 3);
+
+            for (int i = 0; i < DEFAULT_VISUAL_RUNS.length; i++) {
+                assertEquals(runArray[i * 3], DEFAULT_VISUAL_RUNS[i].charStart);
+                assertEquals(runArray[i * 3 + 1], DEFAULT_VISUAL_RUNS[i].charEnd);
+                assertEquals(runArray[i * 3 + 2], DEFAULT_VISUAL_RUNS[i].embeddingLevel);
+            }
+        });
+    }
+
     @Test
     public void testGetMirroringPairs() {
         buildSubject((subject) -> {
@@ -16,6 +16,7 @@
 
 package com.mta.tehreer.unicode;
 
+import static org.junit.Assert.assertArrayEquals;
 import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertNotEquals;
 import static org.junit.Assert.assertNotNull;
@@ -93,4 +94,16 @@ public class BidiMirrorLocatorTest {
             assertNull(pair);
         }
     }
+
+    @Test
+    public void testAllPairs() {
+        subject.loadLine(bidiLine);
+
+        // When
+        int[] pairs = subject.allPairs();
+
+        // Then
+        assertArrayEquals(pairs, new int[] { 11, ')', '(', 7, '(', ')' });
+        assertNull(subject.nextPair());
+    }
 }
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.unicode;
+
+import static org.junit.Assert.assertEquals;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+public class BidiParagraphConcurrencyTest {
+    private static final String[] PIECES = {
+        "abc ", "אבג ", "(اب[12]) ", "‫x‬ ", "⁧א⁩ "
+    };
+    private static final int LINE_STEP = 7;
+    private static final int THREAD_COUNT = 8;
+    private static final int ROUND_COUNT = 5;
+
+    private BidiAlgorithm algorithm;
+    private List<BidiParagraph> paragraphs;
+
+    @Before
+    public void setUp() {
+        StringBuilder builder = new StringBuilder();
+        for (int i = 0; i < 2000; i++) {
+            builder.append(PIECES[i % PIECES.length]);
+            if (i % 97 == 0) {
+                builder.append('\n');
+            }
+        }
+
+        String text = builder.toString();
+        algorithm = new BidiAlgorithm(text);
+        paragraphs = new ArrayList<>();
+
+        int charStart = 0;
+        while (charStart != text.length()) {
+            BidiParagraph paragraph = algorithm.createParagraph(charStart, text.length(),
+                                                                BaseDirection.DEFAULT_LEFT_TO_RIGHT);
+            paragraphs.add(paragraph);
+            charStart = paragraph.getCharEnd();
+        }
+    }
+
+    @After
+    public void tearDown() {
+        for (BidiParagraph paragraph : paragraphs) {
+            paragraph.dispose();
+        }
+        algorithm.dispose();
+    }
+
+    private List<String> describeLines() {
+        List<String> descriptions = new ArrayList<>();
+
+        for (BidiParagraph paragraph : paragraphs) {
+            int charEnd = paragraph.getCharEnd();
+
+            for (int charStart = paragraph.getCharStart(); charStart < charEnd; charStart += LINE_STEP) {
+                BidiLine line = paragraph.createLine(charStart, charEnd);
+                descriptions.add(line.getVisualRuns().toString());
+                line.dispose();
+            }
+        }
+
+        return descriptions;
+    }
+
+    @Test
+    public void testConcurrentLinesOfSharedParagraphs() throws Exception {
+        // Layout tasks of a text container may create lines of the same paragraphs in parallel.
+        List<String> expected = describeLines();
+        ExecutorService executor = Executors.newFixedThreadPool(THREAD_COUNT);
+
+        try {
+            List<Future<List<String>>> futures = new ArrayList<>();
+
+            for (int i = 0; i < THREAD_COUNT * ROUND_COUNT; i++) {
+                futures.add(executor.submit(this::describeLines));
+            }
+
+            for (Future<List<String>> future : futures) {
+                assertEquals(expected, future.get());
+            }
+        } finally {
+            executor.shutdown();
+        }
+    }
+}
@@ -72,4 +72,27 @@ internal class BreakClassifierTest {
         assertEquals(2, iterator.nextInt())
         assertFalse(iterator.hasNext())
     }
+
+    @Test
+    fun classify_shouldTreatRangeBoundsAsTextBounds() {
+        subject.classify(0, 3)
+
+        val iterator = subject.getForwardLineBreaks(0, 9)
+
+        assertEquals(3, iterator.nextInt())
+        assertEquals(6, iterator.nextInt())
+        assertEquals(9, iterator.nextInt())
+        assertFalse(iterator.hasNext())
+    }
+
+    @Test
+    fun getForwardGraphemeBreaks_shouldKeepEmojiSequencesTogether() {
+        val classifier = BreakClassifier("a\uD83D\uDC69\u200D\uD83D\uDCBBb")
+        val iterator = classifier.getForwardGraphemeBreaks(0, 7)
+
+        assertEquals(1, iterator.nextInt())
+        assertEquals(6, iterator.nextInt())
+        assertEquals(7, iterator.nextInt())
+        assertFalse(iterator.hasNext())
+    }
 }
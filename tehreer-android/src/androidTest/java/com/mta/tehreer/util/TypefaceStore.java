@@ -28,6 +28,7 @@ import java.io.InputStream;
 
 public final class TypefaceStore {
     private static Typeface nafeesWeb;
+    private static Typeface paintTest;
 
     public static Typeface getNafeesWeb() {
         if (nafeesWeb == null) {
@@ -44,5 +45,20 @@ public final class TypefaceStore {
         return nafeesWeb;
     }
 
+    public static Typeface getPaintTest() {
+        if (paintTest == null) {
+            try {
+                Context context = InstrumentationRegistry.getInstrumentation().getContext();
+                AssetManager assetManager = context.getAssets();
+                InputStream stream = assetManager.open("PaintTest.ttf");
+                paintTest = new Typeface(stream);
+            } catch (IOException e) {
+                e.printStackTrace();
+            }
+        }
+
+        return paintTest;
+    }
+
     private TypefaceStore() { }
 }
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.widget
+
+import android.graphics.RectF
+import android.os.Bundle
+import android.os.SystemClock
+import androidx.test.platform.app.InstrumentationRegistry
+import com.mta.tehreer.layout.ComposedFrame
+import com.mta.tehreer.layout.FrameResolver
+import com.mta.tehreer.layout.Typesetter
+import com.mta.tehreer.util.TypefaceStore
+import org.junit.Assert.assertEquals
+import org.junit.Test
+
+/**
+ * Measures how long a block takes to be composed again at a new width when its shaped text is
+ * kept, against shaping it from scratch. The results are reported as instrumentation status.
+ */
+internal class TextBlockRewrapBenchmark {
+    private val text = buildString {
+        repeat(200) {
+            append("یہ ایک مثالی جملہ ہے جو سطروں میں تقسیم ہو گا۔ ")
+            append("The quick brown fox jumps over the lazy dog. ")
+            if (it % 10 == 9) {
+                append('\n')
+            }
+        }
+    }
+
+    private val widths = intArrayOf(240, 360, 480, 720, 1080)
+
+    private fun createTypesetter(): Typesetter {
+        return Typesetter(text, TypefaceStore.getNafeesWeb(), 16.0f)
+    }
+
+    private fun createFrame(typesetter: Typesetter, width: Int): ComposedFrame {
+        val resolver = FrameResolver()
+        resolver.setTypesetter(typesetter)
+        resolver.setFrameBounds(RectF(0.0f, 0.0f, width.toFloat(), Float.POSITIVE_INFINITY))
+
+        return resolver.createFrame(0, text.length)
+    }
+
+    private inline fun measureMinNanos(block: () -> Unit): Long {
+        var minTime = Long.MAX_VALUE
+
+        for (i in 0 until REPEAT_COUNT) {
+            val startTime = SystemClock.elapsedRealtimeNanos()
+            block()
+            minTime = minOf(minTime, SystemClock.elapsedRealtimeNanos() - startTime)
+        }
+
+        return minTime
+    }
+
+    @Test
+    fun benchmarkRewrap() {
+        val typesetter = createTypesetter()
+        val results = Bundle()
+
+        // Warm up both paths so that the first width is not penalized.
+        createFrame(typesetter, widths[0])
+        createFrame(createTypesetter(), widths[0])
+
+        for (width in widths) {
+            val blocks = mutableListOf(TextBlock(0, text.length, 0.0f))
+            var frame: ComposedFrame? = null
+
+            val rewrapTime = measureMinNanos {
+                blocks.rewrapBlocks(widths[0], width)
+                frame = createFrame(typesetter, width)
+            }
+            val relayoutTime = measureMinNanos {
+                createFrame(createTypesetter(), width)
+            }
+
+            assertEquals(text.length, frame!!.charEnd)
+
+            results.putLong("rewrap_${width}_us", rewrapTime / 1000)
+            results.putLong("relayout_${width}_us", relayoutTime / 1000)
+        }
+
+        InstrumentationRegistry.getInstrumentation().sendStatus(0, results)
+    }
+
+    companion object {
+        private const val REPEAT_COUNT = 5
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.widget
+
+import android.graphics.RectF
+import com.mta.tehreer.layout.ComposedFrame
+import com.mta.tehreer.layout.FrameResolver
+import com.mta.tehreer.layout.Typesetter
+import com.mta.tehreer.util.TypefaceStore
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertNull
+import org.junit.Assert.assertSame
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+internal class TextBlockRewrapTest {
+    private val text = buildString {
+        repeat(40) {
+            append("یہ ایک مثالی جملہ ہے جو سطروں میں تقسیم ہو گا۔ ")
+            append("The quick brown fox jumps over the lazy dog. ")
+            if (it % 10 == 9) {
+                append('\n')
+            }
+        }
+    }
+
+    private fun createTypesetter(): Typesetter {
+        return Typesetter(text, TypefaceStore.getNafeesWeb(), 16.0f)
+    }
+
+    private fun createFrame(typesetter: Typesetter, width: Int): ComposedFrame {
+        val resolver = FrameResolver()
+        resolver.setTypesetter(typesetter)
+        resolver.setFrameBounds(RectF(0.0f, 0.0f, width.toFloat(), Float.POSITIVE_INFINITY))
+
+        return resolver.createFrame(0, text.length)
+    }
+
+    private fun createComposedBlock(width: Int): TextBlock {
+        val typesetter = createTypesetter()
+        val frame = createFrame(typesetter, width)
+
+        return TextBlock(0, text.length, frame.height).apply {
+            this.typesetter = typesetter
+            this.frame = frame
+            this.lineBoxes = emptyList()
+            this.isMeasured = true
+        }
+    }
+
+    @Test
+    fun rewrapBlocks_shouldScaleHeightsInverselyToWidth() {
+        val blocks = mutableListOf(TextBlock(0, 10, 100.0f), TextBlock(10, 20, 50.0f))
+        blocks.arrangeBlocks(0)
+        blocks.rewrapBlocks(200, 400)
+
+        assertEquals(50.0f, blocks[0].height, 0.0f)
+        assertEquals(25.0f, blocks[1].height, 0.0f)
+        assertEquals(0.0f, blocks[0].top, 0.0f)
+        assertEquals(50.0f, blocks[1].top, 0.0f)
+        assertEquals(75.0f, blocks[1].bottom, 0.0f)
+    }
+
+    @Test
+    fun rewrapBlocks_shouldKeepHeightsForUnknownWidth() {
+        val blocks = mutableListOf(TextBlock(0, 10, 100.0f), TextBlock(10, 20, 50.0f))
+        blocks.rewrapBlocks(0, 400)
+
+        assertEquals(100.0f, blocks[0].height, 0.0f)
+        assertEquals(100.0f, blocks[1].top, 0.0f)
+
+        blocks.rewrapBlocks(400, 0)
+
+        assertEquals(50.0f, blocks[1].height, 0.0f)
+    }
+
+    @Test
+    fun rewrapBlocks_shouldKeepShapedTextAndDropLines() {
+        val block = createComposedBlock(360)
+        val typesetter = block.typesetter
+        val blocks = mutableListOf(block)
+        blocks.rewrapBlocks(360, 720)
+
+        assertSame(typesetter, block.typesetter)
+        assertNull(block.frame)
+        assertNull(block.lineBoxes)
+        assertFalse(block.isMeasured)
+        assertFalse(block.isComposed)
+        assertTrue(block.isResident)
+    }
+
+    @Test
+    fun rewrapBlocks_shouldEstimateHeightCloseToComposedOne() {
+        val block = createComposedBlock(360)
+        val blocks = mutableListOf(block)
+        blocks.rewrapBlocks(360, 720)
+
+        val actual = createFrame(block.typesetter!!, 720).height
+
+        // The estimate should at least be of the right magnitude for scrolling to settle quickly.
+        assertEquals(actual, block.height, actual * 0.5f)
+    }
+
+    @Test
+    fun rewrapBlocks_shouldComposeKeptTypesetterLikeFreshOne() {
+        for (width in intArrayOf(360, 480, 720, 1080)) {
+            // Each width starts from its own block so that the rewraps do not build on each other.
+            val block = createComposedBlock(240)
+            val blocks = mutableListOf(block)
+            blocks.rewrapBlocks(240, width)
+
+            val reused = createFrame(block.typesetter!!, width)
+            val fresh = createFrame(createTypesetter(), width)
+
+            assertEquals(fresh.lines.size, reused.lines.size)
+
+            for (i in fresh.lines.indices) {
+                assertEquals(fresh.lines[i].charStart, reused.lines[i].charStart)
+                assertEquals(fresh.lines[i].charEnd, reused.lines[i].charEnd)
+                assertEquals(fresh.lines[i].width, reused.lines[i].width, 0.0f)
+            }
+            assertEquals(fresh.height, reused.height, 0.0f)
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.widget
+
+import org.junit.Assert.assertArrayEquals
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertTrue
+import org.junit.Test
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.atomic.AtomicIntegerArray
+import kotlin.concurrent.thread
+
+internal class TextBlockTest {
+    private fun rangesOf(blocks: List<TextBlock>): IntArray {
+        return blocks.flatMap { listOf(it.charStart, it.charEnd) }.toIntArray()
+    }
+
+    @Test
+    fun splitTextBlocks_shouldSplitOnAllParagraphSeparators() {
+        val text = "a\nb\rc\r\nd\u2029e\u0085f\u001Cg"
+        val blocks = splitTextBlocks(text, 1, 80.0f, 10.0f)
+        val expected = intArrayOf(0, 2, 2, 4, 4, 7, 7, 9, 9, 11, 11, 13, 13, 14)
+
+        assertArrayEquals(expected, rangesOf(blocks))
+    }
+
+    @Test
+    fun splitTextBlocks_shouldKeepParagraphsTogetherUntilBlockLength() {
+        val text = "aaaa\nbb\ncc"
+        val blocks = splitTextBlocks(text, 5, 80.0f, 10.0f)
+
+        assertArrayEquals(intArrayOf(0, 5, 5, 10), rangesOf(blocks))
+    }
+
+    @Test
+    fun splitTextBlocks_shouldEstimateHeightFromLineCount() {
+        val text = "aaaa\rb"
+        val blocks = splitTextBlocks(text, 1, 2.0f, 10.0f)
+
+        assertEquals(2, blocks.size)
+        assertEquals(30.0f, blocks[0].height, 0.0f)
+        assertEquals(10.0f, blocks[1].height, 0.0f)
+    }
+
+    @Test
+    fun searchBlockIndex_shouldFindArrangedBlocks() {
+        val blocks = mutableListOf(TextBlock(0, 1, 10.0f), TextBlock(1, 2, 20.0f), TextBlock(2, 3, 5.0f))
+        blocks.arrangeBlocks(0)
+
+        assertEquals(30.0f, blocks[2].top, 0.0f)
+        assertEquals(0, blocks.searchBlockIndex(-4.0f))
+        assertEquals(0, blocks.searchBlockIndex(9.9f))
+        assertEquals(1, blocks.searchBlockIndex(10.0f))
+        assertEquals(2, blocks.searchBlockIndex(34.0f))
+        assertEquals(2, blocks.searchBlockIndex(100.0f))
+    }
+
+    @Test
+    fun claim_shouldTakeUpEachBlockOnce() {
+        val measurement = BlockMeasurement(2)
+
+        assertTrue(measurement.claim(1))
+        assertFalse(measurement.claim(1))
+        assertTrue(measurement.claim(0))
+    }
+
+    @Test
+    fun claim_shouldHandOutEachBlockToOneTask() {
+        val blockCount = 4096
+        val measurement = BlockMeasurement(blockCount)
+        val winners = AtomicIntegerArray(blockCount)
+        val startSignal = CountDownLatch(1)
+
+        // Simulate a cancelled task racing against the one that replaced it.
+        val workers = (0 until 4).map {
+            thread {
+                startSignal.await()
+                for (i in 0 until blockCount) {
+                    if (measurement.claim(i)) {
+                        winners.incrementAndGet(i)
+                    }
+                }
+            }
+        }
+        startSignal.countDown()
+        workers.forEach { it.join() }
+
+        for (i in 0 until blockCount) {
+            assertEquals(1, winners.get(i))
+        }
+    }
+}
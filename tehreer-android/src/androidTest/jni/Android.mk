@@ -12,6 +12,7 @@ LOCAL_MODULE := testjni
 
 FILE_LIST := \
     Memory.cpp \
+    PaintProbe.cpp \
     Test.cpp
 
 LOCAL_C_INCLUDES := $(FT_HEADERS_PATH) $(SB_HEADERS_PATH) $(SF_HEADERS_PATH) $(MAIN_PATH)
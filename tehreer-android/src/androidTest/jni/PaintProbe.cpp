@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstdint>
+#include <cstdio>
+#include <jni.h>
+#include <string>
+
+#include "JavaBridge.h"
+#include "PaintGraph.h"
+#include "PaintProbe.h"
+#include "Typeface.h"
+
+using namespace std;
+using namespace Tehreer;
+
+static string formatValues(const float *values, int count)
+{
+    string text;
+    char buffer[32];
+
+    for (int i = 0; i < count; i++) {
+        snprintf(buffer, sizeof(buffer), i == 0 ? "%g" : " %g", values[i]);
+        text += buffer;
+    }
+
+    return text;
+}
+
+static string describeColor(const PaintGraph::Color &color)
+{
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%u@%g", color.paletteIndex, color.alpha);
+
+    return buffer;
+}
+
+static string describeNode(const PaintGraph &graph, int32_t index)
+{
+    if (index < 0) {
+        return "none";
+    }
+
+    const PaintGraph::Node &node = graph.nodeAt(index);
+    string text;
+
+    switch (node.kind) {
+    case PaintGraph::LAYERS:
+        text = "layers(";
+        for (int32_t i = 0; i < node.second; i++) {
+            text += (i == 0 ? "" : ", ") + describeNode(graph, graph.layerAt(node.first + i));
+        }
+        return text + ")";
+
+    case PaintGraph::SOLID:
+        return "solid(" + describeColor(node.color) + ")";
+
+    case PaintGraph::LINEAR_GRADIENT:
+    case PaintGraph::RADIAL_GRADIENT:
+    case PaintGraph::SWEEP_GRADIENT: {
+        const char *names[] = { "linear(", "radial(", "sweep(" };
+        int count = (node.kind == PaintGraph::SWEEP_GRADIENT ? 4 : 6);
+
+        text = names[node.kind - PaintGraph::LINEAR_GRADIENT] + formatValues(node.values, count);
+        text += "; extend " + to_string(node.extend) + ";";
+
+        for (int32_t i = 0; i < node.second; i++) {
+            const PaintGraph::Stop &stop = graph.stopAt(node.first + i);
+            text += " " + formatValues(&stop.offset, 1) + ":" + describeColor(stop.color);
+        }
+        return text + ")";
+    }
+
+    case PaintGraph::GLYPH:
+        return "glyph(" + to_string(node.glyphID) + ", " + describeNode(graph, node.first) + ")";
+
+    case PaintGraph::TRANSFORM:
+        return "transform(" + formatValues(node.values, 6) + ", " + describeNode(graph, node.first) + ")";
+
+    case PaintGraph::COMPOSITE:
+        return "composite(" + to_string(node.mode) + ", " + describeNode(graph, node.first)
+               + ", " + describeNode(graph, node.second) + ")";
+
+    default:
+        return "unknown";
+    }
+}
+
+static jstring describeGraph(JNIEnv *env, jobject obj, jlong typefaceHandle, jint glyphID)
+{
+    Typeface *typeface = reinterpret_cast<Typeface *>(typefaceHandle);
+    typeface->lock();
+
+    /* A freshly decoded graph makes sure that the decoder is exercised rather than the cache. */
+    PaintGraph *paintGraph = PaintGraph::decode(typeface->ftFace(), static_cast<FT_UInt>(glyphID));
+    typeface->unlock();
+
+    if (!paintGraph) {
+        return nullptr;
+    }
+
+    string description = describeNode(*paintGraph, paintGraph->root());
+    delete paintGraph;
+
+    return env->NewStringUTF(description.c_str());
+}
+
+static JNINativeMethod JNI_METHODS[] = {
+    { "describeGraph", "(JI)Ljava/lang/String;", (void *)describeGraph },
+};
+
+jint register_com_mta_tehreer_internal_PaintProbe(JNIEnv *env)
+{
+    return JavaBridge::registerClass(env, "com/mta/tehreer/internal/PaintProbe", JNI_METHODS, sizeof(JNI_METHODS) / sizeof(JNI_METHODS[0]));
+}
@@ -28,7 +28,8 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *jvm, void *reserved) {
         return JNI_ERR;
     }
 
-    result = register_com_mta_tehreer_internal_Memory(env) == JNI_OK;
+    result = register_com_mta_tehreer_internal_Memory(env) == JNI_OK
+          && register_com_mta_tehreer_internal_PaintProbe(env) == JNI_OK;
 
     if (!result) {
         return JNI_ERR;
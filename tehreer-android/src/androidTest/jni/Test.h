@@ -18,5 +18,6 @@
 #define _TEST_H
 
 #include "Memory.h"
+#include "PaintProbe.h"
 
 #endif
@@ -31,5 +31,6 @@ internal class Glyph {
         const val TYPE_MASK = 0x0001
         const val TYPE_COLOR = 0x0002
         const val TYPE_MIXED = 0x0003
+        const val TYPE_PAINTED = 0x0004
     }
 }
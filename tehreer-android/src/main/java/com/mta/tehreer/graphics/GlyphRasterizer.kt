@@ -27,7 +27,7 @@ internal class GlyphRasterizer(key: GlyphKey) : Disposable {
 
     init {
         nativeRasterizer = nCreate(
-            key.typeface!!.nativeTypeface,
+            key.typeface!!.loadNativeTypeface(),
             key.pixelWidth, key.pixelHeight,
             0x10000, -key.skewX, 0, 0x10000
         )
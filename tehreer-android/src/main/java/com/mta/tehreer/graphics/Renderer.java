@@ -462,7 +462,8 @@ public class Renderer {
     }
 
     /**
-     * Generates a cumulative path of specified glyphs.
+     * Generates a cumulative path of specified glyphs. The glyphs are placed downwards if the
+     * writing direction is top to bottom.
      *
      * @param glyphIds The list containing the glyph IDs.
      * @param offsets The list containing the glyph offsets.
@@ -472,7 +473,9 @@ public class Renderer {
     public @NonNull Path generatePath(@NonNull IntList glyphIds,
                                       @NonNull PointList offsets, @NonNull FloatList advances) {
         Path cumulativePath = new Path();
+        boolean verticalMode = (mWritingDirection == WritingDirection.TOP_TO_BOTTOM);
         float penX = 0.0f;
+        float penY = 0.0f;
 
         int size = glyphIds.size();
 
@@ -483,9 +486,13 @@ public class Renderer {
             float advance = advances.get(i);
 
             Path glyphPath = getGlyphPath(glyphId);
-            cumulativePath.addPath(glyphPath, penX + xOffset, yOffset);
+            cumulativePath.addPath(glyphPath, penX + xOffset, penY - yOffset);
 
-            penX += advance;
+            if (verticalMode) {
+                penY += advance;
+            } else {
+                penX += advance;
+            }
         }
 
         return cumulativePath;
@@ -527,8 +534,10 @@ public class Renderer {
                                          Float.NEGATIVE_INFINITY, Float.NEGATIVE_INFINITY);
 
         boolean reverseMode = (mWritingDirection == WritingDirection.RIGHT_TO_LEFT);
+        boolean verticalMode = (mWritingDirection == WritingDirection.TOP_TO_BOTTOM);
         float totalAdvance = 0.0f;
         float penX = 0.0f;
+        float penY = 0.0f;
 
         int size = glyphIds.size();
 
@@ -548,11 +557,13 @@ public class Renderer {
             float height = glyphBBox.height();
 
             int left = (int) (penX + xOffset + glyphBBox.left + 0.5f);
-            int top = (int) (-yOffset - glyphBBox.top + 0.5f);
+            int top = (int) (penY - yOffset - glyphBBox.top + 0.5f);
 
             cumulativeBBox.union(left, top, left + width, top + height);
 
-            if (!reverseMode) {
+            if (verticalMode) {
+                penY += advance;
+            } else if (!reverseMode) {
                 penX += advance;
             }
 
@@ -571,7 +582,9 @@ public class Renderer {
                             boolean strokeMode) {
         GlyphCache cache = GlyphCache.getInstance();
         boolean reverseMode = (mWritingDirection == WritingDirection.RIGHT_TO_LEFT);
+        boolean verticalMode = (mWritingDirection == WritingDirection.TOP_TO_BOTTOM);
         float penX = 0.0f;
+        float penY = 0.0f;
 
         int size = glyphIds.size();
 
@@ -591,12 +604,14 @@ public class Renderer {
             if (glyphImage != null) {
                 Bitmap bitmap = glyphImage.bitmap();
                 int left = (int) (penX + xOffset + glyphImage.left() + 0.5f);
-                int top = (int) (-yOffset - glyphImage.top() + 0.5f);
+                int top = (int) (penY - yOffset - glyphImage.top() + 0.5f);
 
                 canvas.drawBitmap(bitmap, left, top, mPaint);
             }
 
-            if (!reverseMode) {
+            if (verticalMode) {
+                penY += advance;
+            } else if (!reverseMode) {
                 penX += advance;
             }
         }
@@ -20,8 +20,11 @@ import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
 import androidx.annotation.Size;
 
+import java.util.ArrayList;
+import java.util.Collections;
 import java.util.Iterator;
 import java.util.List;
+import java.util.concurrent.atomic.AtomicReferenceArray;
 
 import static com.mta.tehreer.internal.util.Preconditions.checkArgument;
 import static com.mta.tehreer.internal.util.Preconditions.checkNotNull;
@@ -30,14 +33,21 @@ import static com.mta.tehreer.internal.util.Preconditions.checkNotNull;
  * A <code>TypeFamily</code> object represents a collection of typefaces that relate to each other.
  */
 public class TypeFamily {
+    private static final int WIDTH_COUNT = TypeWidth.values().length;
+    private static final int SLOPE_COUNT = TypeSlope.values().length;
+    private static final int WEIGHT_COUNT = TypeWeight.values().length;
+    private static final int STYLE_COUNT = WIDTH_COUNT * SLOPE_COUNT * WEIGHT_COUNT;
+
     private final @NonNull String familyName;
     private final @NonNull @Size(min = 1) List<Typeface> typefaces;
+    private final @NonNull AtomicReferenceArray<Typeface> styleMatches;
 
     /**
      * Constructs a type family object.
      *
      * @param familyName The name of family.
-     * @param typefaces The list of typefaces belonging to family.
+     * @param typefaces The list of typefaces belonging to family. The list is copied, so later
+     *                  changes to it are not reflected in the family.
      */
     public TypeFamily(@NonNull String familyName, @NonNull @Size(min = 1) List<Typeface> typefaces) {
         checkNotNull(familyName, "familyName");
@@ -45,7 +55,8 @@ public class TypeFamily {
         checkArgument(!typefaces.isEmpty(), "Typefaces list cannot be empty");
 
         this.familyName = familyName;
-        this.typefaces = typefaces;
+        this.typefaces = Collections.unmodifiableList(new ArrayList<>(typefaces));
+        this.styleMatches = new AtomicReferenceArray<>(STYLE_COUNT);
     }
 
     /**
@@ -134,6 +145,19 @@ public class TypeFamily {
         checkNotNull(typeWeight, "typeWeight");
         checkNotNull(typeSlope, "typeSlope");
 
+        // The match of each style is remembered as the typefaces of a family never change.
+        int styleIndex = (typeWidth.ordinal() * SLOPE_COUNT + typeSlope.ordinal()) * WEIGHT_COUNT
+                       + typeWeight.ordinal();
+        Typeface match = styleMatches.get(styleIndex);
+        if (match == null) {
+            match = matchTypeface(typeWidth, typeWeight, typeSlope);
+            styleMatches.set(styleIndex, match);
+        }
+
+        return match;
+    }
+
+    private @NonNull Typeface matchTypeface(@NonNull TypeWidth typeWidth, @NonNull TypeWeight typeWeight, @NonNull TypeSlope typeSlope) {
         // BASED ON CSS FONT MATCHING ALGORITHM.
         Iterator<Typeface> iterator = typefaces.iterator();
         Typeface candidate = iterator.next();
@@ -70,7 +70,7 @@ public class Typeface {
     }
 
     @Keep
-    long nativeTypeface;
+    volatile long nativeTypeface;
     @Nullable Object tag;
     private final @NonNull Finalizable finalizable = new Finalizable();
 
@@ -80,6 +80,34 @@ public class Typeface {
         @NonNull TypeSlope slope = TypeSlope.PLAIN;
     }
 
+    private static class FontUnitMetrics {
+        private static final int COUNT = 13;
+
+        final int unitsPerEm;
+        final int ascent;
+        final int descent;
+        final int leading;
+        final int glyphCount;
+        final @NonNull Rect boundingBox;
+        final int underlinePosition;
+        final int underlineThickness;
+        final int strikeoutPosition;
+        final int strikeoutThickness;
+
+        FontUnitMetrics(@NonNull int[] values) {
+            unitsPerEm = values[0];
+            ascent = values[1];
+            descent = values[2];
+            leading = values[3];
+            glyphCount = values[4];
+            boundingBox = new Rect(values[5], values[6], values[7], values[8]);
+            underlinePosition = values[9];
+            underlineThickness = values[10];
+            strikeoutPosition = values[11];
+            strikeoutThickness = values[12];
+        }
+    }
+
     private static class DefaultProperties {
         @Nullable List<VariationAxis> variationAxes;
         @Nullable List<NamedStyle> namedStyles;
@@ -94,9 +122,15 @@ public class Typeface {
         @NonNull String fullName = "";
     }
 
+    private FontUnitMetrics metrics;
     private DefaultProperties defaults;
     private DesignCharacteristics design;
     private StandardNames names;
+    private volatile boolean described;
+    private Typeface describedTypeface;
+    private @Nullable TypefaceMetadataCache.Key metadataKey;
+    private @Nullable String deferredPath;
+    private volatile boolean loaded;
 
     /**
      * Constructs a typeface from the specified asset. The data of the asset is not copied into the
@@ -124,6 +158,10 @@ public class Typeface {
     /**
      * Constructs a typeface from the specified file. The data for the font is directly read from
      * the file when needed.
+     * <p>
+     * If the metadata cache of {@link TypefaceManager} holds an entry for the unmodified file, the
+     * typeface is described from that entry and the file is not opened until the typeface is
+     * actually used for anything else.
      *
      * @param file The font file.
      *
@@ -133,6 +171,21 @@ public class Typeface {
     public Typeface(@NonNull File file) {
         checkNotNull(file, "file");
 
+        final TypefaceMetadataCache.Key key = new TypefaceMetadataCache.Key(file);
+        final TypefaceMetadataCache metadataCache = TypefaceManager.metadataCache;
+        final TypefaceMetadataCache.Entry entry = (metadataCache != null ? metadataCache.get(key) : null);
+
+        metadataKey = key;
+
+        if (entry != null) {
+            this.deferredPath = file.getAbsolutePath();
+            this.describedTypeface = this;
+
+            restoreDescription(entry);
+            described = true;
+            return;
+        }
+
         long nativeTypeface = nCreateWithFile(file.getAbsolutePath());
         if (nativeTypeface == 0) {
             throw new RuntimeException("Could not create typeface from specified file");
@@ -171,33 +224,85 @@ public class Typeface {
         this.defaults = null;
         this.design = null;
         this.names = null;
+        this.describedTypeface = this;
 
+        setupNativeProperties();
+    }
+
+    private void setupNativeProperties() {
         setupDefaultProperties();
         setupDefaultCoordinates();
         setupStrikeout();
-        setupDesignCharacteristics();
-        setupNames();
-        setupVariableDescription();
+        setupMetrics();
         setupDefaultPalette();
+
+        loaded = true;
+    }
+
+    /**
+     * Opens the font file of a typeface that was described from the metadata cache. The native
+     * typeface is assigned before its properties are set up so that the setup can use it, while
+     * the other threads wait on the lock until <code>loaded</code> is set.
+     */
+    private synchronized void load() {
+        if (nativeTypeface == 0) {
+            final long handle = nCreateWithFile(deferredPath);
+            if (handle == 0) {
+                throw new IllegalStateException("Could not open the font file: " + deferredPath);
+            }
+
+            nativeTypeface = handle;
+            setupNativeProperties();
+        }
+    }
+
+    private void ensureLoaded() {
+        if (!loaded) {
+            load();
+        }
+    }
+
+    /**
+     * Returns the native typeface, opening the font file first if it has been deferred. The native
+     * code calls it whenever it finds the field unset.
+     */
+    @Keep
+    long loadNativeTypeface() {
+        ensureLoaded();
+        return nativeTypeface;
+    }
+
+    private @NonNull FontUnitMetrics lazyMetrics() {
+        ensureLoaded();
+        return metrics;
+    }
+
+    private @NonNull DefaultProperties lazyDefaults() {
+        ensureLoaded();
+        return defaults;
     }
 
     private Typeface(@NonNull Typeface typeface, @NonNull float[] coordinates) {
-        this.nativeTypeface = nGetVariationInstance(typeface.nativeTypeface, coordinates);
-        this.defaults = typeface.defaults;
+        this.nativeTypeface = nGetVariationInstance(typeface.loadNativeTypeface(), coordinates);
+        this.defaults = typeface.lazyDefaults();
         this.design = null;
         this.names = null;
+        this.describedTypeface = this;
 
         setupStrikeout();
-        setupDesignCharacteristics();
-        setupNames();
-        setupVariableDescription();
+        setupMetrics();
+
+        loaded = true;
     }
 
     private Typeface(@NonNull Typeface typeface, @NonNull int[] colors) {
-        this.nativeTypeface = nGetColorInstance(typeface.nativeTypeface, colors);
-        this.defaults = typeface.defaults;
-        this.design = typeface.design;
-        this.names = typeface.names;
+        this.nativeTypeface = nGetColorInstance(typeface.loadNativeTypeface(), colors);
+        this.metrics = typeface.lazyMetrics();
+        this.defaults = typeface.lazyDefaults();
+        this.design = null;
+        this.names = null;
+        this.describedTypeface = typeface.describedTypeface;
+        this.loaded = true;
     }
 
     private void setupDefaultProperties() {
@@ -285,7 +390,7 @@ public class Typeface {
                 coordinates[i] = variationAxes.get(i).defaultValue();
             }
 
-            String styleName = nGetDefaultStyleName(nativeTypeface);
+            String styleName = nGetDefaultStyleName(loadNativeTypeface());
             if (styleName == null) {
                 styleName = "";
             }
@@ -372,27 +477,102 @@ public class Typeface {
     private void setupDefaultCoordinates() {
         final float[] coordinates = getDefaultCoordinates();
         if (coordinates != null) {
-            nSetupCoordinates(nativeTypeface, coordinates);
+            nSetupCoordinates(loadNativeTypeface(), coordinates);
         }
     }
 
     private void setupStrikeout() {
-        nSetupStrikeout(nativeTypeface);
+        nSetupStrikeout(loadNativeTypeface());
+    }
+
+    private void setupMetrics() {
+        // Fetch all the metrics at once as they do not change for the lifetime of the typeface.
+        final int[] values = new int[FontUnitMetrics.COUNT];
+        nGetMetrics(loadNativeTypeface(), values);
+
+        metrics = new FontUnitMetrics(values);
+    }
+
+    /**
+     * Resolves the names and the design characteristics on first request as they are not needed
+     * for rendering and take several lookups of the 'name' table.
+     */
+    private synchronized void setupDescription() {
+        if (!described) {
+            final TypefaceMetadataCache metadataCache = TypefaceManager.metadataCache;
+            final TypefaceMetadataCache.Key key = metadataKey;
+
+            TypefaceMetadataCache.Entry entry = null;
+            if (metadataCache != null && key != null) {
+                entry = metadataCache.get(key);
+            }
+
+            if (entry != null) {
+                restoreDescription(entry);
+            } else {
+                setupDesignCharacteristics();
+                setupNames();
+                setupVariableDescription();
+
+                if (metadataCache != null && key != null) {
+                    metadataCache.put(key, new TypefaceMetadataCache.Entry(
+                            names.familyName, names.styleName, names.fullName,
+                            design.weight, design.width, design.slope));
+                }
+            }
+
+            // Publish the description only after it has been completely resolved.
+            described = true;
+        }
+    }
+
+    private void restoreDescription(@NonNull TypefaceMetadataCache.Entry entry) {
+        design = new DesignCharacteristics();
+        design.weight = entry.weight;
+        design.width = entry.width;
+        design.slope = entry.slope;
+
+        names = new StandardNames();
+        names.familyName = entry.familyName;
+        names.styleName = entry.styleName;
+        names.fullName = entry.fullName;
+    }
+
+    private @NonNull DesignCharacteristics lazyDesign() {
+        final Typeface typeface = describedTypeface;
+        if (!typeface.described) {
+            typeface.setupDescription();
+        }
+
+        return typeface.design;
+    }
+
+    private @NonNull StandardNames lazyNames() {
+        final Typeface typeface = describedTypeface;
+        if (!typeface.described) {
+            typeface.setupDescription();
+        }
+
+        return typeface.names;
+    }
+
+    boolean isDescribed() {
+        return describedTypeface.described;
     }
 
     private void setupDesignCharacteristics() {
         design = new DesignCharacteristics();
-        design.weight = TypeWeight.valueOf(nGetDefaultWeight(nativeTypeface));
-        design.width = TypeWidth.valueOf(nGetDefaultWidth(nativeTypeface));
-        design.slope = TypeSlope.valueOf(nGetDefaultSlope(nativeTypeface));
+        design.weight = TypeWeight.valueOf(nGetDefaultWeight(loadNativeTypeface()));
+        design.width = TypeWidth.valueOf(nGetDefaultWidth(loadNativeTypeface()));
+        design.slope = TypeSlope.valueOf(nGetDefaultSlope(loadNativeTypeface()));
     }
 
     private void setupNames() {
         names = new StandardNames();
 
-        final String familyName = nGetDefaultFamilyName(nativeTypeface);
-        final String styleName = nGetDefaultStyleName(nativeTypeface);
-        final String fullName = nGetDefaultFullName(nativeTypeface);
+        final String familyName = nGetDefaultFamilyName(loadNativeTypeface());
+        final String styleName = nGetDefaultStyleName(loadNativeTypeface());
+        final String fullName = nGetDefaultFullName(loadNativeTypeface());
 
         if (familyName != null) {
             names.familyName = familyName;
@@ -408,8 +588,8 @@ public class Typeface {
     }
 
     private void generateFullName() {
-        final String familyName = getFamilyName();
-        final String styleName = getStyleName();
+        final String familyName = names.familyName;
+        final String styleName = names.styleName;
 
         if (!familyName.isEmpty()) {
             names.fullName = familyName;
@@ -418,7 +598,7 @@ public class Typeface {
                 names.fullName += ' ' + styleName;
             }
         } else {
-            names.fullName = getStyleName();
+            names.fullName = styleName;
         }
     }
 
@@ -494,12 +674,12 @@ public class Typeface {
 
         // Select first palette by default.
         if (predefinedPalettes!= null) {
-            nSetupColors(nativeTypeface, predefinedPalettes.get(0).colors());
+            nSetupColors(loadNativeTypeface(), predefinedPalettes.get(0).colors());
         }
     }
 
     private @Nullable String searchNameString(int nameId) {
-        return nSearchNameString(nativeTypeface, nameId);
+        return nSearchNameString(loadNativeTypeface(), nameId);
     }
 
     /**
@@ -540,7 +720,7 @@ public class Typeface {
      * @return The variation axes of this typeface if it supports OpenType font variations.
      */
     public @Nullable List<VariationAxis> getVariationAxes() {
-        final List<VariationAxis> variationAxes = defaults.variationAxes;
+        final List<VariationAxis> variationAxes = lazyDefaults().variationAxes;
         if (variationAxes != null && !variationAxes.isEmpty()) {
             return Collections.unmodifiableList(variationAxes);
         }
@@ -570,7 +750,7 @@ public class Typeface {
      * @return The named instance records of this typeface if it supports OpenType font variations.
      */
     public @Nullable List<NamedStyle> getNamedStyles() {
-        final List<NamedStyle> namedStyles = defaults.namedStyles;
+        final List<NamedStyle> namedStyles = lazyDefaults().namedStyles;
         if (namedStyles != null && !namedStyles.isEmpty()) {
             return Collections.unmodifiableList(namedStyles);
         }
@@ -589,7 +769,7 @@ public class Typeface {
         final List<VariationAxis> variationAxes = getVariationAxes();
         if (variationAxes != null) {
             float[] coordinates = new float[variationAxes.size()];
-            nGetVariationCoordinates(nativeTypeface, coordinates);
+            nGetVariationCoordinates(loadNativeTypeface(), coordinates);
 
             return coordinates;
         }
@@ -605,7 +785,7 @@ public class Typeface {
      * palettes.
      */
     public @Nullable List<String> getPaletteEntryNames() {
-        final List<String> paletteEntryNames = defaults.paletteEntryNames;
+        final List<String> paletteEntryNames = lazyDefaults().paletteEntryNames;
         if (paletteEntryNames != null && !paletteEntryNames.isEmpty()) {
             return Collections.unmodifiableList(paletteEntryNames);
         }
@@ -619,7 +799,7 @@ public class Typeface {
      * @return The predefined palettes in this typeface if it supports OpenType color palettes.
      */
     public @Nullable List<ColorPalette> getPredefinedPalettes() {
-        final List<ColorPalette> predefinedPalettes = defaults.predefinedPalettes;
+        final List<ColorPalette> predefinedPalettes = lazyDefaults().predefinedPalettes;
         if (predefinedPalettes != null && !predefinedPalettes.isEmpty()) {
             return Collections.unmodifiableList(predefinedPalettes);
         }
@@ -636,7 +816,7 @@ public class Typeface {
         final List<String> paletteEntryNames = getPaletteEntryNames();
         if (paletteEntryNames != null) {
             int[] colors = new int[paletteEntryNames.size()];
-            nGetAssociatedColors(nativeTypeface, colors);
+            nGetAssociatedColors(loadNativeTypeface(), colors);
 
             return colors;
         }
@@ -674,7 +854,7 @@ public class Typeface {
      * @return The family name of this typeface.
      */
     public String getFamilyName() {
-        return names.familyName;
+        return lazyNames().familyName;
     }
 
     /**
@@ -683,7 +863,7 @@ public class Typeface {
      * @return The style name of this typeface.
      */
     public String getStyleName() {
-        return names.styleName;
+        return lazyNames().styleName;
     }
 
     /**
@@ -692,7 +872,7 @@ public class Typeface {
      * @return The full name of this typeface.
      */
     public String getFullName() {
-        return names.fullName;
+        return lazyNames().fullName;
     }
 
     /**
@@ -702,7 +882,7 @@ public class Typeface {
      * @return The typographic weight of this typeface.
      */
     public @NonNull TypeWeight getWeight() {
-        return design.weight;
+        return lazyDesign().weight;
     }
 
     /**
@@ -712,7 +892,7 @@ public class Typeface {
      * @return The typographic width of this typeface.
      */
     public @NonNull TypeWidth getWidth() {
-        return design.width;
+        return lazyDesign().width;
     }
 
     /**
@@ -722,7 +902,7 @@ public class Typeface {
      * @return The typographic slope of this typeface.
      */
     public @NonNull TypeSlope getSlope() {
-        return design.slope;
+        return lazyDesign().slope;
     }
 
     /**
@@ -734,7 +914,7 @@ public class Typeface {
      *         table exists.
      */
     public @Nullable byte[] getTableData(int tableTag) {
-        return nGetTableData(nativeTypeface, tableTag);
+        return nGetTableData(loadNativeTypeface(), tableTag);
     }
 
     /**
@@ -743,7 +923,7 @@ public class Typeface {
      * @return The number of font units per EM square for this typeface.
      */
 	public int getUnitsPerEm() {
-		return nGetUnitsPerEm(nativeTypeface);
+		return lazyMetrics().unitsPerEm;
 	}
 
     /**
@@ -752,7 +932,7 @@ public class Typeface {
      * @return The typographic ascender of this typeface expressed in font units.
      */
 	public int getAscent() {
-		return nGetAscent(nativeTypeface);
+		return lazyMetrics().ascent;
 	}
 
     /**
@@ -761,7 +941,7 @@ public class Typeface {
      * @return The typographic descender of this typeface expressed in font units.
      */
 	public int getDescent() {
-		return nGetDescent(nativeTypeface);
+		return lazyMetrics().descent;
 	}
 
     /**
@@ -770,7 +950,7 @@ public class Typeface {
      * @return The typographic leading of this typeface expressed in font units.
      */
     public int getLeading() {
-        return nGetLeading(nativeTypeface);
+        return lazyMetrics().leading;
     }
 
     /**
@@ -779,7 +959,7 @@ public class Typeface {
      * @return The number of glyphs in this typeface.
      */
 	public int getGlyphCount() {
-        return nGetGlyphCount(nativeTypeface);
+        return lazyMetrics().glyphCount;
     }
 
     /**
@@ -789,7 +969,7 @@ public class Typeface {
      * @return The glyph id for the specified code point.
      */
     public int getGlyphId(int codePoint) {
-        return nGetGlyphId(nativeTypeface, codePoint);
+        return nGetGlyphId(loadNativeTypeface(), codePoint);
     }
 
     /**
@@ -801,7 +981,31 @@ public class Typeface {
      * @return The advance for the specified glyph.
      */
     public float getGlyphAdvance(int glyphId, float typeSize, boolean vertical) {
-        return nGetGlyphAdvance(nativeTypeface, glyphId, typeSize, vertical);
+        return nGetGlyphAdvance(loadNativeTypeface(), glyphId, typeSize, vertical);
+    }
+
+    /**
+     * Retrieves the advances for the specified glyphs in a single call. The advances are not
+     * hinted, so they are linearly scaled from font units and match the ones used for shaping.
+     *
+     * @param glyphIds The array of glyph ids for which to retrieve the advances.
+     * @param typeSize The size for which the advances are retrieved.
+     * @param vertical The flag which indicates the type of advances, either horizontal or vertical.
+     * @param advances The array that receives the advances. It must be at least as long as the
+     *                 array of glyph ids.
+     *
+     * @throws NullPointerException if <code>glyphIds</code> or <code>advances</code> is null.
+     * @throws IllegalArgumentException if <code>advances</code> is shorter than
+     *         <code>glyphIds</code>.
+     */
+    public void getGlyphAdvances(@NonNull int[] glyphIds, float typeSize, boolean vertical,
+                                 @NonNull float[] advances) {
+        checkNotNull(glyphIds, "glyphIds");
+        checkNotNull(advances, "advances");
+        checkArgument(advances.length >= glyphIds.length,
+                      "The advances array is shorter than the glyph ids array");
+
+        nGetGlyphAdvances(loadNativeTypeface(), glyphIds, typeSize, vertical, advances);
     }
 
     /**
@@ -820,7 +1024,7 @@ public class Typeface {
             matrix.getValues(values);
         }
 
-        return nGetGlyphPath(nativeTypeface, glyphId, typeSize, values);
+        return nGetGlyphPath(loadNativeTypeface(), glyphId, typeSize, values);
     }
 
     /**
@@ -830,10 +1034,7 @@ public class Typeface {
      * @return The font bounding box expressed in font units.
      */
     public @NonNull Rect getBoundingBox() {
-	    Rect boundingBox = new Rect();
-	    nGetBoundingBox(nativeTypeface, boundingBox);
-
-	    return boundingBox;
+	    return new Rect(lazyMetrics().boundingBox);
 	}
 
     /**
@@ -842,7 +1043,7 @@ public class Typeface {
      * @return The position, in font units, of the underline for this typeface.
      */
 	public int getUnderlinePosition() {
-	    return nGetUnderlinePosition(nativeTypeface);
+	    return lazyMetrics().underlinePosition;
 	}
 
     /**
@@ -851,7 +1052,7 @@ public class Typeface {
      * @return The thickness, in font units, of the underline for this typeface.
      */
 	public int getUnderlineThickness() {
-	    return nGetUnderlineThickness(nativeTypeface);
+	    return lazyMetrics().underlineThickness;
 	}
 
     /**
@@ -860,7 +1061,7 @@ public class Typeface {
      * @return The position, in font units, of the strikeout for this typeface.
      */
     public int getStrikeoutPosition() {
-        return nGetStrikeoutPosition(nativeTypeface);
+        return lazyMetrics().strikeoutPosition;
     }
 
     /**
@@ -869,11 +1070,14 @@ public class Typeface {
      * @return The thickness, in font units, of the strikeout for this typeface.
      */
     public int getStrikeoutThickness() {
-        return nGetStrikeoutThickness(nativeTypeface);
+        return lazyMetrics().strikeoutThickness;
     }
 
     void dispose() {
-        nDispose(nativeTypeface);
+        // A deferred typeface might have never been opened.
+        if (nativeTypeface != 0) {
+            nDispose(nativeTypeface);
+        }
     }
 
     @Override
@@ -924,21 +1128,10 @@ public class Typeface {
 
     private static native byte[] nGetTableData(long nativeTypeface, int tableTag);
 
-	private static native int nGetUnitsPerEm(long nativeTypeface);
-	private static native int nGetAscent(long nativeTypeface);
-	private static native int nGetDescent(long nativeTypeface);
-    private static native int nGetLeading(long nativeTypeface);
+    private static native void nGetMetrics(long nativeTypeface, int[] metrics);
 
-	private static native int nGetGlyphCount(long nativeTypeface);
     private static native int nGetGlyphId(long nativeTypeface, int codePoint);
     private static native float nGetGlyphAdvance(long nativeTypeface, int glyphId, float typeSize, boolean vertical);
+    private static native void nGetGlyphAdvances(long nativeTypeface, int[] glyphIds, float typeSize, boolean vertical, float[] advances);
     private static native Path nGetGlyphPath(long nativeTypeface, int glyphId, float typeSize, float[] matrix);
-
-	private static native void nGetBoundingBox(long nativeTypeface, Rect boundingBox);
-
-	private static native int nGetUnderlinePosition(long nativeTypeface);
-	private static native int nGetUnderlineThickness(long nativeTypeface);
-
-    private static native int nGetStrikeoutPosition(long nativeTypeface);
-    private static native int nGetStrikeoutThickness(long nativeTypeface);
 }
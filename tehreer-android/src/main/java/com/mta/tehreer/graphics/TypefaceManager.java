@@ -19,13 +19,20 @@ package com.mta.tehreer.graphics;
 import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
 
+import com.mta.tehreer.internal.layout.FontFallback;
+
+import java.io.File;
+import java.io.IOException;
 import java.util.ArrayList;
+import java.util.Collection;
 import java.util.Collections;
 import java.util.Comparator;
-import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.LinkedHashSet;
 import java.util.List;
 import java.util.Map;
 import java.util.TreeMap;
+import java.util.concurrent.ConcurrentHashMap;
 
 import static com.mta.tehreer.internal.util.Preconditions.checkArgument;
 import static com.mta.tehreer.internal.util.Preconditions.checkNotNull;
@@ -46,12 +53,161 @@ public class TypefaceManager {
         }
     }
 
-    private static final @NonNull HashMap<Object, Typeface> tags = new HashMap<>();
-    private static final @NonNull ArrayList<Typeface> typefaces = new ArrayList<>();
-    private static boolean sorted;
+    /**
+     * The registered typefaces arranged by their names. Building it describes every typeface, so
+     * it is only made when a lookup by name or a sorted list is requested.
+     */
+    private static class NameIndex {
+        final @NonNull List<Typeface> typefaces;
+        final @NonNull Typeface[] typefaceArray;
+        final @NonNull List<TypeFamily> families;
+        final @NonNull Map<String, TypeFamily> familyMap;
+        final @NonNull Map<String, Typeface> fullNameMap;
+
+        NameIndex(@NonNull List<Typeface> registered) {
+            List<Typeface> sortedList = new ArrayList<>(registered);
+            Collections.sort(sortedList, new TypefaceComparator());
+
+            Map<String, List<Typeface>> entryMap = new TreeMap<>(String.CASE_INSENSITIVE_ORDER);
+            Map<String, Typeface> fullNames = new TreeMap<>(String.CASE_INSENSITIVE_ORDER);
+
+            for (Typeface typeface : sortedList) {
+                String familyName = typeface.getFamilyName();
+                List<Typeface> entryList = entryMap.get(familyName);
+                if (entryList == null) {
+                    entryList = new ArrayList<>();
+                    entryMap.put(familyName, entryList);
+                }
+                entryList.add(typeface);
+
+                String fullName = typeface.getFullName();
+                if (!fullNames.containsKey(fullName)) {
+                    fullNames.put(fullName, typeface);
+                }
+            }
+
+            Map<String, TypeFamily> familyMap = new TreeMap<>(String.CASE_INSENSITIVE_ORDER);
+            List<TypeFamily> familyList = new ArrayList<>(entryMap.size());
+
+            for (Map.Entry<String, List<Typeface>> entry : entryMap.entrySet()) {
+                TypeFamily typeFamily = new TypeFamily(entry.getKey(), entry.getValue());
+                familyMap.put(entry.getKey(), typeFamily);
+                familyList.add(typeFamily);
+            }
+
+            this.typefaces = Collections.unmodifiableList(sortedList);
+            this.typefaceArray = sortedList.toArray(new Typeface[0]);
+            this.families = Collections.unmodifiableList(familyList);
+            this.familyMap = familyMap;
+            this.fullNameMap = fullNames;
+        }
+    }
+
+    /**
+     * An immutable view of registered typefaces that is rebuilt on first read after a change, so
+     * that the lookups do not need to hold the lock of <code>TypefaceManager</code>. Only the
+     * lookups that compare names describe the typefaces, and they do so outside of that lock.
+     */
+    private static class Index {
+        final @NonNull List<Typeface> registered;
+        final @NonNull Typeface[] registeredArray;
+        final @NonNull Map<Integer, List<Typeface>> coverageMap;
+        private volatile @Nullable NameIndex nameIndex;
+
+        Index(@NonNull Collection<Typeface> registered) {
+            this.registered = Collections.unmodifiableList(new ArrayList<>(registered));
+            this.registeredArray = registered.toArray(new Typeface[0]);
+            this.coverageMap = new LinkedHashMap<Integer, List<Typeface>>(16, 0.75f, true) {
+                @Override
+                protected boolean removeEldestEntry(Map.Entry<Integer, List<Typeface>> eldest) {
+                    return size() > MAX_COVERAGE_ENTRIES;
+                }
+            };
+        }
+
+        @NonNull NameIndex getNameIndex() {
+            NameIndex current = nameIndex;
+            if (current == null) {
+                synchronized (this) {
+                    current = nameIndex;
+                    if (current == null) {
+                        current = new NameIndex(registered);
+                        nameIndex = current;
+                    }
+                }
+            }
+
+            return current;
+        }
+
+        @NonNull List<Typeface> getTypefacesForCodePoint(int codePoint) {
+            List<Typeface> candidates;
+            synchronized (coverageMap) {
+                candidates = coverageMap.get(codePoint);
+            }
+
+            if (candidates == null) {
+                NameIndex sorted = nameIndex;
+                Typeface[] typefaces = (sorted != null ? sorted.typefaceArray : registeredArray);
+                int[] indexes = FontFallback.findCovering(codePoint, typefaces);
+                List<Typeface> matches = new ArrayList<>(indexes.length);
+
+                for (int index : indexes) {
+                    matches.add(typefaces[index]);
+                }
+
+                // Describe only the typefaces that need to be ordered.
+                if (sorted == null) {
+                    Collections.sort(matches, new TypefaceComparator());
+                }
+
+                candidates = Collections.unmodifiableList(matches);
+                synchronized (coverageMap) {
+                    coverageMap.put(codePoint, candidates);
+                }
+            }
+
+            return candidates;
+        }
+    }
+
+    /* The number of code points whose typefaces are retained by an index. */
+    private static final int MAX_COVERAGE_ENTRIES = 512;
+
+    private static final @NonNull ConcurrentHashMap<Object, Typeface> tags = new ConcurrentHashMap<>();
+    private static final @NonNull LinkedHashSet<Typeface> typefaces = new LinkedHashSet<>();
+    private static volatile @Nullable Index index;
+
+    static volatile @Nullable TypefaceMetadataCache metadataCache;
 
     private TypefaceManager() { }
 
+    /**
+     * Sets the file used to persist the names and the styles of typefaces created from files. The
+     * existing entries of the file are loaded immediately and reused by such typefaces as long as
+     * their font files are not modified. A typeface created from a file that has an entry is not
+     * opened until it is used for something other than its names and styles, so registering it
+     * does not touch the font file at all. Passing <code>null</code> disables the cache.
+     *
+     * @param cacheFile The metadata cache file, or <code>null</code>.
+     */
+    public static void setMetadataCacheFile(@Nullable File cacheFile) {
+        metadataCache = (cacheFile != null ? new TypefaceMetadataCache(cacheFile) : null);
+    }
+
+    /**
+     * Writes the metadata of described typefaces to the cache file if it has changed since it was
+     * loaded. It is a no-op if no cache file has been set.
+     *
+     * @throws IOException if an I/O error occurs while writing the cache file.
+     */
+    public static void saveMetadataCache() throws IOException {
+        final TypefaceMetadataCache cache = metadataCache;
+        if (cache != null) {
+            cache.save();
+        }
+    }
+
     /**
      * Registers a typeface in <code>TypefaceManager</code>.
      *
@@ -66,16 +222,15 @@ public class TypefaceManager {
 
         synchronized (TypefaceManager.class) {
             checkArgument(!typefaces.contains(typeface), "This typeface is already registered");
+            checkArgument(tag == null || !tags.containsKey(tag), "This tag is already taken");
 
             if (tag != null) {
-                checkArgument(!tags.containsKey(tag), "This tag is already taken");
-
                 tags.put(tag, typeface);
                 typeface.tag = tag;
             }
 
-            sorted = false;
             typefaces.add(typeface);
+            index = null;
         }
     }
 
@@ -90,12 +245,13 @@ public class TypefaceManager {
         checkNotNull(typeface, "typeface");
 
         synchronized (TypefaceManager.class) {
-            int index = typefaces.indexOf(typeface);
-            checkArgument(index >= 0, "This typeface is not registered");
+            checkArgument(typefaces.remove(typeface), "This typeface is not registered");
 
-            typefaces.remove(index);
-            tags.remove(typeface.tag);
-            typeface.tag = null;
+            if (typeface.tag != null) {
+                tags.remove(typeface.tag);
+                typeface.tag = null;
+            }
+            index = null;
         }
     }
 
@@ -109,9 +265,7 @@ public class TypefaceManager {
     public static @Nullable Typeface getTypeface(@NonNull Object tag) {
         checkNotNull(tag, "tag");
 
-        synchronized (TypefaceManager.class) {
-            return tags.get(tag);
-        }
+        return tags.get(tag);
     }
 
     /**
@@ -133,6 +287,21 @@ public class TypefaceManager {
         }
     }
 
+    private static @NonNull Index getIndex() {
+        Index current = index;
+        if (current == null) {
+            synchronized (TypefaceManager.class) {
+                current = index;
+                if (current == null) {
+                    current = new Index(typefaces);
+                    index = current;
+                }
+            }
+        }
+
+        return current;
+    }
+
     /**
      * Looks for a type family having specified family name.
      *
@@ -140,22 +309,11 @@ public class TypefaceManager {
      * @return A type family having specified family name.
      */
     public static @Nullable TypeFamily getTypeFamily(@NonNull String familyName) {
-        List<Typeface> entryList = new ArrayList<>();
+        TypeFamily typeFamily = getIndex().getNameIndex().familyMap.get(familyName);
 
-        synchronized (TypefaceManager.class) {
-            sortTypefaces();
-
-            for (Typeface typeface : typefaces) {
-                if (typeface.getFamilyName().equalsIgnoreCase(familyName)) {
-                    entryList.add(typeface);
-                }
-            }
-        }
-
-        TypeFamily typeFamily = null;
-
-        if (entryList.size() > 0) {
-            typeFamily = new TypeFamily(familyName, entryList);
+        // Report the family by the name it was asked for, even if it differs in case.
+        if (typeFamily != null && !typeFamily.getFamilyName().equals(familyName)) {
+            typeFamily = new TypeFamily(familyName, typeFamily.getTypefaces());
         }
 
         return typeFamily;
@@ -169,15 +327,19 @@ public class TypefaceManager {
      *         registered.
      */
     public static @Nullable Typeface getTypefaceByName(@NonNull String fullName) {
-        synchronized (TypefaceManager.class) {
-            for (Typeface typeface : typefaces) {
-                if (typeface.getFullName().equalsIgnoreCase(fullName)) {
-                    return typeface;
-                }
-            }
-        }
+        return getIndex().getNameIndex().fullNameMap.get(fullName);
+    }
 
-        return null;
+    /**
+     * Returns the registered typefaces that map the specified code point to a glyph, sorted by
+     * their family and style names in ascending order. The results of recently requested code
+     * points are retained until a typeface is registered or unregistered.
+     *
+     * @param codePoint The code point to look for.
+     * @return A list of typefaces supporting the code point.
+     */
+    public static @NonNull List<Typeface> getTypefacesForCodePoint(int codePoint) {
+        return getIndex().getTypefacesForCodePoint(codePoint);
     }
 
     /**
@@ -186,32 +348,7 @@ public class TypefaceManager {
      * @return A list of available type families.
      */
     public static @NonNull List<TypeFamily> getAvailableFamilies() {
-        Map<String, List<Typeface>> familyMap = new TreeMap<>(String.CASE_INSENSITIVE_ORDER);
-
-        synchronized (TypefaceManager.class) {
-            sortTypefaces();
-
-            for (Typeface typeface : typefaces) {
-                List<Typeface> entryList = familyMap.get(typeface.getFamilyName());
-                if (entryList == null) {
-                    entryList = new ArrayList<>();
-                    familyMap.put(typeface.getFamilyName(), entryList);
-                }
-
-                entryList.add(typeface);
-            }
-        }
-
-        List<TypeFamily> familyList = new ArrayList<>(familyMap.size());
-
-        for (Map.Entry<String, List<Typeface>> entry : familyMap.entrySet()) {
-            String familyName = entry.getKey();
-            List<Typeface> typefaces = entry.getValue();
-
-            familyList.add(new TypeFamily(familyName, typefaces));
-        }
-
-        return Collections.unmodifiableList(familyList);
+        return getIndex().getNameIndex().families;
     }
 
     /**
@@ -221,17 +358,6 @@ public class TypefaceManager {
      * @return A list of available typefaces.
      */
     public static @NonNull List<Typeface> getAvailableTypefaces() {
-        synchronized (TypefaceManager.class) {
-            sortTypefaces();
-
-            return Collections.unmodifiableList(new ArrayList<>(typefaces));
-        }
-    }
-
-    private static void sortTypefaces() {
-        if (!sorted) {
-            Collections.sort(typefaces, new TypefaceComparator());
-            sorted = true;
-        }
+        return getIndex().getNameIndex().typefaces;
     }
 }
@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.graphics;
+
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+
+import java.io.Closeable;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.RandomAccessFile;
+import java.nio.BufferUnderflowException;
+import java.nio.ByteBuffer;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.charset.Charset;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.Map;
+
+/**
+ * A persistent store of the descriptive metadata of typefaces created from files. The entries are
+ * keyed by the path, the length and the modification time of the font file, so an entry becomes
+ * stale as soon as its file changes.
+ */
+final class TypefaceMetadataCache {
+    private static final int MAGIC = 0x544D4443;
+    private static final int VERSION = 1;
+    private static final Charset UTF_8 = Charset.forName("UTF-8");
+
+    // An entry holds at least four string lengths, two longs, two shorts and a byte.
+    private static final int MIN_ENTRY_SIZE = 4 * 4 + 8 * 2 + 2 * 2 + 1;
+
+    static final class Key {
+        final @NonNull String path;
+        final long length;
+        final long lastModified;
+
+        Key(@NonNull File file) {
+            this.path = file.getAbsolutePath();
+            this.length = file.length();
+            this.lastModified = file.lastModified();
+        }
+
+        Key(@NonNull String path, long length, long lastModified) {
+            this.path = path;
+            this.length = length;
+            this.lastModified = lastModified;
+        }
+
+        boolean isStale() {
+            File file = new File(path);
+            return !file.isFile() || file.length() != length || file.lastModified() != lastModified;
+        }
+
+        @Override
+        public boolean equals(@Nullable Object obj) {
+            if (this == obj) {
+                return true;
+            }
+            if (obj == null || getClass() != obj.getClass()) {
+                return false;
+            }
+
+            Key other = (Key) obj;
+            return path.equals(other.path)
+                    && length == other.length
+                    && lastModified == other.lastModified;
+        }
+
+        @Override
+        public int hashCode() {
+            int result = path.hashCode();
+            result = 31 * result + (int) (length ^ (length >>> 32));
+            result = 31 * result + (int) (lastModified ^ (lastModified >>> 32));
+
+            return result;
+        }
+    }
+
+    static final class Entry {
+        final @NonNull String familyName;
+        final @NonNull String styleName;
+        final @NonNull String fullName;
+        final @NonNull TypeWeight weight;
+        final @NonNull TypeWidth width;
+        final @NonNull TypeSlope slope;
+
+        Entry(@NonNull String familyName, @NonNull String styleName, @NonNull String fullName,
+              @NonNull TypeWeight weight, @NonNull TypeWidth width, @NonNull TypeSlope slope) {
+            this.familyName = familyName;
+            this.styleName = styleName;
+            this.fullName = fullName;
+            this.weight = weight;
+            this.width = width;
+            this.slope = slope;
+        }
+    }
+
+    private final @NonNull File file;
+    private final @NonNull Map<Key, Entry> entries = new HashMap<>();
+    private final @NonNull Map<String, Key> keys = new HashMap<>();
+    private boolean modified;
+
+    TypefaceMetadataCache(@NonNull File file) {
+        this.file = file;
+        load();
+    }
+
+    synchronized @Nullable Entry get(@NonNull Key key) {
+        return entries.get(key);
+    }
+
+    synchronized void put(@NonNull Key key, @NonNull Entry entry) {
+        // Replace the entry of an older version of the same file.
+        Key oldKey = keys.put(key.path, key);
+        if (oldKey != null && !oldKey.equals(key)) {
+            entries.remove(oldKey);
+        }
+
+        entries.put(key, entry);
+        modified = true;
+    }
+
+    private void load() {
+        if (!file.isFile()) {
+            return;
+        }
+
+        RandomAccessFile input = null;
+
+        try {
+            input = new RandomAccessFile(file, "r");
+
+            FileChannel channel = input.getChannel();
+            MappedByteBuffer buffer = channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size());
+
+            if (buffer.getInt() != MAGIC || buffer.getInt() != VERSION) {
+                return;
+            }
+
+            final int entryCount = buffer.getInt();
+            if (entryCount < 0 || entryCount > buffer.remaining() / MIN_ENTRY_SIZE) {
+                return;
+            }
+
+            for (int i = 0; i < entryCount; i++) {
+                String path = readString(buffer);
+                long length = buffer.getLong();
+                long lastModified = buffer.getLong();
+                String familyName = readString(buffer);
+                String styleName = readString(buffer);
+                String fullName = readString(buffer);
+                TypeWeight weight = TypeWeight.valueOf(buffer.getShort());
+                TypeWidth width = TypeWidth.valueOf(buffer.getShort());
+                TypeSlope slope = TypeSlope.valueOf(buffer.get());
+
+                Key key = new Key(path, length, lastModified);
+                Key oldKey = keys.put(path, key);
+                if (oldKey != null) {
+                    entries.remove(oldKey);
+                }
+
+                entries.put(key, new Entry(familyName, styleName, fullName, weight, width, slope));
+            }
+        } catch (IOException | BufferUnderflowException | IllegalArgumentException
+                 | IndexOutOfBoundsException e) {
+            // Discard a corrupted cache; it will be rebuilt on next save.
+            entries.clear();
+            keys.clear();
+        } finally {
+            closeQuietly(input);
+        }
+    }
+
+    /**
+     * Writes the entries to the cache file if they have changed since it was loaded. The entries
+     * of font files that have been removed or modified are dropped before writing.
+     *
+     * @throws IOException if an I/O error occurs while writing the file.
+     */
+    synchronized void save() throws IOException {
+        if (pruneStaleEntries()) {
+            modified = true;
+        }
+        if (!modified) {
+            return;
+        }
+
+        ByteBuffer buffer = ByteBuffer.allocate(estimateSize());
+        buffer.putInt(MAGIC);
+        buffer.putInt(VERSION);
+        buffer.putInt(entries.size());
+
+        for (Map.Entry<Key, Entry> pair : entries.entrySet()) {
+            Key key = pair.getKey();
+            Entry entry = pair.getValue();
+
+            writeString(buffer, key.path);
+            buffer.putLong(key.length);
+            buffer.putLong(key.lastModified);
+            writeString(buffer, entry.familyName);
+            writeString(buffer, entry.styleName);
+            writeString(buffer, entry.fullName);
+            buffer.putShort((short) entry.weight.value);
+            buffer.putShort((short) entry.width.value);
+            buffer.put((byte) entry.slope.ordinal());
+        }
+
+        // Write to a temporary file first so that a reader never sees a partial cache.
+        File temporary = new File(file.getPath() + ".tmp");
+
+        FileOutputStream output = new FileOutputStream(temporary);
+
+        try {
+            output.write(buffer.array(), 0, buffer.position());
+        } finally {
+            output.close();
+        }
+        if (!temporary.renameTo(file)) {
+            temporary.delete();
+            throw new IOException("Could not replace the metadata cache file");
+        }
+
+        modified = false;
+    }
+
+    private boolean pruneStaleEntries() {
+        Iterator<Key> iterator = entries.keySet().iterator();
+        boolean pruned = false;
+
+        while (iterator.hasNext()) {
+            Key key = iterator.next();
+
+            if (key.isStale()) {
+                iterator.remove();
+                keys.remove(key.path);
+                pruned = true;
+            }
+        }
+
+        return pruned;
+    }
+
+    private int estimateSize() {
+        int size = 12;
+
+        for (Map.Entry<Key, Entry> pair : entries.entrySet()) {
+            Key key = pair.getKey();
+            Entry entry = pair.getValue();
+
+            size += 16 + 5;
+            size += 4 * (4 + key.path.length());
+            size += 4 * (4 + entry.familyName.length());
+            size += 4 * (4 + entry.styleName.length());
+            size += 4 * (4 + entry.fullName.length());
+        }
+
+        return size;
+    }
+
+    private static void closeQuietly(@Nullable Closeable closeable) {
+        if (closeable != null) {
+            try {
+                closeable.close();
+            } catch (IOException ignored) {
+            }
+        }
+    }
+
+    private static @NonNull String readString(@NonNull ByteBuffer buffer) {
+        final int length = buffer.getInt();
+        if (length < 0 || length > buffer.remaining()) {
+            throw new BufferUnderflowException();
+        }
+
+        byte[] bytes = new byte[length];
+        buffer.get(bytes);
+
+        return new String(bytes, UTF_8);
+    }
+
+    private static void writeString(@NonNull ByteBuffer buffer, @NonNull String string) {
+        byte[] bytes = string.getBytes(UTF_8);
+        buffer.putInt(bytes.length);
+        buffer.put(bytes);
+    }
+}
@@ -22,6 +22,7 @@ import android.text.style.ScaleXSpan
 import com.mta.tehreer.graphics.Renderer
 import com.mta.tehreer.internal.layout.TextRun
 import com.mta.tehreer.internal.util.isOdd
+import com.mta.tehreer.sfnt.WritingDirection
 import kotlin.math.max
 import kotlin.math.min
 
@@ -75,6 +76,16 @@ internal class DefaultTextRunDrawing(
         }
     }
 
+    /**
+     * Vertical lines are drawn by rotating them clockwise, so the glyphs placed downwards by the
+     * renderer are turned back to stand upright along the line.
+     */
+    private fun keepGlyphsUpright(canvas: Canvas) {
+        if (textRun.writingDirection == WritingDirection.TOP_TO_BOTTOM) {
+            canvas.rotate(-90.0f)
+        }
+    }
+
     private fun drawEdgeCluster(renderer: Renderer, canvas: Canvas, cluster: ClusterRange) {
         val runStart = textRun.startIndex
         val runEnd = textRun.endIndex
@@ -96,6 +107,7 @@ internal class DefaultTextRunDrawing(
         canvas.save()
         canvas.clipRect(clipLeft, -Float.MAX_VALUE, clipRight, Float.MAX_VALUE)
         canvas.translate(getLeadingEdge(cluster.actualStart, cluster.actualEnd), 0.0f)
+        keepGlyphsUpright(canvas)
 
         renderer.drawGlyphs(
             canvas,
@@ -163,6 +175,7 @@ internal class DefaultTextRunDrawing(
 
         canvas.save()
         canvas.translate(getLeadingEdge(chunkStart, chunkEnd), 0.0f)
+        keepGlyphsUpright(canvas)
 
         renderer.drawGlyphs(
             canvas,
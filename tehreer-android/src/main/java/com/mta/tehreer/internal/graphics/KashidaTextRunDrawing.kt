@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.internal.graphics
+
+import android.graphics.Canvas
+import android.text.style.ForegroundColorSpan
+import com.mta.tehreer.collections.FloatList
+import com.mta.tehreer.collections.IntList
+import com.mta.tehreer.collections.PointList
+import com.mta.tehreer.graphics.Renderer
+import com.mta.tehreer.internal.layout.TextRun
+import kotlin.math.ceil
+import kotlin.math.max
+import kotlin.math.min
+
+/**
+ * Fills the kashida gaps of a right-to-left run with tatweel glyphs. The gap of a glyph lies
+ * on its right side, i.e. between it and its logically preceding glyph.
+ */
+internal class KashidaTextRunDrawing(
+    private val textRun: TextRun,
+    private val kashidaGlyphId: Int,
+    private val kashidaWidths: FloatArray
+) : TextRunDrawing {
+    private val kashidaAdvance = textRun.typeface.getGlyphAdvance(kashidaGlyphId, textRun.typeSize, false)
+    private val kashidaCounts = IntArray(kashidaWidths.size)
+    private val kashidaIds: IntList
+    private val kashidaOffsets: PointList
+    private val kashidaAdvances: FloatList
+
+    init {
+        var maxCount = 0
+
+        if (kashidaAdvance > 0.0f) {
+            for (i in kashidaWidths.indices) {
+                val kashidaWidth = kashidaWidths[i]
+                if (kashidaWidth > 0.0f) {
+                    val kashidaCount = ceil(kashidaWidth / kashidaAdvance).toInt()
+                    kashidaCounts[i] = kashidaCount
+                    maxCount = max(maxCount, kashidaCount)
+                }
+            }
+        }
+
+        // Every gap draws a prefix of the same tatweel sequence.
+        kashidaIds = IntList.of(*IntArray(maxCount) { kashidaGlyphId })
+        kashidaOffsets = PointList.of(*FloatArray(maxCount * 2))
+        kashidaAdvances = FloatList.of(*FloatArray(maxCount) { kashidaAdvance })
+    }
+
+    override fun draw(renderer: Renderer, canvas: Canvas) {
+        renderer.typeface = textRun.typeface
+        renderer.typeSize = textRun.typeSize
+        renderer.scaleX = 1.0f
+        renderer.writingDirection = textRun.writingDirection
+
+        val defaultFillColor = renderer.fillColor
+
+        for (span in textRun.spans) {
+            if (span is ForegroundColorSpan) {
+                renderer.fillColor = span.foregroundColor
+            }
+        }
+
+        if (kashidaIds.size() > 0) {
+            // Do not draw into the clipped clusters of the run.
+            val visibleLeft = textRun.getCaretEdge(textRun.endIndex)
+            val visibleRight = textRun.getCaretEdge(textRun.startIndex)
+
+            val glyphAdvances = textRun.glyphAdvances
+            var penX = textRun.caretEdges[0]
+
+            for (i in 0 until textRun.glyphCount) {
+                val kashidaCount = kashidaCounts[i]
+                if (kashidaCount > 0) {
+                    val kashidaWidth = kashidaWidths[i]
+
+                    canvas.save()
+                    canvas.clipRect(
+                        max(penX - kashidaWidth, visibleLeft), -Float.MAX_VALUE,
+                        min(penX, visibleRight), Float.MAX_VALUE
+                    )
+                    canvas.translate(penX, 0.0f)
+
+                    renderer.drawGlyphs(
+                        canvas,
+                        kashidaIds.subList(0, kashidaCount),
+                        kashidaOffsets.subList(0, kashidaCount),
+                        kashidaAdvances.subList(0, kashidaCount)
+                    )
+
+                    canvas.restore()
+                }
+
+                penX -= glyphAdvances[i]
+            }
+        }
+
+        renderer.fillColor = defaultFillColor
+    }
+}
@@ -28,15 +28,28 @@ internal class BreakResolver(
     private val runs: RunCollection,
     private val breaks: BreakClassifier
 ) {
+    /**
+     * Measures a range in constant time from the cumulative advances of the text. An empty or
+     * reversed range is measured as zero.
+     */
+    private fun measureChars(fromIndex: Int, toIndex: Int): Float {
+        if (toIndex <= fromIndex) {
+            return 0.0f
+        }
+
+        val advanceSums = runs.advanceSums
+        return (advanceSums[toIndex] - advanceSums[fromIndex]).toFloat()
+    }
+
     private fun findForwardBreak(iterator: IntIterator, startIndex: Int, breakExtent: Float): Int {
         var forwardIndex = startIndex
         var measurement = 0.0f
 
         for (breakIndex in iterator) {
-            measurement += runs.measureChars(forwardIndex, breakIndex)
+            measurement += measureChars(forwardIndex, breakIndex)
             if (measurement > breakExtent) {
                 val wsStart = text.getTrailingWhitespaceStart(forwardIndex, breakIndex)
-                val wsExtent = runs.measureChars(wsStart, breakIndex)
+                val wsExtent = measureChars(wsStart, breakIndex)
 
                 // Break if excluding whitespace extent helps.
                 if ((measurement - wsExtent) <= breakExtent) {
@@ -56,10 +69,10 @@ internal class BreakResolver(
         var measurement = 0.0f
 
         for (breakIndex in iterator) {
-            measurement += runs.measureChars(breakIndex, backwardIndex)
+            measurement += measureChars(breakIndex, backwardIndex)
             if (measurement > breakExtent) {
                 val wsStart = text.getTrailingWhitespaceStart(breakIndex, backwardIndex)
-                val wsExtent = runs.measureChars(wsStart, breakIndex)
+                val wsExtent = measureChars(wsStart, breakIndex)
 
                 // Break if excluding whitespace extent helps.
                 if ((measurement - wsExtent) <= breakExtent) {
@@ -167,4 +180,40 @@ internal class BreakResolver(
             BreakMode.LINE -> suggestBackwardLineBreak(startIndex, endIndex, breakExtent)
         }
     }
+
+    fun suggestForwardLineBreaks(
+        startIndex: Int, endIndex: Int,
+        leadingExtent: Float, leadingLines: Int,
+        trailingExtent: Float, maxLines: Int
+    ): IntArray {
+        val paragraph = paragraphs.getParagraph(startIndex)
+        val maxIndex = min(endIndex, paragraph.charEnd)
+
+        return LineBreaker.breakLines(
+            breaks.text, breaks.breakData, runs.advanceSums,
+            startIndex, maxIndex,
+            leadingExtent, leadingLines,
+            trailingExtent, maxLines
+        )
+    }
+
+    fun suggestOptimalLineBreaks(
+        startIndex: Int, endIndex: Int,
+        leadingExtent: Float, leadingLimit: Float, leadingLines: Int,
+        trailingExtent: Float, trailingLimit: Float,
+        hyphenPenalty: Float, widowPenalty: Float, tightnessPenalty: Float,
+        lookahead: Int, maxLines: Int
+    ): IntArray {
+        val paragraph = paragraphs.getParagraph(startIndex)
+        val maxIndex = min(endIndex, paragraph.charEnd)
+
+        return LineBreaker.breakLinesOptimally(
+            breaks.text, breaks.breakData, runs.advanceSums,
+            startIndex, maxIndex,
+            leadingExtent, leadingLimit, leadingLines,
+            trailingExtent, trailingLimit,
+            hyphenPenalty, widowPenalty, tightnessPenalty,
+            lookahead, maxLines
+        )
+    }
 }
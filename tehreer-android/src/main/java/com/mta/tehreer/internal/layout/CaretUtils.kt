@@ -51,40 +51,39 @@ internal object CaretUtils {
     ): Int {
         val leftMargin = getLeftMargin(caretEdges, isRTL, firstIndex, lastIndex)
 
-        var leadingIndex = -1
-        var trailingIndex = -1
-
-        var leadingEdge = 0.0f
-        var trailingEdge = 0.0f
-
-        var index = if (isRTL) lastIndex else firstIndex
-        val next = if (isRTL) -1 else 1
-
-        while (index <= lastIndex && index >= firstIndex) {
-            val caretEdge = caretEdges[index] - leftMargin
-
-            if (caretEdge <= distance) {
-                leadingIndex = index
-                leadingEdge = caretEdge
+        // Caret edges grow from left to right, i.e. backward for RTL, so visit them in visual
+        // order and search the first one lying beyond the input distance.
+        val edgeCount = lastIndex - firstIndex + 1
+        val visualIndex = { position: Int -> if (isRTL) lastIndex - position else firstIndex + position }
+
+        var low = 0
+        var high = edgeCount
+
+        while (low < high) {
+            val mid = (low + high) ushr 1
+            if (caretEdges[visualIndex(mid)] - leftMargin <= distance) {
+                low = mid + 1
             } else {
-                trailingIndex = index
-                trailingEdge = caretEdge
-                break
+                high = mid
             }
-
-            index += next
         }
 
-        if (leadingIndex == -1) {
+        if (low == 0) {
             // Nothing is covered by the input distance.
             return firstIndex
         }
 
-        if (trailingIndex == -1) {
+        if (low == edgeCount) {
             // Whole range is covered by the input distance.
             return lastIndex
         }
 
+        val leadingIndex = visualIndex(low - 1)
+        val trailingIndex = visualIndex(low)
+
+        val leadingEdge = caretEdges[leadingIndex] - leftMargin
+        val trailingEdge = caretEdges[trailingIndex] - leftMargin
+
         return if (distance <= (leadingEdge + trailingEdge) / 2.0f) {
             // Input distance is closer to first edge.
             leadingIndex
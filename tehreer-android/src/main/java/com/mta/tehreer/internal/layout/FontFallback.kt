@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.internal.layout
+
+import com.mta.tehreer.graphics.Typeface
+import com.mta.tehreer.internal.JniBridge
+
+internal object FontFallback {
+    init {
+        JniBridge.loadLibrary()
+    }
+
+    /**
+     * Splits the specified range into runs of grapheme clusters that can be displayed by the same
+     * typeface. The first typeface is preferred for every cluster, followed by the typeface of
+     * previous cluster and then the rest in order. The coverage of each typeface is built from its
+     * character map on first use.
+     *
+     * @param text The source text.
+     * @param charStart The index to the first character of the range.
+     * @param charEnd The index after the last character of the range.
+     * @param typefaces The typefaces in the order of preference.
+     * @return An array of pairs, each containing the end of a run and the index of its typeface.
+     */
+    @JvmStatic external fun segment(
+        text: String, charStart: Int, charEnd: Int,
+        typefaces: Array<Typeface>
+    ): IntArray
+
+    /**
+     * Finds the typefaces whose coverage contains the specified code point in a single pass over
+     * their native coverage sets.
+     *
+     * @param codePoint The code point to look for.
+     * @param typefaces The typefaces to check.
+     * @return The indexes of the covering typefaces in ascending order.
+     */
+    @JvmStatic external fun findCovering(codePoint: Int, typefaces: Array<Typeface>): IntArray
+}
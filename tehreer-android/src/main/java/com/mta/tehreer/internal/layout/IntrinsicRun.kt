@@ -136,6 +136,13 @@ internal class IntrinsicRun(
         return CaretUtils.getLeftMargin(caretEdges, isRTL, firstIndex, lastIndex)
     }
 
+    fun shifted(charShift: Int) = IntrinsicRun(
+        startIndex + charShift, endIndex + charShift,
+        isBackward, bidiLevel, writingDirection,
+        typeface, typeSize, ascent, descent, leading,
+        glyphIds, glyphOffsets, glyphAdvances, clusterMap, caretEdges
+    )
+
     public override fun computeNearestCharIndex(
         distance: Float,
         fromIndex: Int,
@@ -24,6 +24,7 @@ import com.mta.tehreer.collections.PointList
 import com.mta.tehreer.graphics.Renderer
 import com.mta.tehreer.graphics.Typeface
 import com.mta.tehreer.internal.graphics.DefaultTextRunDrawing
+import com.mta.tehreer.internal.graphics.KashidaTextRunDrawing
 import com.mta.tehreer.internal.util.Preconditions.checkElementIndex
 import com.mta.tehreer.internal.util.Preconditions.checkIndexRange
 import com.mta.tehreer.internal.util.Preconditions.checkNotNull
@@ -32,7 +33,9 @@ import com.mta.tehreer.internal.util.toFloatList
 
 internal class JustifiedRun(
     private val textRun: TextRun,
-    justifiedAdvances: FloatList
+    justifiedAdvances: FloatList,
+    private val kashidaGlyphId: Int = 0,
+    private val kashidaWidths: FloatArray? = null
 ) : AbstractTextRun() {
     override val glyphAdvances: FloatList
     override val caretEdges: FloatList
@@ -169,8 +172,14 @@ internal class JustifiedRun(
         return textRun.getTrailingGlyphIndex(charIndex)
     }
 
+    private val kashidaDrawing by lazy {
+        kashidaWidths?.let { KashidaTextRunDrawing(this, kashidaGlyphId, it) }
+    }
+
     override fun draw(renderer: Renderer, canvas: Canvas) {
         val drawing = DefaultTextRunDrawing(this)
         drawing.draw(renderer, canvas)
+
+        kashidaDrawing?.draw(renderer, canvas)
     }
 }
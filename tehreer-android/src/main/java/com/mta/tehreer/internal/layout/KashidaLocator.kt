@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.internal.layout
+
+import com.mta.tehreer.graphics.Typeface
+import com.mta.tehreer.internal.JniBridge
+import com.mta.tehreer.sfnt.ShapingEngine
+import com.mta.tehreer.sfnt.ShapingResult
+import com.mta.tehreer.sfnt.WritingDirection
+import com.mta.tehreer.unicode.Script
+import java.util.WeakHashMap
+
+internal object KashidaLocator {
+    init {
+        JniBridge.loadLibrary()
+    }
+
+    const val TATWEEL = 0x0640
+
+    // A tatweel joined on both sides, so that the font substitutes its medial form.
+    private const val TATWEEL_CONTEXT = "\u0628\u0640\u0628"
+
+    private val tatweelGlyphIds = WeakHashMap<Typeface, Int>()
+
+    /**
+     * Returns the glyph that the typeface draws for a tatweel between two joined letters, after
+     * applying its GSUB substitutions, or zero if the typeface has no tatweel. The result is
+     * cached for each typeface.
+     */
+    fun getTatweelGlyphId(typeface: Typeface): Int {
+        synchronized(tatweelGlyphIds) {
+            tatweelGlyphIds[typeface]?.let { return it }
+        }
+
+        val glyphId = resolveTatweelGlyphId(typeface)
+
+        synchronized(tatweelGlyphIds) {
+            tatweelGlyphIds[typeface] = glyphId
+        }
+
+        return glyphId
+    }
+
+    private fun resolveTatweelGlyphId(typeface: Typeface): Int {
+        val nominalId = typeface.getGlyphId(TATWEEL)
+        if (nominalId == 0) {
+            return 0
+        }
+
+        val shapingEngine = ShapingEngine()
+        var shapingResult: ShapingResult? = null
+
+        try {
+            shapingEngine.typeface = typeface
+            shapingEngine.typeSize = typeface.unitsPerEm.toFloat()
+            shapingEngine.scriptTag = Script.getOpenTypeTag(Script.ARABIC)
+            shapingEngine.writingDirection = WritingDirection.RIGHT_TO_LEFT
+
+            shapingResult = shapingEngine.shapeText(TATWEEL_CONTEXT, 0, TATWEEL_CONTEXT.length)
+
+            val clusterMap = shapingResult.clusterMap
+            val glyphIndex = clusterMap[1]
+
+            // A tatweel merged into a ligature cannot be repeated on its own.
+            if (glyphIndex != clusterMap[0] && glyphIndex != clusterMap[2]) {
+                return shapingResult.glyphIds[glyphIndex]
+            }
+        } finally {
+            shapingResult?.dispose()
+            shapingEngine.dispose()
+        }
+
+        return nominalId
+    }
+
+    /**
+     * Finds the best kashida opportunity of each word in the specified range. An opportunity lies
+     * between two joined letters that do not form a ligature. Opportunities are ranked by joining
+     * group, from after an existing tatweel (1) down to before a medial Beh (7).
+     *
+     * @param text The source text.
+     * @param charStart The index to the first character of the range.
+     * @param charEnd The index after the last character of the range.
+     * @param clusterMap The index of leading glyph of each character in the range.
+     * @return An array of pairs, each containing the index of the character before which the
+     *         kashida should be placed and its priority.
+     */
+    @JvmStatic external fun locate(
+        text: String, charStart: Int, charEnd: Int,
+        clusterMap: IntArray
+    ): IntArray
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.internal.layout
+
+import com.mta.tehreer.internal.JniBridge
+
+internal object LineBreaker {
+    init {
+        JniBridge.loadLibrary()
+    }
+
+    /**
+     * Breaks the specified range of a paragraph into lines in a single pass.
+     *
+     * @param text The source text.
+     * @param breakData The break flags of each code unit as resolved by `BreakClassifier`.
+     * @param advanceSums The cumulative advances of code units as resolved by `RunCollection`.
+     * @param charStart The index to the first character of the range.
+     * @param charEnd The index after the last character of the range.
+     * @param leadingExtent The break extent of leading lines.
+     * @param leadingLines The number of leading lines.
+     * @param trailingExtent The break extent of remaining lines.
+     * @param maxLines The maximum number of lines to produce.
+     * @return An array containing the end index (exclusive) of each line.
+     */
+    @JvmStatic external fun breakLines(
+        text: String, breakData: ByteArray, advanceSums: DoubleArray,
+        charStart: Int, charEnd: Int,
+        leadingExtent: Float, leadingLines: Int,
+        trailingExtent: Float, maxLines: Int
+    ): IntArray
+
+    /**
+     * Breaks the specified range of a paragraph into lines by minimizing the total demerits of
+     * all lines. The demerits of a line are 100 times the square of its unused fraction, plus
+     * the applicable penalties. The last line of the paragraph is not charged for unused space.
+     *
+     * @param leadingExtent The desired extent of leading lines.
+     * @param leadingLimit The maximum extent of leading lines.
+     * @param trailingExtent The desired extent of remaining lines.
+     * @param trailingLimit The maximum extent of remaining lines.
+     * @param hyphenPenalty The penalty of breaking a line after a hyphen.
+     * @param widowPenalty The penalty of a single word in the last line of the paragraph.
+     * @param tightnessPenalty The penalty of a line exceeding its desired extent.
+     * @param lookahead The number of lines to optimize together, or zero for whole paragraph.
+     * @param maxLines The maximum number of lines to produce.
+     * @return An array containing the end index (exclusive) of each line.
+     */
+    @JvmStatic external fun breakLinesOptimally(
+        text: String, breakData: ByteArray, advanceSums: DoubleArray,
+        charStart: Int, charEnd: Int,
+        leadingExtent: Float, leadingLimit: Float, leadingLines: Int,
+        trailingExtent: Float, trailingLimit: Float,
+        hyphenPenalty: Float, widowPenalty: Float, tightnessPenalty: Float,
+        lookahead: Int, maxLines: Int
+    ): IntArray
+}
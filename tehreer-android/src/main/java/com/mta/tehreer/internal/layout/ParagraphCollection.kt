@@ -17,13 +17,11 @@
 package com.mta.tehreer.internal.layout
 
 import com.mta.tehreer.internal.util.isOdd
-import com.mta.tehreer.unicode.BidiParagraph
-import com.mta.tehreer.unicode.BidiRun
 import java.util.ArrayList
 import kotlin.math.max
 import kotlin.math.min
 
-internal class ParagraphCollection : ArrayList<BidiParagraph>() {
+internal class ParagraphCollection : ArrayList<TextParagraph>() {
     fun binarySearch(charIndex: Int): Int {
         var low = 0
         var high = size - 1
@@ -49,7 +47,7 @@ internal class ParagraphCollection : ArrayList<BidiParagraph>() {
     fun getBaseLevel(charIndex: Int) = getParagraph(charIndex).baseLevel
 
     interface RunConsumer {
-        fun accept(bidiRun: BidiRun)
+        fun accept(visualStart: Int, visualEnd: Int, embeddingLevel: Byte)
     }
 
     fun forEachLineRun(lineStart: Int, lineEnd: Int, runConsumer: RunConsumer) {
@@ -69,24 +67,24 @@ internal class ParagraphCollection : ArrayList<BidiParagraph>() {
         var feasibleEnd: Int
 
         do {
-            val bidiParagraph = this[paragraphIndex]
-
-            feasibleStart = max(bidiParagraph.charStart, lineStart)
-            feasibleEnd = min(bidiParagraph.charEnd, lineEnd)
-
-            val bidiLine = bidiParagraph.createLine(feasibleStart, feasibleEnd)
-            for (bidiRun in bidiLine.visualRuns) {
-                runConsumer.accept(bidiRun)
+            val paragraph = this[paragraphIndex]
+            val charShift = paragraph.charShift
+
+            feasibleStart = max(paragraph.charStart, lineStart)
+            feasibleEnd = min(paragraph.charEnd, lineEnd)
+
+            val bidiLine = paragraph.bidiParagraph.createLine(feasibleStart - charShift, feasibleEnd - charShift)
+            val runArray = bidiLine.visualRunArray
+            for (i in runArray.indices step 3) {
+                runConsumer.accept(
+                    runArray[i] + charShift,
+                    runArray[i + 1] + charShift,
+                    runArray[i + 2].toByte()
+                )
             }
 
             bidiLine.dispose()
             paragraphIndex += next
         } while (if (isRTL) feasibleStart != lineStart else feasibleEnd != lineEnd)
     }
-
-    protected fun finalize() {
-        for (i in 0 until size) {
-            this[i].dispose()
-        }
-    }
 }
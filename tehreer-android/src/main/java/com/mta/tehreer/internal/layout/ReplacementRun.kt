@@ -135,6 +135,13 @@ internal class ReplacementRun(
         return RectF(0.0f, 0.0f, width, height)
     }
 
+    fun shifted(charSequence: CharSequence, charShift: Int) = ReplacementRun(
+        charSequence, startIndex + charShift, endIndex + charShift,
+        bidiLevel, replacementSpan, paint, typeface, typeSize,
+        replacementAscent, replacementDescent, replacementLeading, replacementExtent,
+        caretEdges
+    )
+
     override fun draw(renderer: Renderer, canvas: Canvas) {
         replacementSpan.draw(
             canvas,
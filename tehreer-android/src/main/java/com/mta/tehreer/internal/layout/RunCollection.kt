@@ -20,6 +20,40 @@ import java.util.ArrayList
 import kotlin.math.min
 
 internal class RunCollection : ArrayList<TextRun>() {
+    private val lazyAdvanceSums = lazy { buildAdvanceSums() }
+
+    /**
+     * The cumulative advances of all code units, where the extent of range `[i, j)` is equal to
+     * `advanceSums[j] - advanceSums[i]`. It must only be accessed after all runs have been added.
+     *
+     * The sums are kept in double precision so that the extent of a range remains exact to a
+     * sub-pixel even when the preceding text accumulates to millions of pixels.
+     */
+    val advanceSums: DoubleArray by lazyAdvanceSums
+
+    private var previousSums: DoubleArray? = null
+    private var shapedStart = 0
+    private var shapedEnd = 0
+    private var charShift = 0
+
+    /**
+     * Derives the advance sums outside the shaped range from the runs of previous text, if they
+     * have already been computed, instead of measuring every character again.
+     *
+     * @param previous The runs of the text before the edit.
+     * @param shapedStart The start of the range whose runs have been shaped again.
+     * @param shapedEnd The end of the range whose runs have been shaped again.
+     * @param charShift The difference between the lengths of new and previous text.
+     */
+    fun reuseAdvanceSums(previous: RunCollection, shapedStart: Int, shapedEnd: Int, charShift: Int) {
+        if (previous.lazyAdvanceSums.isInitialized()) {
+            this.previousSums = previous.advanceSums
+            this.shapedStart = shapedStart
+            this.shapedEnd = shapedEnd
+            this.charShift = charShift
+        }
+    }
+
     fun binarySearch(charIndex: Int): Int {
         var low = 0
         var high = size - 1
@@ -59,4 +93,45 @@ internal class RunCollection : ArrayList<TextRun>() {
 
         return extent
     }
+
+    private fun buildAdvanceSums(): DoubleArray {
+        val charCount = if (isEmpty()) 0 else this[size - 1].endIndex
+        val advanceSums = DoubleArray(charCount + 1)
+
+        val previousSums = previousSums
+        if (previousSums == null) {
+            accumulateAdvances(advanceSums, 0, charCount)
+        } else {
+            System.arraycopy(previousSums, 0, advanceSums, 0, shapedStart + 1)
+            accumulateAdvances(advanceSums, shapedStart, shapedEnd)
+
+            val offset = advanceSums[shapedEnd] - previousSums[shapedEnd - charShift]
+            for (charIndex in shapedEnd + 1..charCount) {
+                advanceSums[charIndex] = previousSums[charIndex - charShift] + offset
+            }
+
+            this.previousSums = null
+        }
+
+        return advanceSums
+    }
+
+    private fun accumulateAdvances(advanceSums: DoubleArray, charStart: Int, charEnd: Int) {
+        var distance = advanceSums[charStart]
+        var runIndex = if (charStart < charEnd) binarySearch(charStart) else size
+
+        while (runIndex < size) {
+            val textRun = this[runIndex]
+            if (textRun.startIndex >= charEnd) {
+                break
+            }
+
+            for (charIndex in textRun.startIndex until textRun.endIndex) {
+                distance += textRun.getRangeDistance(charIndex, charIndex + 1).toDouble()
+                advanceSums[charIndex + 1] = distance
+            }
+
+            runIndex++
+        }
+    }
 }
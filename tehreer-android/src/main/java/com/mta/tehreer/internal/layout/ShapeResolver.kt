@@ -19,6 +19,7 @@ package com.mta.tehreer.internal.layout
 import android.graphics.Paint
 import android.graphics.Paint.FontMetricsInt
 import android.text.Spanned
+import com.mta.tehreer.graphics.Typeface
 import com.mta.tehreer.internal.util.Preconditions.checkArgument
 import com.mta.tehreer.internal.util.isEven
 import com.mta.tehreer.internal.util.isOdd
@@ -30,50 +31,182 @@ import com.mta.tehreer.sfnt.ShapingOrder
 import com.mta.tehreer.sfnt.ShapingResult
 import com.mta.tehreer.sfnt.WritingDirection
 import com.mta.tehreer.unicode.*
+import kotlin.math.max
+import kotlin.math.min
+
+private class ScaledMetrics(val typeface: Typeface, val typeSize: Float, isVertical: Boolean) {
+    val ascent: Float
+    val descent: Float
+    val leading: Float
+
+    init {
+        val sizeByEm = typeSize / typeface.unitsPerEm
+        val scaledAscent = typeface.ascent * sizeByEm
+        val scaledDescent = typeface.descent * sizeByEm
+
+        if (isVertical) {
+            // Vertical glyphs are centered on the line, so split the line height evenly.
+            ascent = (scaledAscent + scaledDescent) / 2.0f
+            descent = ascent
+        } else {
+            ascent = scaledAscent
+            descent = scaledDescent
+        }
+        leading = typeface.leading * sizeByEm
+    }
+}
 
 internal class ShapeResolver(
     private val text: String,
     private val spanned: Spanned,
-    private val defaultSpans: List<Any>
+    private val defaultSpans: List<Any>,
+    private val isVertical: Boolean = false
 ) {
+    /**
+     * The metrics of the typefaces used so far, scaled to their sizes. A text mostly uses a few
+     * combinations, so a list is scanned instead of hashing each lookup.
+     */
+    private val scaledMetrics = ArrayList<ScaledMetrics>()
+
+    /**
+     * The start of the text range that was shaped by the last call, in source text.
+     */
+    var shapedStart = 0
+        private set
+
+    /**
+     * The end of the text range that was shaped by the last call, in source text.
+     */
+    var shapedEnd = 0
+        private set
+
     fun createParagraphsAndRuns(): Pair<ParagraphCollection, RunCollection> {
         val paragraphs = ParagraphCollection()
         val runs = RunCollection()
 
+        resolveParagraphs(paragraphs, runs, 0, text.length)
+
+        shapedStart = 0
+        shapedEnd = text.length
+
+        return Pair(paragraphs, runs)
+    }
+
+    /**
+     * Creates paragraphs and runs for an edited text. Only the paragraphs touched by the edit are
+     * resolved again, the paragraphs and runs before them are kept as they are and the ones after
+     * them are shifted by the length difference of the edit. The spans outside the edited range
+     * must not have been changed.
+     *
+     * @param previousParagraphs The paragraphs of the text before the edit.
+     * @param previousRuns The runs of the text before the edit.
+     * @param editStart The index at which the edit starts.
+     * @param oldEnd The end of edited range in the text before the edit.
+     * @param newEnd The end of edited range in the text after the edit.
+     */
+    fun createParagraphsAndRuns(
+        previousParagraphs: ParagraphCollection, previousRuns: RunCollection,
+        editStart: Int, oldEnd: Int, newEnd: Int
+    ): Pair<ParagraphCollection, RunCollection> {
+        val charShift = newEnd - oldEnd
+        val previousLength = previousParagraphs[previousParagraphs.size - 1].charEnd
+
+        // A paragraph ending at the edit start is resolved again, as the edit may join its
+        // separator with the next character, like CR and LF.
+        val firstIndex = previousParagraphs.binarySearch(max(editStart - 1, 0))
+        val lastIndex = previousParagraphs.binarySearch(min(oldEnd, previousLength - 1))
+
+        // The unchanged separators before and after the range keep it a paragraph boundary.
+        val dirtyStart = previousParagraphs[firstIndex].charStart
+        val previousEnd = previousParagraphs[lastIndex].charEnd
+        val dirtyEnd = previousEnd + charShift
+
+        val paragraphs = ParagraphCollection()
+        val runs = RunCollection()
+
+        paragraphs.addAll(previousParagraphs.subList(0, firstIndex))
+        runs.addAll(previousRuns.subList(0, previousRuns.binarySearch(dirtyStart)))
+
+        resolveParagraphs(paragraphs, runs, dirtyStart, dirtyEnd)
+
+        for (i in lastIndex + 1 until previousParagraphs.size) {
+            paragraphs.add(previousParagraphs[i].shifted(charShift))
+        }
+
+        if (previousEnd < previousLength) {
+            for (i in previousRuns.binarySearch(previousEnd) until previousRuns.size) {
+                runs.add(
+                    when (val textRun = previousRuns[i]) {
+                        is ReplacementRun -> textRun.shifted(spanned, charShift)
+                        is IntrinsicRun -> textRun.shifted(charShift)
+                        else -> ShiftedRun.of(textRun, charShift)
+                    }
+                )
+            }
+        }
+
+        runs.reuseAdvanceSums(previousRuns, dirtyStart, dirtyEnd, charShift)
+
+        shapedStart = dirtyStart
+        shapedEnd = dirtyEnd
+
+        return Pair(paragraphs, runs)
+    }
+
+    /**
+     * Resolves the paragraphs of the specified range and shapes their runs. The range must start
+     * and end at paragraph boundaries. The paragraphs are resolved independently of the rest of
+     * the text, so that they lay out the same way wherever they end up after an edit.
+     */
+    private fun resolveParagraphs(
+        paragraphs: ParagraphCollection, runs: RunCollection,
+        charStart: Int, charEnd: Int
+    ) {
         var bidiAlgorithm: BidiAlgorithm? = null
         var shapingEngine: ShapingEngine? = null
 
         try {
-            bidiAlgorithm = BidiAlgorithm(text)
+            val rangeText = text.substring(charStart, charEnd)
+
+            bidiAlgorithm = BidiAlgorithm(rangeText)
             shapingEngine = ShapingEngine()
 
-            val scriptClassifier = ScriptClassifier(text)
             val runLocator = ShapingRunLocator(spanned, defaultSpans)
 
             var paragraphStart = 0
-            val suggestedEnd = text.length
+            val suggestedEnd = rangeText.length
 
             while (paragraphStart != suggestedEnd) {
-                val paragraph = bidiAlgorithm.createParagraph(
-                    paragraphStart,
-                    suggestedEnd,
-                    BaseDirection.DEFAULT_LEFT_TO_RIGHT
+                val bidiParagraph = BidiParagraph.finalizable(
+                    bidiAlgorithm.createParagraph(
+                        paragraphStart,
+                        suggestedEnd,
+                        BaseDirection.DEFAULT_LEFT_TO_RIGHT
+                    )
                 )
+                val paragraph = TextParagraph(bidiParagraph, charStart)
+
+                val scriptOffset = paragraph.charStart
+                val scriptClassifier = ScriptClassifier(text.substring(scriptOffset, paragraph.charEnd))
 
-                for (bidiRun in paragraph.logicalRuns) {
+                for (bidiRun in bidiParagraph.logicalRuns) {
                     for (scriptRun in scriptClassifier.getScriptRuns(
-                        bidiRun.charStart,
-                        bidiRun.charEnd
+                        bidiRun.charStart + charStart - scriptOffset,
+                        bidiRun.charEnd + charStart - scriptOffset
                     )) {
                         val scriptTag = Script.getOpenTypeTag(scriptRun.script)
-                        val writingDirection = ShapingEngine.getScriptDirection(scriptTag)
+                        val writingDirection = if (isVertical) {
+                            WritingDirection.TOP_TO_BOTTOM
+                        } else {
+                            ShapingEngine.getScriptDirection(scriptTag)
+                        }
 
                         val isRTL = bidiRun.isRightToLeft
-                        val isBackward = ((isRTL && writingDirection == WritingDirection.LEFT_TO_RIGHT)
+                        val isBackward = ((isRTL && writingDirection != WritingDirection.RIGHT_TO_LEFT)
                                       or (!isRTL && writingDirection == WritingDirection.RIGHT_TO_LEFT))
                         val shapingOrder = if (isBackward) ShapingOrder.BACKWARD else ShapingOrder.FORWARD
 
-                        runLocator.reset(scriptRun.charStart, scriptRun.charEnd)
+                        runLocator.reset(scriptRun.charStart + scriptOffset, scriptRun.charEnd + scriptOffset)
 
                         shapingEngine.scriptTag = scriptTag
                         shapingEngine.writingDirection = writingDirection
@@ -82,16 +215,14 @@ internal class ShapeResolver(
                         resolveTypefaces(runs, runLocator, shapingEngine, bidiRun.embeddingLevel)
                     }
                 }
-                paragraphs.add(paragraph)
 
-                paragraphStart = paragraph.charEnd
+                paragraphs.add(paragraph)
+                paragraphStart = bidiParagraph.charEnd
             }
         } finally {
             shapingEngine?.dispose()
             bidiAlgorithm?.dispose()
         }
-
-        return Pair(paragraphs, runs)
     }
 
     private fun resolveTypefaces(
@@ -112,70 +243,24 @@ internal class ShapeResolver(
                 "No typeface is specified for range [$runStart, $runEnd)"
             )
 
-            val typeSize = runLocator.typeSize
-            val sizeByEm = typeSize / typeface!!.unitsPerEm
-            val ascent = typeface.ascent * sizeByEm
-            val descent = typeface.descent * sizeByEm
-            val leading = typeface.leading * sizeByEm
-
             val replacement = runLocator.replacement
-            var textRun: TextRun
-
             if (replacement == null) {
-                shapingEngine.typeface = typeface
-                shapingEngine.typeSize = typeSize
-
-                var shapingResult: ShapingResult? = null
-
-                try {
-                    shapingResult = shapingEngine.shapeText(text, runStart, runEnd)
-
-                    val writingDirection = shapingEngine.writingDirection
-                    val isBackward = shapingResult.isBackward
-                    val glyphIds = shapingResult.glyphIds.toArray()
-                    val offsets = shapingResult.glyphOffsets.toArray()
-                    val advances = shapingResult.glyphAdvances.toArray()
-                    val clusterMap = shapingResult.clusterMap.toArray()
-                    val caretEdges = shapingResult.getCaretEdges(null)
-
-                    val scaleX = runLocator.scaleX
-                    if (scaleX.compareTo(1.0f) != 0) {
-                        for (i in glyphIds.indices) {
-                            offsets[i * 2] *= scaleX
-                            advances[i] *= scaleX
-                        }
+                val fallbacks = runLocator.fallbacks
 
-                        for (i in caretEdges.indices) {
-                            caretEdges[i] *= scaleX
-                        }
-                    }
+                if (fallbacks.isNullOrEmpty()) {
+                    runs.add(shapeRun(runLocator, shapingEngine, bidiLevel, typeface!!, runStart, runEnd))
+                } else {
+                    val typefaces = arrayOf(typeface!!) + fallbacks
+                    val segments = FontFallback.segment(text, runStart, runEnd, typefaces)
+                    var segmentStart = runStart
 
-                    val baselineShift = runLocator.baselineShift
-                    if (baselineShift.compareTo(0.0f) != 0) {
-                        for (i in glyphIds.indices) {
-                            offsets[i * 2 + 1] += baselineShift
-                        }
-                    }
+                    for (i in segments.indices step 2) {
+                        val segmentEnd = segments[i]
+                        val segmentTypeface = typefaces[segments[i + 1]]
 
-                    textRun = IntrinsicRun(
-                        startIndex = runStart,
-                        endIndex = runEnd,
-                        isBackward = isBackward,
-                        bidiLevel = bidiLevel,
-                        writingDirection = writingDirection,
-                        typeface = typeface,
-                        typeSize = typeSize,
-                        ascent = ascent,
-                        descent = descent,
-                        leading = leading,
-                        glyphIds = glyphIds.toIntList(),
-                        glyphOffsets = offsets.toPointList(),
-                        glyphAdvances = advances.toFloatList(),
-                        clusterMap = clusterMap.toIntList(),
-                        caretEdges = caretEdges.toFloatList()
-                    )
-                } finally {
-                    shapingResult?.dispose()
+                        runs.add(shapeRun(runLocator, shapingEngine, bidiLevel, segmentTypeface, segmentStart, segmentEnd))
+                        segmentStart = segmentEnd
+                    }
                 }
             } else {
                 if (paint == null) {
@@ -185,9 +270,12 @@ internal class ShapeResolver(
                     metrics = FontMetricsInt()
                 }
 
-                metrics.ascent = -(ascent + 0.5f).toInt()
-                metrics.descent = (descent + 0.5f).toInt()
-                metrics.leading = (leading + 0.5f).toInt()
+                val typeSize = runLocator.typeSize
+                val scaled = getScaledMetrics(typeface!!, typeSize)
+
+                metrics.ascent = -(scaled.ascent + 0.5f).toInt()
+                metrics.descent = (scaled.descent + 0.5f).toInt()
+                metrics.leading = (scaled.leading + 0.5f).toInt()
 
                 val extent = replacement.getSize(paint, spanned, runStart, runEnd, metrics)
                 val runLength = runEnd - runStart
@@ -200,24 +288,108 @@ internal class ShapeResolver(
                     caretEdges[0] = extent.toFloat()
                 }
 
-                textRun = ReplacementRun(
-                    charSequence = spanned,
-                    startIndex = runStart,
-                    endIndex = runEnd,
-                    bidiLevel = bidiLevel,
-                    replacementSpan = replacement,
-                    paint = paint,
-                    typeface = typeface,
-                    typeSize = typeSize,
-                    replacementAscent = metrics.ascent,
-                    replacementDescent = metrics.descent,
-                    replacementLeading = metrics.leading,
-                    replacementExtent = extent,
-                    caretEdges = caretEdges.toFloatList()
+                runs.add(
+                    ReplacementRun(
+                        charSequence = spanned,
+                        startIndex = runStart,
+                        endIndex = runEnd,
+                        bidiLevel = bidiLevel,
+                        replacementSpan = replacement,
+                        paint = paint,
+                        typeface = typeface,
+                        typeSize = typeSize,
+                        replacementAscent = metrics.ascent,
+                        replacementDescent = metrics.descent,
+                        replacementLeading = metrics.leading,
+                        replacementExtent = extent,
+                        caretEdges = caretEdges.toFloatList()
+                    )
                 )
             }
+        }
+    }
+
+    private fun getScaledMetrics(typeface: Typeface, typeSize: Float): ScaledMetrics {
+        for (metrics in scaledMetrics) {
+            if (metrics.typeface === typeface && metrics.typeSize.compareTo(typeSize) == 0) {
+                return metrics
+            }
+        }
 
-            runs.add(textRun)
+        return ScaledMetrics(typeface, typeSize, isVertical).also { scaledMetrics.add(it) }
+    }
+
+    private fun shapeRun(
+        runLocator: ShapingRunLocator,
+        shapingEngine: ShapingEngine, bidiLevel: Byte,
+        typeface: Typeface, runStart: Int, runEnd: Int
+    ): TextRun {
+        val typeSize = runLocator.typeSize
+        val scaled = getScaledMetrics(typeface, typeSize)
+
+        shapingEngine.typeface = typeface
+        shapingEngine.typeSize = typeSize
+
+        var shapingResult: ShapingResult? = null
+
+        try {
+            shapingResult = shapingEngine.shapeText(text, runStart, runEnd)
+
+            val writingDirection = shapingEngine.writingDirection
+            val isBackward = shapingResult.isBackward
+            val glyphIds = shapingResult.glyphIds.toArray()
+            val offsets = shapingResult.glyphOffsets.toArray()
+            val advances = shapingResult.glyphAdvances.toArray()
+            val clusterMap = shapingResult.clusterMap.toArray()
+            val caretEdges = shapingResult.getCaretEdges(null)
+
+            // Vertical advances run across the glyphs, so horizontal scaling and baseline shift
+            // apply to the offsets only.
+            val scaleX = runLocator.scaleX
+            if (scaleX.compareTo(1.0f) != 0) {
+                for (i in glyphIds.indices) {
+                    offsets[i * 2] *= scaleX
+                }
+
+                if (!isVertical) {
+                    for (i in glyphIds.indices) {
+                        advances[i] *= scaleX
+                    }
+
+                    for (i in caretEdges.indices) {
+                        caretEdges[i] *= scaleX
+                    }
+                }
+            }
+
+            val baselineShift = runLocator.baselineShift
+            if (baselineShift.compareTo(0.0f) != 0) {
+                val shiftIndex = if (isVertical) 0 else 1
+
+                for (i in glyphIds.indices) {
+                    offsets[i * 2 + shiftIndex] += baselineShift
+                }
+            }
+
+            return IntrinsicRun(
+                startIndex = runStart,
+                endIndex = runEnd,
+                isBackward = isBackward,
+                bidiLevel = bidiLevel,
+                writingDirection = writingDirection,
+                typeface = typeface,
+                typeSize = typeSize,
+                ascent = scaled.ascent,
+                descent = scaled.descent,
+                leading = scaled.leading,
+                glyphIds = glyphIds.toIntList(),
+                glyphOffsets = offsets.toPointList(),
+                glyphAdvances = advances.toFloatList(),
+                clusterMap = clusterMap.toIntList(),
+                caretEdges = caretEdges.toFloatList()
+            )
+        } finally {
+            shapingResult?.dispose()
         }
     }
 }
@@ -29,6 +29,7 @@ import android.text.style.ScaleXSpan
 import android.text.style.SuperscriptSpan
 import android.text.style.SubscriptSpan
 import com.mta.tehreer.graphics.*
+import com.mta.tehreer.layout.style.FallbackSpan
 import com.mta.tehreer.layout.style.TypefaceSpan
 
 private class ShapingRun {
@@ -36,6 +37,7 @@ private class ShapingRun {
     var runEnd = 0
     var replacement: ReplacementSpan? = null
     var typeface: com.mta.tehreer.graphics.Typeface? = null
+    var fallbacks: List<com.mta.tehreer.graphics.Typeface>? = null
     var typeWeight = TypeWeight.REGULAR
     var typeSlope = TypeSlope.PLAIN
     var typeSize = 0f
@@ -62,6 +64,9 @@ private fun resolveSpans(shapingRun: ShapingRun, spans: Array<Any>) {
                 shapingRun.typeWeight = typeface.weight
                 shapingRun.typeSlope = typeface.slope
             }
+            is FallbackSpan -> {
+                shapingRun.fallbacks = span.typefaces
+            }
             is TypeSizeSpan -> {
                 shapingRun.typeSize = span.size
             }
@@ -175,6 +180,7 @@ internal class ShapingRunLocator(
             shapingRun.runStart = runStart
             shapingRun.runEnd = runEnd
             shapingRun.typeface = initial.typeface
+            shapingRun.fallbacks = initial.fallbacks
             shapingRun.typeWeight = initial.typeWeight
             shapingRun.typeSlope = initial.typeSlope
             shapingRun.typeSize = initial.typeSize
@@ -201,6 +207,7 @@ internal class ShapingRunLocator(
         // Merge runs of similar style.
         while (resolveRun(currentRun.runEnd).also { nextRun = it } != null) {
             if (currentRun.typeface === nextRun!!.typeface
+                && currentRun.fallbacks === nextRun!!.fallbacks
                 && currentRun.typeSize.compareTo(nextRun!!.typeSize) == 0
                 && currentRun.scaleX.compareTo(nextRun!!.scaleX) == 0
                 && currentRun.baselineShift.compareTo(nextRun!!.baselineShift) == 0
@@ -227,6 +234,9 @@ internal class ShapingRunLocator(
     val typeface: com.mta.tehreer.graphics.Typeface?
         get() = current!!.typeface
 
+    val fallbacks: List<com.mta.tehreer.graphics.Typeface>?
+        get() = current!!.fallbacks
+
     val typeSize: Float
         get() = current!!.typeSize
 
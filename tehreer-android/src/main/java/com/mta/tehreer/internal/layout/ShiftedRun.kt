@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.internal.layout
+
+import android.graphics.Canvas
+import android.graphics.RectF
+import com.mta.tehreer.collections.FloatList
+import com.mta.tehreer.collections.IntList
+import com.mta.tehreer.collections.PointList
+import com.mta.tehreer.graphics.Renderer
+import com.mta.tehreer.graphics.Typeface
+import com.mta.tehreer.sfnt.WritingDirection
+
+/**
+ * Presents a run at a different position in source text, so that it can be reused after an edit
+ * has moved its characters without reshaping them.
+ */
+internal class ShiftedRun private constructor(
+    private val textRun: TextRun,
+    private val charShift: Int
+) : TextRun {
+    companion object {
+        fun of(textRun: TextRun, charShift: Int): TextRun {
+            if (charShift == 0) {
+                return textRun
+            }
+            if (textRun is ShiftedRun) {
+                return of(textRun.textRun, textRun.charShift + charShift)
+            }
+
+            return ShiftedRun(textRun, charShift)
+        }
+    }
+
+    override val startIndex: Int
+        get() = textRun.startIndex + charShift
+
+    override val endIndex: Int
+        get() = textRun.endIndex + charShift
+
+    override val isBackward: Boolean
+        get() = textRun.isBackward
+
+    override val bidiLevel: Byte
+        get() = textRun.bidiLevel
+
+    override val spans: List<Any?>
+        get() = textRun.spans
+
+    override val startExtraLength: Int
+        get() = textRun.startExtraLength
+
+    override val endExtraLength: Int
+        get() = textRun.endExtraLength
+
+    override val typeface: Typeface
+        get() = textRun.typeface
+
+    override val typeSize: Float
+        get() = textRun.typeSize
+
+    override val writingDirection: WritingDirection
+        get() = textRun.writingDirection
+
+    override val glyphCount: Int
+        get() = textRun.glyphCount
+
+    override val glyphIds: IntList
+        get() = textRun.glyphIds
+
+    override val glyphOffsets: PointList
+        get() = textRun.glyphOffsets
+
+    override val glyphAdvances: FloatList
+        get() = textRun.glyphAdvances
+
+    override val clusterMap: IntList
+        get() = textRun.clusterMap
+
+    override val caretEdges: FloatList
+        get() = textRun.caretEdges
+
+    override val ascent: Float
+        get() = textRun.ascent
+
+    override val descent: Float
+        get() = textRun.descent
+
+    override val leading: Float
+        get() = textRun.leading
+
+    override val width: Float
+        get() = textRun.width
+
+    override val height: Float
+        get() = textRun.height
+
+    override fun getClusterStart(charIndex: Int): Int {
+        return textRun.getClusterStart(charIndex - charShift) + charShift
+    }
+
+    override fun getClusterEnd(charIndex: Int): Int {
+        return textRun.getClusterEnd(charIndex - charShift) + charShift
+    }
+
+    override fun getGlyphRangeForChars(fromIndex: Int, toIndex: Int): IntRange {
+        return textRun.getGlyphRangeForChars(fromIndex - charShift, toIndex - charShift)
+    }
+
+    override fun getLeadingGlyphIndex(charIndex: Int): Int {
+        return textRun.getLeadingGlyphIndex(charIndex - charShift)
+    }
+
+    override fun getTrailingGlyphIndex(charIndex: Int): Int {
+        return textRun.getTrailingGlyphIndex(charIndex - charShift)
+    }
+
+    override fun getCaretEdge(charIndex: Int): Float {
+        return textRun.getCaretEdge(charIndex - charShift)
+    }
+
+    override fun getRangeDistance(fromIndex: Int, toIndex: Int): Float {
+        return textRun.getRangeDistance(fromIndex - charShift, toIndex - charShift)
+    }
+
+    override fun computeNearestCharIndex(distance: Float): Int {
+        return textRun.computeNearestCharIndex(distance) + charShift
+    }
+
+    override fun computeBoundingBox(renderer: Renderer, glyphStart: Int, glyphEnd: Int): RectF {
+        return textRun.computeBoundingBox(renderer, glyphStart, glyphEnd)
+    }
+
+    override fun draw(renderer: Renderer, canvas: Canvas) {
+        textRun.draw(renderer, canvas)
+    }
+}
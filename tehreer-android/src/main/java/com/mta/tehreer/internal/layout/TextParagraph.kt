@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.internal.layout
+
+import com.mta.tehreer.unicode.BidiParagraph
+
+/**
+ * Places a bidi paragraph in source text. The paragraph may have been resolved for a part of the
+ * text, or for an earlier version of it, in which case its indexes are offset by the char shift.
+ * The bidi paragraph must be finalizable, as it can be shared by the layouts of several versions
+ * of a text.
+ */
+internal class TextParagraph(
+    val bidiParagraph: BidiParagraph,
+    val charShift: Int
+) {
+    val charStart = bidiParagraph.charStart + charShift
+    val charEnd = bidiParagraph.charEnd + charShift
+    val baseLevel = bidiParagraph.baseLevel
+
+    fun shifted(charShift: Int) = TextParagraph(bidiParagraph, this.charShift + charShift)
+}
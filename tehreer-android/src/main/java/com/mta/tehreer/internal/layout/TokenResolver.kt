@@ -16,11 +16,33 @@
 
 package com.mta.tehreer.internal.layout
 
+import android.text.SpannableString
+import com.mta.tehreer.graphics.Typeface
 import com.mta.tehreer.layout.TruncationPlace
 import com.mta.tehreer.layout.ComposedLine
 import com.mta.tehreer.layout.Typesetter
+import com.mta.tehreer.layout.WritingMode
+import com.mta.tehreer.layout.style.TypeSizeSpan
+import com.mta.tehreer.layout.style.TypefaceSpan
+import com.mta.tehreer.sfnt.WritingDirection
 
 internal object TokenResolver {
+    private const val MAX_CACHED_TOKENS = 16
+
+    private data class TokenKey(
+        val typeface: Typeface,
+        val typeSize: Float,
+        val tokenStr: String,
+        val isVertical: Boolean
+    )
+
+    // Tokens are immutable once created, so they are shared among all truncated lines.
+    private val tokenCache = object : LinkedHashMap<TokenKey, ComposedLine>(MAX_CACHED_TOKENS, 0.75f, true) {
+        override fun removeEldestEntry(eldest: MutableMap.MutableEntry<TokenKey, ComposedLine>?): Boolean {
+            return size > MAX_CACHED_TOKENS
+        }
+    }
+
     @JvmStatic
     fun createToken(
         runs: RunCollection,
@@ -38,6 +60,7 @@ internal object TokenResolver {
         val suitableRun = runs[runIndex]
         val tokenTypeface = suitableRun.typeface
         val tokenTypeSize = suitableRun.typeSize
+        val isVertical = suitableRun.writingDirection == WritingDirection.TOP_TO_BOTTOM
         var ellipsisStr = tokenStr.orEmpty()
 
         if (ellipsisStr.isEmpty()) {
@@ -48,7 +71,27 @@ internal object TokenResolver {
             ellipsisStr = if (ellipsisGlyphId == 0) "..." else "\u2026"
         }
 
-        val typesetter = Typesetter(ellipsisStr, tokenTypeface, tokenTypeSize)
-        return typesetter.createSimpleLine(0, ellipsisStr.length)
+        val tokenKey = TokenKey(tokenTypeface, tokenTypeSize, ellipsisStr, isVertical)
+
+        synchronized(tokenCache) {
+            tokenCache[tokenKey]?.let { return it }
+        }
+
+        val typesetter = if (isVertical) {
+            Typesetter(
+                SpannableString(ellipsisStr),
+                listOf<Any>(TypefaceSpan(tokenTypeface), TypeSizeSpan(tokenTypeSize)),
+                WritingMode.VERTICAL
+            )
+        } else {
+            Typesetter(ellipsisStr, tokenTypeface, tokenTypeSize)
+        }
+        val token = typesetter.createSimpleLine(0, ellipsisStr.length)
+
+        synchronized(tokenCache) {
+            tokenCache[tokenKey] = token
+        }
+
+        return token
     }
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.internal.sfnt
+
+import com.mta.tehreer.graphics.Typeface
+import com.mta.tehreer.internal.JniBridge.loadLibrary
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+internal class BufferTable(
+    /**
+     * Represents the source owning the buffer memory. Keep the source in memory so that it does
+     * not accidentally get disposed by the GC when in use.
+     */
+    private val source: Any?,
+    /**
+     * Represents a read-only buffer over the table bytes in big endian order.
+     */
+    private val buffer: ByteBuffer
+) : SfntTable {
+    override fun readBytes(offset: Int, count: Int): ByteArray {
+        val array = ByteArray(count)
+        val view = buffer.duplicate()
+        view.position(offset)
+        view.get(array)
+
+        return array
+    }
+
+    override fun readInt8(offset: Int): Byte {
+        return buffer.get(offset)
+    }
+
+    override fun readUInt8(offset: Int): Short {
+        return (buffer.get(offset).toInt() and 0xFF).toShort()
+    }
+
+    override fun readInt16(offset: Int): Short {
+        return buffer.getShort(offset)
+    }
+
+    override fun readUInt16(offset: Int): Int {
+        return buffer.getShort(offset).toInt() and 0xFFFF
+    }
+
+    override fun readInt32(offset: Int): Int {
+        return buffer.getInt(offset)
+    }
+
+    override fun readUInt32(offset: Int): Long {
+        return buffer.getInt(offset).toLong() and 0xFFFFFFFFL
+    }
+
+    override fun readInt64(offset: Int): Long {
+        return buffer.getLong(offset)
+    }
+
+    companion object {
+        init {
+            loadLibrary()
+        }
+
+        /**
+         * Returns the table of specified tag without copying it into the Java heap. The table is
+         * loaded once per typeface and shared by all later requests.
+         */
+        @JvmStatic
+        fun from(typeface: Typeface, tableTag: Int): BufferTable? {
+            val buffer = getTableBuffer(typeface, tableTag) ?: return null
+            return BufferTable(typeface, buffer.asReadOnlyBuffer().order(ByteOrder.BIG_ENDIAN))
+        }
+
+        @JvmStatic private external fun getTableBuffer(typeface: Typeface, tableTag: Int): ByteBuffer?
+    }
+}
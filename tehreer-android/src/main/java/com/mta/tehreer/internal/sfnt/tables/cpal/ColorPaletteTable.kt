@@ -16,7 +16,7 @@
 package com.mta.tehreer.internal.sfnt.tables.cpal
 
 import com.mta.tehreer.graphics.Typeface
-import com.mta.tehreer.internal.sfnt.DataTable
+import com.mta.tehreer.internal.sfnt.BufferTable
 import com.mta.tehreer.internal.sfnt.SfntTable
 import com.mta.tehreer.sfnt.SfntTag
 
@@ -91,10 +91,9 @@ internal class ColorPaletteTable(
 
     companion object {
         @JvmStatic
-        fun from(typeface: Typeface) = with(typeface) {
-            getTableData(SfntTag.make("CPAL"))?.let {
-                ColorPaletteTable(DataTable(it))
+        fun from(typeface: Typeface) =
+            BufferTable.from(typeface, SfntTag.make("CPAL"))?.let {
+                ColorPaletteTable(it)
             }
-        }
     }
 }
@@ -17,7 +17,7 @@
 package com.mta.tehreer.internal.sfnt.tables.fvar
 
 import com.mta.tehreer.graphics.Typeface
-import com.mta.tehreer.internal.sfnt.DataTable
+import com.mta.tehreer.internal.sfnt.BufferTable
 import com.mta.tehreer.internal.sfnt.SfntTable
 import com.mta.tehreer.sfnt.SfntTag
 
@@ -81,10 +81,9 @@ internal class FontVariationsTable(
 
     companion object {
         @JvmStatic
-        fun from(typeface: Typeface) = with(typeface) {
-            getTableData(SfntTag.make("fvar"))?.let {
-                FontVariationsTable(DataTable(it))
+        fun from(typeface: Typeface) =
+            BufferTable.from(typeface, SfntTag.make("fvar"))?.let {
+                FontVariationsTable(it)
             }
-        }
     }
 }
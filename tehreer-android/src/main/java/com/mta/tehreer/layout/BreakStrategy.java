@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.layout;
+
+/**
+ * Specifies the strategy for breaking paragraphs into lines.
+ */
+public enum BreakStrategy {
+    /**
+     * Breaks each line as soon as the next break opportunity does not fit in it.
+     */
+    GREEDY,
+    /**
+     * Chooses the breaks of a whole paragraph together so that the overall unused space of its
+     * lines, along with the configured penalties, is minimized. It produces evenly filled lines
+     * which look better when justified.
+     */
+    OPTIMAL
+}
@@ -19,6 +19,7 @@ package com.mta.tehreer.layout;
 import android.graphics.Canvas;
 import android.graphics.Paint;
 import android.graphics.Path;
+import android.graphics.Rect;
 import android.text.Layout;
 import android.text.Spanned;
 import android.text.style.LeadingMarginSpan;
@@ -26,10 +27,12 @@ import android.text.style.LineBackgroundSpan;
 
 import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
+import androidx.annotation.Size;
 
 import com.mta.tehreer.graphics.Renderer;
 import com.mta.tehreer.internal.Description;
 
+import java.util.Arrays;
 import java.util.Collections;
 import java.util.List;
 
@@ -40,6 +43,16 @@ import static com.mta.tehreer.internal.util.Preconditions.checkArgument;
  * from text-framing process performed by a typesetter object.
  */
 public class ComposedFrame {
+    private static final int RANGE_START = 0;
+    private static final int RANGE_END = 1;
+    private static final int RANGE_SIZE = 2;
+
+    private static final int EXTENT_TOP = 0;
+    private static final int EXTENT_BASELINE = 1;
+    private static final int EXTENT_BOTTOM = 2;
+    private static final int EXTENT_MAX_BOTTOM = 3;
+    private static final int EXTENT_SIZE = 4;
+
     private final CharSequence source;
     private final int frameStart;
     private final int frameEnd;
@@ -49,8 +62,13 @@ public class ComposedFrame {
     private float mOriginY;
     private float mWidth;
     private float mHeight;
+    private boolean mVertical;
+
+    private final @NonNull int[] lineRanges;
+    private final @NonNull float[] lineExtents;
 
     private @Nullable Paint paint;
+    private @Nullable Rect clipBounds;
 
     ComposedFrame(CharSequence source, int charStart, int charEnd,
                   @NonNull List<ComposedLine> lineList) {
@@ -58,6 +76,29 @@ public class ComposedFrame {
         this.frameStart = charStart;
         this.frameEnd = charEnd;
         this.lineList = Collections.unmodifiableList(lineList);
+
+        int lineCount = lineList.size();
+        float maxBottom = Float.NEGATIVE_INFINITY;
+
+        this.lineRanges = new int[lineCount * RANGE_SIZE];
+        this.lineExtents = new float[lineCount * EXTENT_SIZE];
+
+        // Keep the ranges and vertical extents of all lines in flat arrays, so that searching and
+        // drawing the lines do not need to go through each line object.
+        for (int i = 0; i < lineCount; i++) {
+            ComposedLine line = lineList.get(i);
+            int rangeIndex = i * RANGE_SIZE;
+            int extentIndex = i * EXTENT_SIZE;
+
+            maxBottom = Math.max(maxBottom, line.getBottom());
+
+            lineRanges[rangeIndex + RANGE_START] = line.getCharStart();
+            lineRanges[rangeIndex + RANGE_END] = line.getCharEnd();
+            lineExtents[extentIndex + EXTENT_TOP] = line.getTop();
+            lineExtents[extentIndex + EXTENT_BASELINE] = line.getOriginY();
+            lineExtents[extentIndex + EXTENT_BOTTOM] = line.getBottom();
+            lineExtents[extentIndex + EXTENT_MAX_BOTTOM] = maxBottom;
+        }
     }
 
     void setContainerRect(float originX, float originY, float width, float height) {
@@ -67,6 +108,17 @@ public class ComposedFrame {
         mHeight = height;
     }
 
+    void setVertical(boolean vertical) {
+        mVertical = vertical;
+    }
+
+    /**
+     * Returns the extent of the lines of this frame, that is the height of a vertical frame.
+     */
+    float getLineSpaceWidth() {
+        return mVertical ? mHeight : mWidth;
+    }
+
     private @NonNull Paint lazyPaint() {
         if (paint == null) {
             paint = new Paint();
@@ -75,6 +127,55 @@ public class ComposedFrame {
         return paint;
     }
 
+    private @NonNull Rect lazyClipBounds() {
+        if (clipBounds == null) {
+            clipBounds = new Rect();
+        }
+
+        return clipBounds;
+    }
+
+    private int getLineStart(int lineIndex) {
+        return lineRanges[lineIndex * RANGE_SIZE + RANGE_START];
+    }
+
+    private int getLineEnd(int lineIndex) {
+        return lineRanges[lineIndex * RANGE_SIZE + RANGE_END];
+    }
+
+    private float getLineTop(int lineIndex) {
+        return lineExtents[lineIndex * EXTENT_SIZE + EXTENT_TOP];
+    }
+
+    private float getLineBaseline(int lineIndex) {
+        return lineExtents[lineIndex * EXTENT_SIZE + EXTENT_BASELINE];
+    }
+
+    private float getLineBottom(int lineIndex) {
+        return lineExtents[lineIndex * EXTENT_SIZE + EXTENT_BOTTOM];
+    }
+
+    /**
+     * Returns the index of first line whose running maximum of bottom reaches the specified
+     * position. As lines are placed from top to bottom, this maximum is ordered which makes it
+     * searchable even if line heights have been customized.
+     */
+    private int searchLineIndexForBottom(float y) {
+        int low = 0;
+        int high = lineList.size() - 1;
+
+        while (low <= high) {
+            int mid = (low + high) >>> 1;
+            if (lineExtents[mid * EXTENT_SIZE + EXTENT_MAX_BOTTOM] < y) {
+                low = mid + 1;
+            } else {
+                high = mid - 1;
+            }
+        }
+
+        return low;
+    }
+
     /**
      * Returns the index to the first character of this frame in source text.
      *
@@ -129,6 +230,21 @@ public class ComposedFrame {
         return mHeight;
     }
 
+    /**
+     * Returns whether or not the lines of this frame are vertical. The lines of a vertical frame
+     * are placed in a line space which is rotated clockwise by 90 degrees with its origin at the
+     * top right corner of the frame. So the origins and extents of the lines, such as their tops
+     * and bottoms, are measured along the frame height and leftwards from its right edge
+     * respectively. The positions and rectangles taken or returned by the frame itself are in
+     * frame coordinates.
+     *
+     * @return <code>true</code> if the lines of this frame are vertical, <code>false</code>
+     *         otherwise.
+     */
+    public boolean isVertical() {
+        return mVertical;
+    }
+
     /**
      * Returns an unmodifiable list that contains all the lines of this frame.
      *
@@ -158,11 +274,10 @@ public class ComposedFrame {
 
         while (low <= high) {
             int mid = (low + high) >>> 1;
-            ComposedLine value = lineList.get(mid);
 
-            if (charIndex >= value.getCharEnd()) {
+            if (charIndex >= getLineEnd(mid)) {
                 low = mid + 1;
-            } else if (charIndex < value.getCharStart()) {
+            } else if (charIndex < getLineStart(mid)) {
                 high = mid - 1;
             } else {
                 return mid;
@@ -182,20 +297,55 @@ public class ComposedFrame {
     public int getLineIndexForPosition(float x, float y) {
         int lineCount = lineList.size();
 
-        for (int i = 0; i < lineCount; i++) {
-            ComposedLine line = lineList.get(i);
-            float top = line.getTop();
-            float bottom = top + line.getHeight();
-            if (y >= top && y <= bottom) {
-                return i;
-            }
+        if (mVertical) {
+            // Lines are stacked leftwards from the right edge.
+            y = mWidth - x;
+        }
+
+        // Find the first line whose bottom reaches the y- coordinate.
+        int lineIndex = searchLineIndexForBottom(y);
+        if (lineIndex < lineCount && getLineTop(lineIndex) <= y) {
+            return lineIndex;
         }
 
         return lineCount - 1;
     }
 
+    private static class RectList {
+        float[] values = new float[32];
+        int size;
+
+        void add(float left, float top, float right, float bottom) {
+            if (size + 4 > values.length) {
+                values = Arrays.copyOf(values, values.length * 2);
+            }
+
+            values[size++] = left;
+            values[size++] = top;
+            values[size++] = right;
+            values[size++] = bottom;
+        }
+
+        /**
+         * Maps the rectangles from the rotated line space of a vertical frame to frame coordinates.
+         */
+        void rotate(float frameWidth) {
+            for (int i = 0; i < size; i += 4) {
+                float left = values[i];
+                float top = values[i + 1];
+                float right = values[i + 2];
+                float bottom = values[i + 3];
+
+                values[i] = frameWidth - bottom;
+                values[i + 1] = left;
+                values[i + 2] = frameWidth - top;
+                values[i + 3] = right;
+            }
+        }
+    }
+
     private void addSelectionParts(@NonNull ComposedLine line, int charStart, int charEnd,
-                                   float selectionTop, float selectionBottom, @NonNull Path selectionPath) {
+                                   float selectionTop, float selectionBottom, @NonNull RectList selectionRects) {
         float[] visualEdges = line.computeVisualEdges(charStart, charEnd);
         float lineLeft = line.getLeft();
 
@@ -207,10 +357,9 @@ public class ComposedFrame {
             float selectionRight = visualEdges[edgeIndex++] + lineLeft;
 
             selectionLeft = Math.max(selectionLeft, 0);
-            selectionRight = Math.min(selectionRight, mWidth);
+            selectionRight = Math.min(selectionRight, getLineSpaceWidth());
 
-            selectionPath.addRect(selectionLeft, selectionTop,
-                                  selectionRight, selectionBottom, Path.Direction.CW);
+            selectionRects.add(selectionLeft, selectionTop, selectionRight, selectionBottom);
         }
     }
 
@@ -234,8 +383,50 @@ public class ComposedFrame {
     public @NonNull Path generateSelectionPath(int charStart, int charEnd) {
         checkSubRange(charStart, charEnd);
 
+        RectList selectionRects = new RectList();
+        addSelectionRects(charStart, charEnd, selectionRects);
+
         Path selectionPath = new Path();
+        float[] values = selectionRects.values;
+
+        for (int i = 0; i < selectionRects.size; i += 4) {
+            selectionPath.addRect(values[i], values[i + 1],
+                                  values[i + 2], values[i + 3], Path.Direction.CW);
+        }
+
+        return selectionPath;
+    }
+
+    /**
+     * Computes a set of rectangles covering the specified selection range. The resulting array
+     * will contain left, top, right and bottom of each rectangle consecutively.
+     *
+     * @param charStart The index to the first character of selection in source text.
+     * @param charEnd The index after the first character of selection in source text.
+     * @return An array of rectangles covering the specified selection range.
+     *
+     * @throws IllegalArgumentException if <code>charStart</code> is less than frame start, or
+     *         <code>charEnd</code> is greater than frame end, or <code>charStart</code> is greater
+     *         than <code>charEnd</code>.
+     */
+    public @NonNull @Size(multiple = 4) float[] computeSelectionRects(int charStart, int charEnd) {
+        checkSubRange(charStart, charEnd);
 
+        RectList selectionRects = new RectList();
+        addSelectionRects(charStart, charEnd, selectionRects);
+
+        return Arrays.copyOf(selectionRects.values, selectionRects.size);
+    }
+
+    private void addSelectionRects(int charStart, int charEnd, @NonNull RectList selectionRects) {
+        addLineSpaceRects(charStart, charEnd, selectionRects);
+
+        if (mVertical) {
+            selectionRects.rotate(mWidth);
+        }
+    }
+
+    private void addLineSpaceRects(int charStart, int charEnd, @NonNull RectList selectionRects) {
         int firstIndex = getLineIndexForChar(charStart);
         int lastIndex = getLineIndexForChar(charEnd - 1);
 
@@ -246,60 +437,48 @@ public class ComposedFrame {
         float lastBottom = lastLine.getBottom();
 
         if (firstLine == lastLine) {
-            addSelectionParts(firstLine, charStart, charEnd, firstTop, lastBottom, selectionPath);
+            addSelectionParts(firstLine, charStart, charEnd, firstTop, lastBottom, selectionRects);
         } else {
             float frameLeft = 0.0f;
-            float frameRight = mWidth;
+            float frameRight = getLineSpaceWidth();
 
             float firstBottom = firstLine.getBottom();
             float lastTop = lastLine.getTop();
 
             // Select each intersecting part of first line.
             addSelectionParts(firstLine, charStart, firstLine.getCharEnd(),
-                              firstTop, firstBottom, selectionPath);
+                              firstTop, firstBottom, selectionRects);
 
             // Select trailing padding of first line.
             if ((lastLine.getParagraphLevel() & 1) == 1) {
-                selectionPath.addRect(frameLeft, firstTop,
-                                      firstLine.getLeft(), firstBottom, Path.Direction.CW);
+                selectionRects.add(frameLeft, firstTop, firstLine.getLeft(), firstBottom);
             } else {
-                selectionPath.addRect(firstLine.getRight(), firstTop,
-                                      frameRight, firstBottom, Path.Direction.CW);
+                selectionRects.add(firstLine.getRight(), firstTop, frameRight, firstBottom);
             }
 
             // Select whole part of each mid line.
             for (int i = firstIndex + 1; i < lastIndex; i++) {
-                ComposedLine midLine = lineList.get(i);
-                float midTop = midLine.getTop();
-                float midBottom = midLine.getBottom();
-
-                selectionPath.addRect(frameLeft, midTop,
-                                      frameRight, midBottom, Path.Direction.CW);
+                selectionRects.add(frameLeft, getLineTop(i), frameRight, getLineBottom(i));
             }
 
             // Select leading padding of last line.
             if ((lastLine.getParagraphLevel() & 1) == 1) {
-                selectionPath.addRect(lastLine.getRight(), lastTop,
-                                      frameRight, lastBottom, Path.Direction.CW);
+                selectionRects.add(lastLine.getRight(), lastTop, frameRight, lastBottom);
             } else {
-                selectionPath.addRect(frameLeft, lastTop,
-                                      lastLine.getLeft(), lastBottom, Path.Direction.CW);
+                selectionRects.add(frameLeft, lastTop, lastLine.getLeft(), lastBottom);
             }
 
             // Select each intersecting part of last line.
             addSelectionParts(lastLine, lastLine.getCharStart(), charEnd,
-                              lastTop, lastBottom, selectionPath);
+                              lastTop, lastBottom, selectionRects);
         }
-
-        return selectionPath;
     }
 
-    private void drawBackground(@NonNull Canvas canvas) {
+    private void drawBackground(@NonNull Canvas canvas, int firstIndex, int lastIndex) {
         int frameLeft = 0;
-        int frameRight = (int) (mWidth + 0.5f);
+        int frameRight = (int) (getLineSpaceWidth() + 0.5f);
 
-        int lineCount = lineList.size();
-        for (int i = 0; i < lineCount; i++) {
+        for (int i = firstIndex; i <= lastIndex; i++) {
             ComposedLine composedLine = lineList.get(i);
             Object[] lineSpans = composedLine.getSpans();
 
@@ -311,16 +490,16 @@ public class ComposedFrame {
                     int spanStart = sourceText.getSpanStart(span);
                     int spanEnd = sourceText.getSpanEnd(span);
 
-                    int lineStart = composedLine.getCharStart();
-                    int lineEnd = composedLine.getCharEnd();
+                    int lineStart = getLineStart(i);
+                    int lineEnd = getLineEnd(i);
                     if (lineStart >= spanEnd || lineEnd <= spanStart) {
                         continue;
                     }
 
                     Paint paint = lazyPaint();
-                    int lineTop = (int) (composedLine.getTop() + 0.5f);
-                    int lineBaseline = (int) (composedLine.getOriginY() + 0.5f);
-                    int lineBottom = (int) (composedLine.getTop() + composedLine.getHeight() + 0.5f);
+                    int lineTop = (int) (getLineTop(i) + 0.5f);
+                    int lineBaseline = (int) (getLineBaseline(i) + 0.5f);
+                    int lineBottom = (int) (getLineBottom(i) + 0.5f);
 
                     span.drawBackground(canvas, paint, frameLeft, frameRight,
                                         lineTop, lineBaseline, lineBottom,
@@ -341,15 +520,41 @@ public class ComposedFrame {
     public void draw(@NonNull Renderer renderer, @NonNull Canvas canvas, float x, float y) {
         canvas.translate(x, y);
 
-        drawBackground(canvas);
+        if (mVertical) {
+            canvas.save();
+            canvas.translate(mWidth, 0.0f);
+            canvas.rotate(90.0f);
+        }
 
-        int lineCount = lineList.size();
-        for (int i = 0; i < lineCount; i++) {
+        // Draw only the lines that intersect the clip bounds.
+        Rect clipBounds = lazyClipBounds();
+        if (canvas.getClipBounds(clipBounds)) {
+            int lineCount = lineList.size();
+            int firstIndex = searchLineIndexForBottom(clipBounds.top);
+            int lastIndex = firstIndex - 1;
+
+            while (lastIndex + 1 < lineCount && getLineTop(lastIndex + 1) <= clipBounds.bottom) {
+                lastIndex++;
+            }
+
+            drawBackground(canvas, firstIndex, lastIndex);
+            drawLines(renderer, canvas, firstIndex, lastIndex);
+        }
+
+        if (mVertical) {
+            canvas.restore();
+        }
+
+        canvas.translate(-x, -y);
+    }
+
+    private void drawLines(@NonNull Renderer renderer, @NonNull Canvas canvas, int firstIndex, int lastIndex) {
+        for (int i = firstIndex; i <= lastIndex; i++) {
             ComposedLine composedLine = lineList.get(i);
             Object[] lineSpans = composedLine.getSpans();
 
             int lineLeft = 0;
-            int lineRight = (int) (mWidth + 0.5f);
+            int lineRight = (int) (getLineSpaceWidth() + 0.5f);
 
             // Draw leading margins of this line.
             for (Object style : lineSpans) {
@@ -362,12 +567,12 @@ public class ComposedFrame {
                     Paint paint = lazyPaint();
                     int margin = (isLTR ? lineLeft : lineRight);
                     int direction = (isLTR ? Layout.DIR_LEFT_TO_RIGHT : Layout.DIR_RIGHT_TO_LEFT);
-                    int lineTop = (int) (composedLine.getTop() + 0.5f);
-                    int lineBaseline = (int) (composedLine.getOriginY() + 0.5f);
-                    int lineBottom = (int) (composedLine.getTop() + composedLine.getHeight() + 0.5f);
+                    int lineTop = (int) (getLineTop(i) + 0.5f);
+                    int lineBaseline = (int) (getLineBaseline(i) + 0.5f);
+                    int lineBottom = (int) (getLineBottom(i) + 0.5f);
                     Spanned sourceText = (Spanned) source;
-                    int lineStart = composedLine.getCharStart();
-                    int lineEnd = composedLine.getCharEnd();
+                    int lineStart = getLineStart(i);
+                    int lineEnd = getLineEnd(i);
                     boolean isFirst = composedLine.isFirst();
 
                     span.drawLeadingMargin(canvas, paint, margin, direction,
@@ -382,10 +587,8 @@ public class ComposedFrame {
                 }
             }
 
-            composedLine.draw(renderer, canvas, composedLine.getOriginX(), composedLine.getOriginY());
+            composedLine.draw(renderer, canvas, composedLine.getOriginX(), getLineBaseline(i));
         }
-
-        canvas.translate(-x, -y);
     }
 
     @Override
@@ -396,6 +599,7 @@ public class ComposedFrame {
                 + ", originY=" + mOriginY
                 + ", width=" + mWidth
                 + ", height=" + mHeight
+                + ", vertical=" + mVertical
                 + ", lines=" + Description.forIterable(lineList)
                 + '}';
     }
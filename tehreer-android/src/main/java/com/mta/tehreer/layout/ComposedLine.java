@@ -20,13 +20,17 @@ import android.graphics.Canvas;
 import android.graphics.RectF;
 
 import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
 import androidx.annotation.Size;
 
 import com.mta.tehreer.graphics.Renderer;
 import com.mta.tehreer.internal.Description;
+import com.mta.tehreer.internal.layout.TextRun;
 
+import java.util.AbstractList;
 import java.util.Arrays;
 import java.util.List;
+import java.util.RandomAccess;
 
 import static com.mta.tehreer.internal.util.Preconditions.checkArgument;
 
@@ -39,10 +43,14 @@ public class ComposedLine {
     private final byte paragraphLevel;
     private final float extent;
     private final float trailingWhitespaceExtent;
-	private final @NonNull List<GlyphRun> runList;
+    private final @NonNull TextRun[] textRuns;
+    private final @NonNull float[] runOrigins;
+    private @Nullable RunList runList;
+    private @Nullable int[] logicalRuns;
 
     private Object[] mSpans;
     private boolean mFirst;
+    private boolean mJustified;
     private float mIntrinsicMargin;
     private float mFlushFactor;
 
@@ -55,13 +63,15 @@ public class ComposedLine {
 
 	ComposedLine(int charStart, int charEnd, byte paragraphLevel,
                  float ascent, float descent, float leading, float extent,
-                 float trailingWhitespaceExtent, @NonNull List<GlyphRun> runList) {
+                 float trailingWhitespaceExtent,
+                 @NonNull TextRun[] textRuns, @NonNull float[] runOrigins) {
 	    this.lineStart = charStart;
 	    this.lineEnd = charEnd;
 	    this.paragraphLevel = paragraphLevel;
 	    this.extent = extent;
 	    this.trailingWhitespaceExtent = trailingWhitespaceExtent;
-	    this.runList = runList;
+	    this.textRuns = textRuns;
+	    this.runOrigins = runOrigins;
 
 	    mAscent = ascent;
 	    mDescent = descent;
@@ -102,6 +112,14 @@ public class ComposedLine {
 	    mFirst = first;
     }
 
+    boolean isJustified() {
+	    return mJustified;
+    }
+
+    void setJustified(boolean justified) {
+	    mJustified = justified;
+    }
+
     float getIntrinsicMargin() {
 	    return mIntrinsicMargin;
     }
@@ -243,9 +261,101 @@ public class ComposedLine {
      * @return An unmodifiable list that contains all the runs of this line.
      */
     public @NonNull List<GlyphRun> getRuns() {
+        if (runList == null) {
+            runList = new RunList();
+        }
+
         return runList;
     }
 
+    @NonNull TextRun[] getTextRuns() {
+        return textRuns;
+    }
+
+    @NonNull float[] getRunOrigins() {
+        return runOrigins;
+    }
+
+    /**
+     * Creates glyph run objects only when they are accessed, so that lines which are merely laid
+     * out and drawn keep just the flat run arrays.
+     */
+    private class RunList extends AbstractList<GlyphRun> implements RandomAccess {
+        private final @NonNull GlyphRun[] glyphRuns = new GlyphRun[textRuns.length];
+
+        @Override
+        public int size() {
+            return textRuns.length;
+        }
+
+        @Override
+        public GlyphRun get(int index) {
+            GlyphRun glyphRun = glyphRuns[index];
+            if (glyphRun == null) {
+                glyphRun = new GlyphRun(textRuns[index], runOrigins[index], 0.0f);
+                glyphRuns[index] = glyphRun;
+            }
+
+            return glyphRun;
+        }
+    }
+
+    /**
+     * Returns the indexes of runs sorted by their position in source text, or an empty array if
+     * the runs overlap each other, as in the case of a truncation token.
+     */
+    private @NonNull int[] lazyLogicalRuns() {
+        int[] indexes = logicalRuns;
+        if (indexes == null) {
+            int runCount = textRuns.length;
+            indexes = new int[runCount];
+
+            for (int i = 0; i < runCount; i++) {
+                int runStart = textRuns[i].getStartIndex();
+                int j = i - 1;
+
+                // Insertion sort suffices for the handful of runs a line usually has.
+                while (j >= 0 && textRuns[indexes[j]].getStartIndex() > runStart) {
+                    indexes[j + 1] = indexes[j];
+                    j--;
+                }
+                indexes[j + 1] = i;
+            }
+
+            for (int i = 1; i < runCount; i++) {
+                if (textRuns[indexes[i]].getStartIndex() < textRuns[indexes[i - 1]].getEndIndex()) {
+                    indexes = new int[0];
+                    break;
+                }
+            }
+
+            logicalRuns = indexes;
+        }
+
+        return indexes;
+    }
+
+    private int searchLogicalRun(int charIndex) {
+        int[] indexes = lazyLogicalRuns();
+        int low = 0;
+        int high = indexes.length - 1;
+
+        while (low <= high) {
+            int mid = (low + high) >>> 1;
+            TextRun textRun = textRuns[indexes[mid]];
+
+            if (charIndex >= textRun.getEndIndex()) {
+                low = mid + 1;
+            } else if (charIndex < textRun.getStartIndex()) {
+                high = mid - 1;
+            } else {
+                return indexes[mid];
+            }
+        }
+
+        return -1;
+    }
+
     private void checkCharIndex(int charIndex) {
         checkArgument(charIndex >= lineStart && charIndex <= lineEnd,
                       "Char Index: " + charIndex + ", Line Range: [" + lineStart + ", " + lineEnd + ')');
@@ -263,17 +373,24 @@ public class ComposedLine {
     public float computeCharDistance(int charIndex) {
         checkCharIndex(charIndex);
 
+        if (lazyLogicalRuns().length == textRuns.length) {
+            int runIndex = searchLogicalRun(charIndex);
+            if (runIndex == -1) {
+                return extent;
+            }
+
+            return runOrigins[runIndex] + textRuns[runIndex].getCaretEdge(charIndex);
+        }
+
         float distance = 0.0f;
 
-        int runCount = runList.size();
-        for (int i = 0; i < runCount; i++) {
-            GlyphRun glyphRun = runList.get(i);
-            if (charIndex >= glyphRun.getCharStart() && charIndex < glyphRun.getCharEnd()) {
-                distance += glyphRun.computeCharDistance(charIndex);
+        for (TextRun textRun : textRuns) {
+            if (charIndex >= textRun.getStartIndex() && charIndex < textRun.getEndIndex()) {
+                distance += textRun.getCaretEdge(charIndex);
                 break;
             }
 
-            distance += glyphRun.getWidth();
+            distance += textRun.getWidth();
         }
 
         return distance;
@@ -303,24 +420,24 @@ public class ComposedLine {
     public @NonNull @Size(multiple = 2) float[] computeVisualEdges(int charStart, int charEnd) {
         checkSubRange(charStart, charEnd);
 
-        int runCount = runList.size();
+        int runCount = textRuns.length;
 
         float[] edgeList = new float[runCount * 2];
         int edgeIndex = 0;
 
         for (int i = 0; i < runCount; i++) {
-            GlyphRun glyphRun = runList.get(i);
-            int runStart = glyphRun.getCharStart();
-            int runEnd = glyphRun.getCharEnd();
+            TextRun textRun = textRuns[i];
+            int runStart = textRun.getStartIndex();
+            int runEnd = textRun.getEndIndex();
 
             if (runStart < charEnd && runEnd > charStart) {
                 int selectionStart = Math.max(charStart, runStart);
                 int selectionEnd = Math.min(charEnd, runEnd);
 
-                float leadingEdge = glyphRun.computeCharDistance(selectionStart);
-                float trailingEdge = glyphRun.computeCharDistance(selectionEnd);
+                float leadingEdge = textRun.getCaretEdge(selectionStart);
+                float trailingEdge = textRun.getCaretEdge(selectionEnd);
 
-                float relativeLeft = glyphRun.getOriginX();
+                float relativeLeft = runOrigins[i];
                 float selectionLeft = Math.min(leadingEdge, trailingEdge) + relativeLeft;
                 float selectionRight = Math.max(leadingEdge, trailingEdge) + relativeLeft;
 
@@ -345,25 +462,32 @@ public class ComposedLine {
      *         index in source string.
      */
     public int computeNearestCharIndex(float distance) {
-        GlyphRun glyphRun = null;
-
-        for (int i = runList.size() - 1; i >= 0; i--) {
-            glyphRun = runList.get(i);
-            if (glyphRun.getOriginX() <= distance) {
-                break;
+        // Find the last run starting at or before the distance, falling back to the first one.
+        int low = 1;
+        int high = textRuns.length - 1;
+
+        while (low <= high) {
+            int mid = (low + high) >>> 1;
+            if (runOrigins[mid] <= distance) {
+                low = mid + 1;
+            } else {
+                high = mid - 1;
             }
         }
 
-        return glyphRun.computeNearestCharIndex(distance - glyphRun.getOriginX());
+        int runIndex = low - 1;
+
+        return textRuns[runIndex].computeNearestCharIndex(distance - runOrigins[runIndex]);
     }
 
     public @NonNull RectF computeBoundingBox(@NonNull Renderer renderer) {
         RectF comulativeBox = new RectF(Float.POSITIVE_INFINITY, Float.POSITIVE_INFINITY,
                                         Float.NEGATIVE_INFINITY, Float.NEGATIVE_INFINITY);
 
-        for (GlyphRun glyphRun : getRuns()) {
-            RectF runBox = glyphRun.computeBoundingBox(renderer);
-            runBox.offset(glyphRun.getOriginX(), glyphRun.getOriginY());
+        for (int i = 0; i < textRuns.length; i++) {
+            TextRun textRun = textRuns[i];
+            RectF runBox = textRun.computeBoundingBox(renderer, 0, textRun.getGlyphCount());
+            runBox.offset(runOrigins[i], 0.0f);
 
             comulativeBox.union(runBox);
         }
@@ -399,13 +523,12 @@ public class ComposedLine {
      * @param y The y- position at which to draw this line.
      */
     public void draw(@NonNull Renderer renderer, @NonNull Canvas canvas, float x, float y) {
-        for (GlyphRun glyphRun : runList) {
-            float translateX = x + glyphRun.getOriginX();
-            float translateY = y + glyphRun.getOriginY();
+        for (int i = 0; i < textRuns.length; i++) {
+            float translateX = x + runOrigins[i];
 
-            canvas.translate(translateX, translateY);
-            glyphRun.draw(renderer, canvas);
-            canvas.translate(-translateX, -translateY);
+            canvas.translate(translateX, y);
+            textRuns[i].draw(renderer, canvas);
+            canvas.translate(-translateX, -y);
         }
     }
 
@@ -421,7 +544,7 @@ public class ComposedLine {
                 + ", width=" + getWidth()
                 + ", height=" + getHeight()
                 + ", trailingWhitespaceExtent=" + getTrailingWhitespaceExtent()
-                + ", runs=" + Description.forIterable(runList)
+                + ", runs=" + Description.forIterable(getRuns())
                 + "}";
     }
 }
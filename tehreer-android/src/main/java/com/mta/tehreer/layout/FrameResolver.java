@@ -31,9 +31,11 @@ import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
 
 import com.mta.tehreer.internal.layout.ParagraphCollection;
-import com.mta.tehreer.unicode.BidiParagraph;
+import com.mta.tehreer.internal.layout.TextParagraph;
+import com.mta.tehreer.internal.layout.TextRun;
 
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 
 import static com.mta.tehreer.internal.util.Preconditions.checkArgument;
@@ -41,8 +43,16 @@ import static com.mta.tehreer.internal.util.Preconditions.checkNotNull;
 
 /**
  * This class resolves text frames by using a typesetter object.
+ * <p>
+ * If the typesetter is vertical, the lines are resolved as columns flowing from top to bottom and
+ * are placed from right to left. The frame is then resolved as if it were rotated clockwise, so
+ * the text alignment and horizontal fitting apply along the columns, and the vertical alignment
+ * and vertical fitting apply across them.
  */
 public class FrameResolver {
+    // The number of lines to break at a time while looking for the lines unchanged by an edit.
+    private static final int RESYNC_LINES = 4;
+
     private Typesetter mTypesetter;
     private Spanned mSpanned;
     private ParagraphCollection mParagraphs;
@@ -59,6 +69,11 @@ public class FrameResolver {
     private int mMaxLines = 0;
     private float mExtraLineSpacing = 0.0f;
     private float mLineHeightMultiplier = 0.0f;
+    private @NonNull BreakStrategy mBreakStrategy = BreakStrategy.GREEDY;
+    private float mHyphenPenalty = 10.0f;
+    private float mWidowPenalty = 25.0f;
+    private float mTightnessPenalty = 10.0f;
+    private int mBreakLookahead = 0;
 
     /**
      * Constructs a frame resolver object.
@@ -345,6 +360,129 @@ public class FrameResolver {
         mLineHeightMultiplier = lineHeightMultiplier;
     }
 
+    /**
+     * Returns the strategy for breaking paragraphs into lines. The default value is
+     * {@link BreakStrategy#GREEDY}.
+     *
+     * @return The current break strategy.
+     */
+    public @NonNull BreakStrategy getBreakStrategy() {
+        return mBreakStrategy;
+    }
+
+    /**
+     * Sets the strategy for breaking paragraphs into lines. The default value is
+     * {@link BreakStrategy#GREEDY}.
+     *
+     * @param breakStrategy A value of {@link BreakStrategy}.
+     */
+    public void setBreakStrategy(@NonNull BreakStrategy breakStrategy) {
+        checkNotNull(breakStrategy);
+        mBreakStrategy = breakStrategy;
+    }
+
+    /**
+     * Returns the penalty of breaking a line after a hyphen in optimal break strategy. The default
+     * value is <code>10.0f</code>.
+     *
+     * @return The current hyphen penalty.
+     *
+     * @see #setHyphenPenalty(float)
+     */
+    public float getHyphenPenalty() {
+        return mHyphenPenalty;
+    }
+
+    /**
+     * Sets the penalty of breaking a line after a hyphen in optimal break strategy. The default
+     * value is <code>10.0f</code>.
+     * <p>
+     * Penalties are measured in the same units as the badness of a line, which is 100 times the
+     * square of its unused fraction. So a penalty of 25 is equivalent to a half filled line.
+     *
+     * @param hyphenPenalty The hyphen penalty.
+     *
+     * @see #getHyphenPenalty()
+     */
+    public void setHyphenPenalty(float hyphenPenalty) {
+        mHyphenPenalty = hyphenPenalty;
+    }
+
+    /**
+     * Returns the penalty of leaving a single word in the last line of a paragraph in optimal break
+     * strategy. The default value is <code>25.0f</code>.
+     *
+     * @return The current widow penalty.
+     *
+     * @see #setWidowPenalty(float)
+     */
+    public float getWidowPenalty() {
+        return mWidowPenalty;
+    }
+
+    /**
+     * Sets the penalty of leaving a single word in the last line of a paragraph in optimal break
+     * strategy. The default value is <code>25.0f</code>.
+     *
+     * @param widowPenalty The widow penalty.
+     *
+     * @see #getWidowPenalty()
+     */
+    public void setWidowPenalty(float widowPenalty) {
+        mWidowPenalty = widowPenalty;
+    }
+
+    /**
+     * Returns the penalty of a line that needs to be squeezed by justification in optimal break
+     * strategy. The default value is <code>10.0f</code>.
+     *
+     * @return The current tightness penalty.
+     *
+     * @see #setTightnessPenalty(float)
+     */
+    public float getTightnessPenalty() {
+        return mTightnessPenalty;
+    }
+
+    /**
+     * Sets the penalty of a line that needs to be squeezed by justification in optimal break
+     * strategy. The default value is <code>10.0f</code>.
+     *
+     * @param tightnessPenalty The tightness penalty.
+     *
+     * @see #getTightnessPenalty()
+     */
+    public void setTightnessPenalty(float tightnessPenalty) {
+        mTightnessPenalty = tightnessPenalty;
+    }
+
+    /**
+     * Returns the number of lines that are optimized together in optimal break strategy. The
+     * default value is zero, meaning that each paragraph is optimized as a whole.
+     *
+     * @return The current break lookahead.
+     *
+     * @see #setBreakLookahead(int)
+     */
+    public int getBreakLookahead() {
+        return mBreakLookahead;
+    }
+
+    /**
+     * Sets the number of lines that are optimized together in optimal break strategy. The default
+     * value is zero, meaning that each paragraph is optimized as a whole.
+     * <p>
+     * A bounded lookahead keeps the breaking cost proportional to the number of produced lines,
+     * which is useful for very long paragraphs and frames limited by max lines.
+     *
+     * @param breakLookahead The number of lines to optimize together.
+     *
+     * @see #getBreakLookahead()
+     */
+    public void setBreakLookahead(int breakLookahead) {
+        mBreakLookahead = breakLookahead;
+    }
+
     private float getVerticalMultiplier() {
         switch (mVerticalAlignment) {
         case BOTTOM:
@@ -394,6 +532,10 @@ public class FrameResolver {
         return 0.0f;
     }
 
+    private boolean isParagraphEnd(int charIndex) {
+        return mParagraphs.getParagraph(charIndex - 1).getCharEnd() == charIndex;
+    }
+
     private void checkSubRange(int charStart, int charEnd) {
         checkArgument(charStart >= 0, "Char Start: " + charStart);
         checkArgument(charEnd <= mSpanned.length(), "Char End: " + charEnd + ", Text Length: " + mSpanned.length());
@@ -418,8 +560,44 @@ public class FrameResolver {
     public @NonNull ComposedFrame createFrame(int charStart, int charEnd) {
         checkSubRange(charStart, charEnd);
 
+        return resolveFrame(charStart, charEnd, null);
+    }
+
+    /**
+     * Creates a frame full of lines in the rectangle provided by the frame bounds, reusing the
+     * lines of a previous frame wherever the text has not been touched by an edit. Only the
+     * paragraphs that the typesetter has shaped again are broken into new lines. The lines of
+     * other paragraphs are taken from the previous frame as long as its width is the same and it
+     * contains them completely, so their runs are neither resolved nor broken again. The edited
+     * paragraph stops being broken as soon as one of its lines after the edit matches a line of
+     * previous frame.
+     * <p>
+     * Lines that keep their position, such as the ones before the edit in a top aligned frame,
+     * are shared with the previous frame as the same objects. Lines after the edit are cheap
+     * copies that refer to the runs of previous lines with shifted indexes.
+     * <p>
+     * The current typesetter must have been created from the typesetter of previous frame by
+     * {@link Typesetter#Typesetter(Typesetter, Spanned, int, int, int)}, and the properties of this
+     * resolver must not have been changed since the previous frame was created. Lines are not
+     * reused if the frame fits horizontally.
+     *
+     * @param charStart The index to first character of the frame in source text.
+     * @param charEnd The index after the last character of the frame in source text.
+     * @param previousFrame The frame created for the text before the edit.
+     * @return The new frame object.
+     */
+    public @NonNull ComposedFrame createFrame(int charStart, int charEnd, @NonNull ComposedFrame previousFrame) {
+        checkNotNull(previousFrame, "previousFrame");
+        checkSubRange(charStart, charEnd);
+
+        return resolveFrame(charStart, charEnd, previousFrame);
+    }
+
+    private @NonNull ComposedFrame resolveFrame(int charStart, int charEnd,
+                                                @Nullable ComposedFrame previousFrame) {
         FrameContext context = new FrameContext();
         setupLayoutSize(context);
+        setupPreviousLines(context, previousFrame);
         setupMaxLines(context);
         setupJustificationMultiplier(context);
 
@@ -430,7 +608,7 @@ public class FrameResolver {
 
         // Iterate over all paragraphs in provided range.
         do {
-            final BidiParagraph paragraph = mParagraphs.get(paragraphIndex);
+            final TextParagraph paragraph = mParagraphs.get(paragraphIndex);
             segmentEnd = Math.min(charEnd, paragraph.getCharEnd());
 
             // Setup the frame context and add the lines.
@@ -453,7 +631,13 @@ public class FrameResolver {
         resolveJustification(context);
 
         ComposedFrame frame = new ComposedFrame(mSpanned, charStart, context.frameEnd(), context.textLines);
-        frame.setContainerRect(mFrameBounds.left, mFrameBounds.top, context.layoutWidth, context.layoutHeight);
+
+        if (mTypesetter.isVertical()) {
+            frame.setContainerRect(mFrameBounds.left, mFrameBounds.top, context.layoutHeight, context.layoutWidth);
+            frame.setVertical(true);
+        } else {
+            frame.setContainerRect(mFrameBounds.left, mFrameBounds.top, context.layoutWidth, context.layoutHeight);
+        }
 
         return frame;
     }
@@ -471,6 +655,9 @@ public class FrameResolver {
         final List<ComposedLine> textLines = new ArrayList<>();
         boolean isFilled = false;
 
+        List<ComposedLine> previousLines;
+        float previousWidth = 0.0f;
+
         // endregion
 
         // region Paragraph Properties
@@ -508,8 +695,21 @@ public class FrameResolver {
     }
 
     private void setupLayoutSize(@NonNull FrameContext context) {
-        context.layoutWidth = mFrameBounds.width();
-        context.layoutHeight = mFrameBounds.height();
+        if (mTypesetter.isVertical()) {
+            // Lay out the columns in the rotated line space of the frame.
+            context.layoutWidth = mFrameBounds.height();
+            context.layoutHeight = mFrameBounds.width();
+        } else {
+            context.layoutWidth = mFrameBounds.width();
+            context.layoutHeight = mFrameBounds.height();
+        }
+    }
+
+    private void setupPreviousLines(@NonNull FrameContext context, @Nullable ComposedFrame previousFrame) {
+        if (previousFrame != null) {
+            context.previousLines = previousFrame.getLines();
+            context.previousWidth = previousFrame.getLineSpaceWidth();
+        }
     }
 
     private void setupMaxLines(@NonNull FrameContext context) {
@@ -532,14 +732,13 @@ public class FrameResolver {
         resolveFlushFactor(context);
         resolveLineMargins(context, true);
 
+        // Break the whole paragraph in a single pass.
+        final int[] lineBreaks = resolveLineBreaks(context);
+
         // Iterate over each line of this paragraph.
         int lineStart = context.startIndex;
-        while (lineStart != context.endIndex) {
-            final float breakExtent = context.lineExtent + context.extraWidth;
-            final int lineEnd = mTypesetter.suggestForwardBreak(lineStart, context.endIndex, breakExtent, BreakMode.LINE);
-            final ComposedLine composedLine = mTypesetter.createSimpleLine(lineStart, lineEnd);
-            resolveAttributes(context, composedLine);
-
+        for (final int lineEnd : lineBreaks) {
+            final ComposedLine composedLine = createLine(context, lineStart, lineEnd);
             final float lineHeight = composedLine.getHeight();
 
             // Make sure that at least one line is added even if frame is smaller in height.
@@ -563,6 +762,217 @@ public class FrameResolver {
         }
     }
 
+    private @NonNull int[] resolveLineBreaks(@NonNull FrameContext context) {
+        final int[] previousBreaks = findPreviousBreaks(context);
+        if (previousBreaks != null) {
+            return previousBreaks;
+        }
+
+        final int leadingLines = Math.max(1, context.leadingLineCount);
+        final int maxLines = context.maxLines - context.textLines.size();
+
+        switch (mBreakStrategy) {
+        case OPTIMAL:
+            return mTypesetter.suggestOptimalLineBreaks(
+                    context.startIndex, context.endIndex,
+                    context.leadingLineExtent, getBreakExtent(context, context.leadingLineExtent), leadingLines,
+                    context.trailingLineExtent, getBreakExtent(context, context.trailingLineExtent),
+                    mHyphenPenalty, mWidowPenalty, mTightnessPenalty,
+                    mBreakLookahead, maxLines);
+
+        default:
+            if (canReusePreviousBreaks(context)) {
+                return resolveResyncedBreaks(context);
+            }
+
+            return mTypesetter.suggestForwardLineBreaks(
+                    context.startIndex, context.endIndex,
+                    getBreakExtent(context, context.leadingLineExtent), leadingLines,
+                    getBreakExtent(context, context.trailingLineExtent),
+                    maxLines);
+        }
+    }
+
+    private boolean canReusePreviousBreaks(@NonNull FrameContext context) {
+        return context.previousLines != null && !mFitsHorizontally
+                && context.previousWidth == context.layoutWidth;
+    }
+
+    private float getLineMargin(@NonNull FrameContext context, int lineIndex) {
+        final int leadingLines = Math.max(1, context.leadingLineCount);
+        final float lineExtent = (lineIndex < leadingLines ? context.leadingLineExtent : context.trailingLineExtent);
+
+        return context.layoutWidth - lineExtent;
+    }
+
+    /**
+     * Collects the breaks of previous lines that follow the specified line up to the end of
+     * paragraph, provided that the line exists in previous frame and the following lines cover
+     * the rest of paragraph with the same margins.
+     */
+    private @Nullable int[] findFollowingBreaks(@NonNull FrameContext context, int charShift,
+                                                int lineIndex, int lineStart, int lineEnd) {
+        final List<ComposedLine> previousLines = context.previousLines;
+        final int firstIndex = searchLineIndex(previousLines, lineStart - charShift);
+        if (firstIndex < 0) {
+            return null;
+        }
+
+        final ComposedLine firstLine = previousLines.get(firstIndex);
+        if (firstLine.getCharStart() != lineStart - charShift || firstLine.getCharEnd() != lineEnd - charShift
+                || firstLine.getIntrinsicMargin() != getLineMargin(context, lineIndex)) {
+            return null;
+        }
+
+        final int previousEnd = context.endIndex - charShift;
+        final int maxLines = context.maxLines - context.textLines.size();
+        int nextIndex = firstIndex + 1;
+        int nextLine = lineIndex + 1;
+        int nextEnd = lineEnd - charShift;
+
+        while (nextEnd < previousEnd) {
+            if (nextIndex == previousLines.size() || nextLine == maxLines) {
+                return null;
+            }
+            // The last line might have been truncated.
+            if (mTruncationPlace != null && nextIndex == previousLines.size() - 1) {
+                return null;
+            }
+
+            final ComposedLine previousLine = previousLines.get(nextIndex);
+            if (previousLine.getIntrinsicMargin() != getLineMargin(context, nextLine)) {
+                return null;
+            }
+
+            nextEnd = previousLine.getCharEnd();
+            nextIndex++;
+            nextLine++;
+        }
+
+        if (nextEnd != previousEnd) {
+            return null;
+        }
+
+        final int[] lineBreaks = new int[nextIndex - firstIndex - 1];
+        for (int i = 0; i < lineBreaks.length; i++) {
+            lineBreaks[i] = previousLines.get(firstIndex + 1 + i).getCharEnd() + charShift;
+        }
+
+        return lineBreaks;
+    }
+
+    /**
+     * Breaks a paragraph touched by the edit a few lines at a time until a line after the edit
+     * comes out exactly as a line of previous frame. Greedy breaking of the rest of paragraph
+     * depends only on the text that follows such a line, so the remaining breaks are taken from
+     * the previous frame instead of being resolved again.
+     */
+    private @NonNull int[] resolveResyncedBreaks(@NonNull FrameContext context) {
+        final int leadingLines = Math.max(1, context.leadingLineCount);
+        final int maxLines = context.maxLines - context.textLines.size();
+        final float leadingExtent = getBreakExtent(context, context.leadingLineExtent);
+        final float trailingExtent = getBreakExtent(context, context.trailingLineExtent);
+        final int editEnd = mTypesetter.getEditEnd();
+        final int charShift = mTypesetter.getCharShift();
+
+        int[] lineBreaks = new int[RESYNC_LINES];
+        int lineCount = 0;
+        int lineStart = context.startIndex;
+
+        while (lineStart < context.endIndex && lineCount < maxLines) {
+            final int[] suggestedBreaks = mTypesetter.suggestForwardLineBreaks(
+                    lineStart, context.endIndex,
+                    leadingExtent, Math.max(0, leadingLines - lineCount),
+                    trailingExtent, Math.min(RESYNC_LINES, maxLines - lineCount));
+
+            for (final int lineEnd : suggestedBreaks) {
+                if (lineCount == lineBreaks.length) {
+                    lineBreaks = Arrays.copyOf(lineBreaks, lineCount * 2);
+                }
+                lineBreaks[lineCount] = lineEnd;
+
+                if (lineStart >= editEnd && lineEnd < context.endIndex) {
+                    final int[] followingBreaks = findFollowingBreaks(context, charShift, lineCount, lineStart, lineEnd);
+                    if (followingBreaks != null) {
+                        final int[] allBreaks = Arrays.copyOf(lineBreaks, lineCount + 1 + followingBreaks.length);
+                        System.arraycopy(followingBreaks, 0, allBreaks, lineCount + 1, followingBreaks.length);
+
+                        return allBreaks;
+                    }
+                }
+
+                lineCount++;
+                lineStart = lineEnd;
+            }
+        }
+
+        return Arrays.copyOf(lineBreaks, lineCount);
+    }
+
+    private @Nullable int[] findPreviousBreaks(@NonNull FrameContext context) {
+        final List<ComposedLine> previousLines = context.previousLines;
+        if (!canReusePreviousBreaks(context)) {
+            return null;
+        }
+
+        // Only the paragraphs untouched by the edit break the same way as before.
+        final int charShift;
+        if (context.endIndex <= mTypesetter.getShapedStart()) {
+            charShift = 0;
+        } else if (context.startIndex >= mTypesetter.getShapedEnd()) {
+            charShift = mTypesetter.getCharShift();
+        } else {
+            return null;
+        }
+
+        final int previousStart = context.startIndex - charShift;
+        final int previousEnd = context.endIndex - charShift;
+        final int firstIndex = searchLineIndex(previousLines, previousStart);
+        if (firstIndex < 0 || previousLines.get(firstIndex).getCharStart() != previousStart) {
+            return null;
+        }
+
+        final int leadingLines = Math.max(1, context.leadingLineCount);
+        final int maxLines = context.maxLines - context.textLines.size();
+        final float leadingMargin = context.layoutWidth - context.leadingLineExtent;
+        final float trailingMargin = context.layoutWidth - context.trailingLineExtent;
+
+        // The previous lines must cover the paragraph with the same extents.
+        int lineIndex = firstIndex;
+        int lineEnd = previousStart;
+
+        while (lineEnd < previousEnd) {
+            final int lineCount = lineIndex - firstIndex;
+            if (lineIndex == previousLines.size() || lineCount == maxLines) {
+                return null;
+            }
+            // The last line might have been truncated.
+            if (mTruncationPlace != null && lineIndex == previousLines.size() - 1) {
+                return null;
+            }
+
+            final ComposedLine previousLine = previousLines.get(lineIndex);
+            final float lineMargin = (lineCount < leadingLines ? leadingMargin : trailingMargin);
+            if (previousLine.getIntrinsicMargin() != lineMargin) {
+                return null;
+            }
+
+            lineEnd = previousLine.getCharEnd();
+            lineIndex++;
+        }
+
+        if (lineEnd != previousEnd) {
+            return null;
+        }
+
+        final int[] lineBreaks = new int[lineIndex - firstIndex];
+        for (int i = 0; i < lineBreaks.length; i++) {
+            lineBreaks[i] = previousLines.get(firstIndex + i).getCharEnd() + charShift;
+        }
+
+        return lineBreaks;
+    }
+
     private void setupParagraphSpans(@NonNull FrameContext context) {
         // Extract all spans of this paragraph.
         context.paragraphSpans = mSpanned.getSpans(context.startIndex, context.endIndex, ParagraphStyle.class);
@@ -588,7 +998,7 @@ public class FrameResolver {
 
             // Fix span top in case it starts in a previous paragraph.
             if (spanStart < context.startIndex) {
-                final int lineIndex = searchLineIndex(context, spanStart);
+                final int lineIndex = searchLineIndex(context.textLines, spanStart);
                 final ComposedLine spanLine = context.textLines.get(lineIndex);
                 spanTop = (int) (spanLine.getTop() + 0.5f);
             }
@@ -597,9 +1007,7 @@ public class FrameResolver {
         }
     }
 
-    private int searchLineIndex(@NonNull FrameContext context, int charIndex) {
-        final List<ComposedLine> textLines = context.textLines;
-
+    private static int searchLineIndex(@NonNull List<ComposedLine> textLines, int charIndex) {
         int low = 0;
         int high = textLines.size() - 1;
 
@@ -619,6 +1027,131 @@ public class FrameResolver {
         return -1;
     }
 
+    private @NonNull ComposedLine createLine(@NonNull FrameContext context, int lineStart, int lineEnd) {
+        final ComposedLine composedLine;
+        final ComposedLine previousLine = findPreviousLine(context, lineStart, lineEnd);
+
+        if (previousLine != null) {
+            final int charShift = lineStart - previousLine.getCharStart();
+            if (charShift == 0 && isLineInPlace(context, previousLine)) {
+                return previousLine;
+            }
+
+            composedLine = mTypesetter.createShiftedLine(previousLine, charShift);
+            composedLine.setJustified(previousLine.isJustified());
+        } else {
+            composedLine = mTypesetter.createSimpleLine(lineStart, lineEnd);
+        }
+
+        resolveAttributes(context, composedLine);
+
+        return composedLine;
+    }
+
+    /**
+     * Checks whether a line of previous frame would be resolved exactly as it is at the current
+     * position, so that it can be kept in the new frame without any change. Lines are not moved
+     * afterwards only if they are aligned to the top or the frame fits them vertically.
+     */
+    private boolean isLineInPlace(@NonNull FrameContext context, @NonNull ComposedLine previousLine) {
+        if (mVerticalAlignment != VerticalAlignment.TOP && !mFitsVertically) {
+            return false;
+        }
+        if (mFitsHorizontally || !hasResolvedMetrics(context, previousLine)) {
+            return false;
+        }
+
+        final float originX = context.leadingOffset + previousLine.getFlushPenOffset(context.flushFactor, context.lineExtent);
+        final float originY = context.lineTop + previousLine.getAscent();
+
+        return previousLine.getOriginX() == originX
+                && previousLine.getOriginY() == originY
+                && previousLine.isFirst() == (context.leadingLineCount > 0)
+                && previousLine.getIntrinsicMargin() == context.layoutWidth - context.lineExtent
+                && previousLine.getFlushFactor() == context.flushFactor
+                && Arrays.equals(previousLine.getSpans(), context.paragraphSpans);
+    }
+
+    /**
+     * Checks whether the metrics of a line are the ones that the current height settings produce
+     * from its runs. The line height spans are never assumed to choose the same height again.
+     */
+    private boolean hasResolvedMetrics(@NonNull FrameContext context, @NonNull ComposedLine textLine) {
+        if (context.pickHeightSpans.length > 0) {
+            return false;
+        }
+
+        float ascent = 0.0f;
+        float descent = 0.0f;
+        float leading = 0.0f;
+
+        for (TextRun textRun : textLine.getTextRuns()) {
+            ascent = Math.max(ascent, textRun.getAscent());
+            descent = Math.max(descent, textRun.getDescent());
+            leading = Math.max(leading, textRun.getLeading());
+        }
+
+        if (mLineHeightMultiplier != 0.0f) {
+            final float oldHeight = ascent + descent + leading;
+            final float newHeight = oldHeight * mLineHeightMultiplier;
+            final float midOffset = (newHeight - oldHeight) / 2.0f;
+
+            ascent += midOffset;
+            descent += midOffset;
+        }
+        if (mExtraLineSpacing != 0.0f) {
+            leading += mExtraLineSpacing;
+        }
+
+        return textLine.getAscent() == ascent
+                && textLine.getDescent() == descent
+                && textLine.getLeading() == leading;
+    }
+
+    private @Nullable ComposedLine findPreviousLine(@NonNull FrameContext context, int lineStart, int lineEnd) {
+        final List<ComposedLine> previousLines = context.previousLines;
+        if (previousLines == null) {
+            return null;
+        }
+
+        // Only the lines of untouched paragraphs can be reused.
+        final int charShift;
+        if (lineEnd <= mTypesetter.getShapedStart()) {
+            charShift = 0;
+        } else if (lineStart >= mTypesetter.getShapedEnd()) {
+            charShift = mTypesetter.getCharShift();
+        } else {
+            return null;
+        }
+
+        final int previousStart = lineStart - charShift;
+        final int previousEnd = lineEnd - charShift;
+        final int lineIndex = searchLineIndex(previousLines, previousStart);
+        if (lineIndex < 0) {
+            return null;
+        }
+
+        final ComposedLine previousLine = previousLines.get(lineIndex);
+        if (previousLine.getCharStart() != previousStart || previousLine.getCharEnd() != previousEnd) {
+            return null;
+        }
+
+        // The last line might have been truncated.
+        if (mTruncationPlace != null && lineIndex == previousLines.size() - 1) {
+            return null;
+        }
+
+        // The justification must be resolved again if the frame width has changed. Otherwise, the
+        // line is justified exactly as before since its paragraph has not changed.
+        if (previousLine.isJustified()) {
+            if (!mJustificationEnabled || mFitsHorizontally || context.previousWidth != context.layoutWidth) {
+                return null;
+            }
+        }
+
+        return previousLine;
+    }
+
     private void resolveLeadingMargins(@NonNull FrameContext context) {
         context.leadingLineExtent = context.layoutWidth;
         context.trailingLineExtent = context.layoutWidth;
@@ -670,9 +1203,17 @@ public class FrameResolver {
         }
     }
 
+    private float getExtraWidth(@NonNull FrameContext context, float lineExtent) {
+        float adjustableWidth = lineExtent / 4.0f;
+        return adjustableWidth * context.justificationMultiplier;
+    }
+
+    private float getBreakExtent(@NonNull FrameContext context, float lineExtent) {
+        return lineExtent + getExtraWidth(context, lineExtent);
+    }
+
     private void resolveExtraWidth(@NonNull FrameContext context) {
-        float adjustableWidth = context.lineExtent / 4.0f;
-        context.extraWidth = adjustableWidth * context.justificationMultiplier;
+        context.extraWidth = getExtraWidth(context, context.lineExtent);
     }
 
     private void resolveLeadingOffset(@NonNull FrameContext context) {
@@ -791,15 +1332,19 @@ public class FrameResolver {
             // Find out the additional top for vertical alignment.
             final float verticalMultiplier = getVerticalMultiplier();
             final float remainingHeight = context.layoutHeight - occupiedHeight;
-            final float additionalTop = remainingHeight * verticalMultiplier;
 
-            // Readjust the vertical position of each line.
-            for (int i = 0; i < lineCount; i++) {
-                final ComposedLine composedLine = textLines.get(i);
-                final float oldTop = composedLine.getOriginY();
-                final float adjustedTop = oldTop + additionalTop;
+            // Top aligned lines stay where they are, even if the frame height is infinite.
+            if (verticalMultiplier != 0.0f) {
+                final float additionalTop = remainingHeight * verticalMultiplier;
+
+                // Readjust the vertical position of each line.
+                for (int i = 0; i < lineCount; i++) {
+                    final ComposedLine composedLine = textLines.get(i);
+                    final float oldTop = composedLine.getOriginY();
+                    final float adjustedTop = oldTop + additionalTop;
 
-                composedLine.setOriginY(adjustedTop);
+                    composedLine.setOriginY(adjustedTop);
+                }
             }
         }
 
@@ -851,8 +1396,12 @@ public class FrameResolver {
                 final int charEnd = textLine.getCharEnd();
 
                 // Skip the last line of paragraph if it's smaller in width.
-                if ((charEnd == mSpanned.length() || mSpanned.charAt(charEnd - 1) == '\n')
-                        && textLine.getWidth() <= context.layoutWidth) {
+                if (isParagraphEnd(charEnd) && textLine.getWidth() <= context.layoutWidth) {
+                    continue;
+                }
+
+                // Keep the reused lines which are already justified for the same width.
+                if (textLine.isJustified()) {
                     continue;
                 }
 
@@ -875,6 +1424,7 @@ public class FrameResolver {
                 justifiedLine.setFirst(textLine.isFirst());
                 justifiedLine.setIntrinsicMargin(textLine.getIntrinsicMargin());
                 justifiedLine.setFlushFactor(textLine.getFlushFactor());
+                justifiedLine.setJustified(true);
 
                 // Setup the line metrics.
                 justifiedLine.setAscent(textLine.getAscent());
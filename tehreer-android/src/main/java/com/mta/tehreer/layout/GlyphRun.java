@@ -38,28 +38,20 @@ import static com.mta.tehreer.internal.util.Preconditions.checkArgument;
  * and direction.
  */
 public class GlyphRun {
-    private TextRun textRun;
-    private float originX;
-    private float originY;
+    private final @NonNull TextRun textRun;
+    private final float originX;
+    private final float originY;
 
-    GlyphRun(TextRun textRun) {
+    GlyphRun(@NonNull TextRun textRun, float originX, float originY) {
         this.textRun = textRun;
+        this.originX = originX;
+        this.originY = originY;
     }
 
-    GlyphRun(@NonNull GlyphRun otherRun) {
-        this.textRun = otherRun.textRun;
-        this.originX = otherRun.originX;
-        this.originY = otherRun.originY;
-    }
-
-    TextRun getTextRun() {
+    @NonNull TextRun getTextRun() {
         return textRun;
     }
 
-    void setTextRun(TextRun textRun) {
-        this.textRun = textRun;
-    }
-
     private void checkCharIndex(int charIndex) {
         final int charStart = textRun.getStartIndex();
         final int charEnd = textRun.getEndIndex();
@@ -234,10 +226,6 @@ public class GlyphRun {
         return originX;
     }
 
-    void setOriginX(float originX) {
-        this.originX = originX;
-    }
-
     /**
      * Returns the y- origin of this run in parent line.
      *
@@ -247,10 +235,6 @@ public class GlyphRun {
         return originY;
     }
 
-    void setOriginY(float originY) {
-        this.originY = originY;
-    }
-
     /**
      * Returns the ascent of this run. The ascent is the distance from the top of the
      * <code>GlyphRun</code> to the baseline. It is always either positive or zero.
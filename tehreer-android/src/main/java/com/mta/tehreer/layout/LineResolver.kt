@@ -24,28 +24,41 @@ import com.mta.tehreer.internal.util.getLeadingWhitespaceEnd
 import com.mta.tehreer.internal.util.getNextSpace
 import com.mta.tehreer.internal.util.getTrailingWhitespaceStart
 import com.mta.tehreer.internal.util.isEven
-import com.mta.tehreer.unicode.BidiRun
+import com.mta.tehreer.internal.util.isOdd
+import com.mta.tehreer.sfnt.WritingDirection
 import java.util.*
 import kotlin.math.max
 import kotlin.math.min
 
-private fun createGlyphRun(
+// The maximum width of a kashida in terms of tatweel advance.
+private const val KASHIDA_LIMIT = 3.0f
+
+private class KashidaPoint(
+    val runIndex: Int,
+    val glyphIndex: Int,
+    val priority: Int,
+    val maxWidth: Float
+)
+
+private fun createLineRun(
     textRun: TextRun, spanStart: Int, spanEnd: Int,
     spans: Array<Any>
-): GlyphRun {
-    var innerRun = textRun
-    if (innerRun is IntrinsicRun) {
-        innerRun = IntrinsicRunSlice(innerRun, spanStart, spanEnd, listOf(*spans))
+): TextRun {
+    if (textRun is IntrinsicRun) {
+        return IntrinsicRunSlice(textRun, spanStart, spanEnd, spans.asList())
     }
 
-    return GlyphRun(innerRun)
+    return textRun
 }
 
 private fun createComposedLine(
     text: CharSequence, charStart: Int, charEnd: Int,
-    runList: List<GlyphRun>,
+    runList: List<TextRun>,
     paragraphLevel: Byte
 ): ComposedLine {
+    val runCount = runList.size
+    val runOrigins = FloatArray(runCount)
+
     var lineAscent = 0.0f
     var lineDescent = 0.0f
     var lineLeading = 0.0f
@@ -54,41 +67,40 @@ private fun createComposedLine(
     val trailingWhitespaceStart = text.getTrailingWhitespaceStart(charStart, charEnd)
     var trailingWhitespaceExtent = 0.0f
 
-    for (glyphRun in runList) {
-        glyphRun.originX = lineExtent
+    for (i in 0 until runCount) {
+        val textRun = runList[i]
+        runOrigins[i] = lineExtent
 
-        val wsStart = max(glyphRun.charStart, trailingWhitespaceStart)
-        val wsEnd = min(glyphRun.charEnd, charEnd)
+        val wsStart = max(textRun.startIndex, trailingWhitespaceStart)
+        val wsEnd = min(textRun.endIndex, charEnd)
         if (wsStart < wsEnd) {
-            trailingWhitespaceExtent += glyphRun.computeRangeDistance(wsStart, wsEnd)
+            trailingWhitespaceExtent += textRun.getRangeDistance(wsStart, wsEnd)
         }
 
-        lineAscent = max(lineAscent, glyphRun.ascent)
-        lineDescent = max(lineDescent, glyphRun.descent)
-        lineLeading = max(lineLeading, glyphRun.leading)
-        lineExtent += glyphRun.width
+        lineAscent = max(lineAscent, textRun.ascent)
+        lineDescent = max(lineDescent, textRun.descent)
+        lineLeading = max(lineLeading, textRun.leading)
+        lineExtent += textRun.width
     }
 
     return ComposedLine(
         charStart, charEnd, paragraphLevel,
         lineAscent, lineDescent, lineLeading, lineExtent,
-        trailingWhitespaceExtent, Collections.unmodifiableList(runList)
+        trailingWhitespaceExtent, runList.toTypedArray(), runOrigins
     )
 }
 
 internal class LineResolver(
+    private val text: String,
     private val spanned: Spanned,
     private val bidiParagraphs: ParagraphCollection,
     private val intrinsicRuns: RunCollection
 ) {
     fun createSimpleLine(start: Int, end: Int): ComposedLine {
-        val runList = mutableListOf<GlyphRun>()
+        val runList = mutableListOf<TextRun>()
 
         bidiParagraphs.forEachLineRun(start, end, object : RunConsumer {
-            override fun accept(bidiRun: BidiRun) {
-                val visualStart = bidiRun.charStart
-                val visualEnd = bidiRun.charEnd
-
+            override fun accept(visualStart: Int, visualEnd: Int, embeddingLevel: Byte) {
                 addVisualRuns(visualStart, visualEnd, runList)
             }
         })
@@ -99,6 +111,40 @@ internal class LineResolver(
         )
     }
 
+    /**
+     * Recreates a line of previous typesetter at its new position without resolving its runs
+     * again. The line must lie in a paragraph that was not touched by the edit, so its extents
+     * and run origins are carried over as they are.
+     */
+    fun createShiftedLine(line: ComposedLine, charShift: Int): ComposedLine {
+        val shiftedRuns = Array(line.textRuns.size) {
+            val textRun = line.textRuns[it]
+            if (textRun is ReplacementRun) {
+                // Replacement spans draw from the source text, so pick the run of new text.
+                intrinsicRuns[intrinsicRuns.binarySearch(textRun.startIndex + charShift)]
+            } else {
+                ShiftedRun.of(textRun, charShift)
+            }
+        }
+
+        // The metrics of previous line might have been adjusted by its frame.
+        var lineAscent = 0.0f
+        var lineDescent = 0.0f
+        var lineLeading = 0.0f
+
+        for (textRun in shiftedRuns) {
+            lineAscent = max(lineAscent, textRun.ascent)
+            lineDescent = max(lineDescent, textRun.descent)
+            lineLeading = max(lineLeading, textRun.leading)
+        }
+
+        return ComposedLine(
+            line.charStart + charShift, line.charEnd + charShift, line.paragraphLevel,
+            lineAscent, lineDescent, lineLeading, line.width,
+            line.trailingWhitespaceExtent, shiftedRuns, line.runOrigins
+        )
+    }
+
     fun createCompactLine(
         start: Int, end: Int, extent: Float,
         breakResolver: BreakResolver,
@@ -126,16 +172,13 @@ internal class LineResolver(
         val charEnd: Int,
         val skipStart: Int,
         val skipEnd: Int,
-        val runList: MutableList<GlyphRun>
+        val runList: MutableList<TextRun>
     ) : RunConsumer {
         var leadingTokenIndex = -1
         var trailingTokenIndex = -1
 
-        override fun accept(bidiRun: BidiRun) {
-            val visualStart = bidiRun.charStart
-            val visualEnd = bidiRun.charEnd
-
-            if (bidiRun.isRightToLeft) {
+        override fun accept(visualStart: Int, visualEnd: Int, embeddingLevel: Byte) {
+            if (embeddingLevel.isOdd()) {
                 // Handle second part of characters.
                 if (visualEnd >= skipEnd) {
                     addVisualRuns(max(visualStart, skipEnd), visualEnd, runList)
@@ -186,7 +229,7 @@ internal class LineResolver(
     ): ComposedLine {
         val truncatedStart = breakResolver.suggestBackwardBreak(start, end, tokenlessWidth, mode)
         if (truncatedStart > start) {
-            val runList = ArrayList<GlyphRun>()
+            val runList = ArrayList<TextRun>()
             var tokenInsertIndex = 0
 
             if (truncatedStart < end) {
@@ -222,7 +265,7 @@ internal class LineResolver(
             firstMidEnd = spanned.getTrailingWhitespaceStart(start, firstMidEnd)
             secondMidStart = spanned.getLeadingWhitespaceEnd(secondMidStart, end)
 
-            val runList = mutableListOf<GlyphRun>()
+            val runList = mutableListOf<TextRun>()
             var tokenInsertIndex = 0
 
             if (start < firstMidEnd || secondMidStart < end) {
@@ -253,7 +296,7 @@ internal class LineResolver(
             // Exclude trailing whitespaces as truncation token replaces them.
             truncatedEnd = spanned.getTrailingWhitespaceStart(start, truncatedEnd)
 
-            val runList = mutableListOf<GlyphRun>()
+            val runList = mutableListOf<TextRun>()
             var tokenInsertIndex = 0
 
             if (start < truncatedEnd) {
@@ -273,18 +316,11 @@ internal class LineResolver(
         return createSimpleLine(start, truncatedEnd)
     }
 
-    private fun addTokenRuns(token: ComposedLine, runList: MutableList<GlyphRun>, index: Int) {
-        var insertIndex = index
-
-        for (truncationRun in token.runs) {
-            val modifiedRun = GlyphRun(truncationRun)
-            runList.add(insertIndex, modifiedRun)
-
-            insertIndex++
-        }
+    private fun addTokenRuns(token: ComposedLine, runList: MutableList<TextRun>, index: Int) {
+        runList.addAll(index, token.textRuns.asList())
     }
 
-    private fun addVisualRuns(fromIndex: Int, toIndex: Int, runList: MutableList<GlyphRun>) {
+    private fun addVisualRuns(fromIndex: Int, toIndex: Int, runList: MutableList<TextRun>) {
         var visualStart = fromIndex
 
         if (visualStart < toIndex) {
@@ -315,8 +351,8 @@ internal class LineResolver(
                     val spanEnd = spanned.nextSpanTransition(spanStart, feasibleEnd, Any::class.java)
                     val spans = spanned.getSpans(spanStart, spanEnd, Any::class.java)
 
-                    val glyphRun = createGlyphRun(textRun, spanStart, spanEnd, spans)
-                    runList.add(insertIndex, glyphRun)
+                    val lineRun = createLineRun(textRun, spanStart, spanEnd, spans)
+                    runList.add(insertIndex, lineRun)
 
                     if (isForwardRun) {
                         insertIndex++
@@ -343,28 +379,46 @@ internal class LineResolver(
         val extraWidth = justificationWidth - actualWidth
         val availableWidth = extraWidth * justificationFactor
 
-        val innerSpaceCount = computeSpaceCount(wordStart, wordEnd)
-        val spaceAddition = availableWidth / innerSpaceCount
-
-        val runList = mutableListOf<GlyphRun>()
+        val runList = mutableListOf<TextRun>()
         bidiParagraphs.forEachLineRun(charStart, charEnd, object : RunConsumer {
-            override fun accept(bidiRun: BidiRun) {
-                addVisualRuns(bidiRun.charStart, bidiRun.charEnd, runList)
+            override fun accept(visualStart: Int, visualEnd: Int, embeddingLevel: Byte) {
+                addVisualRuns(visualStart, visualEnd, runList)
             }
         })
 
         val runCount = runList.size
+        val kashidaGlyphIds = IntArray(runCount)
+        val kashidaWidths = arrayOfNulls<FloatArray>(runCount)
+        var kashidaAddition = 0.0f
+
+        // Elongate joined letters before widening the spaces.
+        if (availableWidth > 0.0f) {
+            kashidaAddition = distributeKashidas(
+                runList, wordStart, wordEnd, availableWidth,
+                kashidaGlyphIds, kashidaWidths
+            )
+        }
+
+        val innerSpaceCount = computeSpaceCount(wordStart, wordEnd)
+        val spaceAddition = (availableWidth - kashidaAddition) / innerSpaceCount
+
         for (i in 0 until runCount) {
-            val glyphRun = runList[i]
-            val textRun = glyphRun.textRun
+            val textRun = runList[i]
             if (textRun is ReplacementRun) {
                 continue
             }
 
-            val glyphAdvances = glyphRun.glyphAdvances.toArray()
+            val glyphAdvances = textRun.glyphAdvances.toArray()
+
+            val runKashidas = kashidaWidths[i]
+            if (runKashidas != null) {
+                for (k in glyphAdvances.indices) {
+                    glyphAdvances[k] += runKashidas[k]
+                }
+            }
 
-            val runStart = max(wordStart, glyphRun.charStart)
-            val runEnd = min(wordEnd, glyphRun.charEnd)
+            val runStart = max(wordStart, textRun.startIndex)
+            val runEnd = min(wordEnd, textRun.endIndex)
 
             var j = runStart
             while (j < runEnd) {
@@ -391,9 +445,9 @@ internal class LineResolver(
             }
 
             val justifiedAdvances = FloatList.of(*glyphAdvances)
-            val justifiedRun = JustifiedRun(textRun, justifiedAdvances)
+            val justifiedRun = JustifiedRun(textRun, justifiedAdvances, kashidaGlyphIds[i], runKashidas)
 
-            glyphRun.textRun = justifiedRun
+            runList[i] = justifiedRun
         }
 
         val paragraphLevel = bidiParagraphs.getBaseLevel(charStart)
@@ -401,6 +455,80 @@ internal class LineResolver(
         return createComposedLine(spanned, charStart, charEnd, runList, paragraphLevel)
     }
 
+    private fun distributeKashidas(
+        runList: List<TextRun>, wordStart: Int, wordEnd: Int,
+        availableWidth: Float,
+        kashidaGlyphIds: IntArray,
+        kashidaWidths: Array<FloatArray?>
+    ): Float {
+        val points = mutableListOf<KashidaPoint>()
+
+        for (i in runList.indices) {
+            val textRun = runList[i]
+            if (textRun is ReplacementRun || textRun.bidiLevel.isEven() || textRun.isBackward
+                || textRun.writingDirection != WritingDirection.RIGHT_TO_LEFT) {
+                continue
+            }
+
+            val runStart = max(wordStart, textRun.startIndex)
+            val runEnd = min(wordEnd, textRun.endIndex)
+            if (runStart >= runEnd) {
+                continue
+            }
+
+            val typeface = textRun.typeface
+            val kashidaGlyphId = KashidaLocator.getTatweelGlyphId(typeface)
+            if (kashidaGlyphId == 0) {
+                continue
+            }
+
+            val clusterMap = IntArray(runEnd - runStart) { textRun.getLeadingGlyphIndex(runStart + it) }
+            val opportunities = KashidaLocator.locate(text, runStart, runEnd, clusterMap)
+            if (opportunities.isEmpty()) {
+                continue
+            }
+
+            val kashidaAdvance = typeface.getGlyphAdvance(kashidaGlyphId, textRun.typeSize, false)
+            val maxWidth = kashidaAdvance * KASHIDA_LIMIT
+
+            for (j in opportunities.indices step 2) {
+                val glyphIndex = textRun.getLeadingGlyphIndex(opportunities[j])
+                points.add(KashidaPoint(i, glyphIndex, opportunities[j + 1], maxWidth))
+            }
+
+            kashidaGlyphIds[i] = kashidaGlyphId
+            kashidaWidths[i] = FloatArray(textRun.glyphCount)
+        }
+
+        // Fill the opportunities level by level, evenly within a level.
+        points.sortBy { it.priority }
+
+        var remainingWidth = availableWidth
+        var levelStart = 0
+
+        while (levelStart < points.size && remainingWidth > 0.0f) {
+            val priority = points[levelStart].priority
+            var levelEnd = levelStart + 1
+            while (levelEnd < points.size && points[levelEnd].priority == priority) {
+                levelEnd++
+            }
+
+            val share = remainingWidth / (levelEnd - levelStart)
+
+            for (k in levelStart until levelEnd) {
+                val point = points[k]
+                val width = min(share, point.maxWidth)
+
+                kashidaWidths[point.runIndex]!![point.glyphIndex] += width
+                remainingWidth -= width
+            }
+
+            levelStart = levelEnd
+        }
+
+        return availableWidth - remainingWidth
+    }
+
     private fun computeSpaceCount(startIndex: Int, endIndex: Int): Int {
         var spaceCount = 0
 
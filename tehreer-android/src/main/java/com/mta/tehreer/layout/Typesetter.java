@@ -49,10 +49,17 @@ import static com.mta.tehreer.internal.util.Preconditions.checkNotNull;
 public class Typesetter {
     private String mText;
     private Spanned mSpanned;
+    private List<Object> mDefaultSpans;
+    private @NonNull WritingMode mWritingMode = WritingMode.HORIZONTAL;
     private ParagraphCollection mBidiParagraphs;
     private RunCollection mIntrinsicRuns;
+    private BreakClassifier mBreakClassifier;
     private LineResolver mLineResolver;
     private BreakResolver mBreakResolver;
+    private int mShapedStart;
+    private int mShapedEnd;
+    private int mCharShift;
+    private int mEditEnd;
 
     /**
      * Constructs the typesetter object using given text, typeface and type size.
@@ -72,7 +79,7 @@ public class Typesetter {
         spanned.setSpan(new TypefaceSpan(typeface), 0, text.length(), Spanned.SPAN_INCLUSIVE_INCLUSIVE);
         spanned.setSpan(new TypeSizeSpan(typeSize), 0, text.length(), Spanned.SPAN_INCLUSIVE_INCLUSIVE);
 
-        init(text, spanned, null);
+        init(text, spanned, null, WritingMode.HORIZONTAL);
 	}
 
     /**
@@ -87,29 +94,100 @@ public class Typesetter {
     }
 
     public Typesetter(@NonNull Spanned spanned, @Nullable List<Object> defaultSpans) {
+        this(spanned, defaultSpans, WritingMode.HORIZONTAL);
+    }
+
+    /**
+     * Constructs the typesetter object using a spanned text whose lines flow in the specified
+     * writing mode. The text of a vertical typesetter is shaped from top to bottom, so its lines
+     * measure the extent of columns rather than rows.
+     *
+     * @param spanned The spanned text to typeset.
+     * @param defaultSpans The spans to apply beneath the spans of the text, or <code>null</code>.
+     * @param writingMode The writing mode of the lines.
+     *
+     * @throws IllegalArgumentException if <code>spanned</code> is empty.
+     */
+    public Typesetter(@NonNull Spanned spanned, @Nullable List<Object> defaultSpans,
+                      @NonNull WritingMode writingMode) {
+        checkNotNull(spanned, "spanned");
+        checkNotNull(writingMode, "writingMode");
+        checkArgument(spanned.length() > 0, "Text is empty");
+
+        init(StringUtils.copyString(spanned), spanned, defaultSpans, writingMode);
+    }
+
+    /**
+     * Constructs the typesetter object for an edited version of the text of another typesetter.
+     * Only the paragraphs touched by the edit are shaped again, the rest of the paragraphs reuse
+     * the results of previous typesetter. The spans outside the edited range must not have been
+     * changed.
+     *
+     * @param previous The typesetter of the text before the edit.
+     * @param spanned The spanned text after the edit.
+     * @param editStart The index at which the edit starts.
+     * @param oldEnd The end of edited range in the text before the edit.
+     * @param newEnd The end of edited range in the text after the edit.
+     *
+     * @throws IllegalArgumentException if <code>spanned</code> is empty, or the edited range is
+     *         invalid for either of the texts.
+     */
+    public Typesetter(@NonNull Typesetter previous, @NonNull Spanned spanned,
+                      int editStart, int oldEnd, int newEnd) {
+        checkNotNull(previous, "previous");
         checkNotNull(spanned, "spanned");
         checkArgument(spanned.length() > 0, "Text is empty");
+        checkArgument(editStart >= 0, "Edit Start: " + editStart);
+        checkArgument(oldEnd >= editStart && oldEnd <= previous.mText.length(),
+                      "Old End: " + oldEnd + ", Text Length: " + previous.mText.length());
+        checkArgument(newEnd >= editStart && newEnd <= spanned.length(),
+                      "New End: " + newEnd + ", Text Length: " + spanned.length());
+        checkArgument(previous.mText.length() - oldEnd == spanned.length() - newEnd,
+                      "Unedited suffix differs in length");
+
+        mText = StringUtils.copyString(spanned);
+        mSpanned = spanned;
+        mDefaultSpans = previous.mDefaultSpans;
+        mWritingMode = previous.mWritingMode;
+        mCharShift = newEnd - oldEnd;
+        mEditEnd = newEnd;
+
+        ShapeResolver shapeResolver = new ShapeResolver(mText, mSpanned, mDefaultSpans, isVertical());
+        Pair<ParagraphCollection, RunCollection> shapeResult = shapeResolver.createParagraphsAndRuns(
+                previous.mBidiParagraphs, previous.mIntrinsicRuns, editStart, oldEnd, newEnd);
+        mBidiParagraphs = shapeResult.getFirst();
+        mIntrinsicRuns = shapeResult.getSecond();
+        mShapedStart = shapeResolver.getShapedStart();
+        mShapedEnd = shapeResolver.getShapedEnd();
 
-        init(StringUtils.copyString(spanned), spanned, defaultSpans);
+        mBreakClassifier = new BreakClassifier(mText, previous.mBreakClassifier,
+                                               mShapedStart, mShapedEnd, mCharShift);
+        mLineResolver = new LineResolver(mText, spanned, mBidiParagraphs, mIntrinsicRuns);
+        mBreakResolver = new BreakResolver(mText, mBidiParagraphs, mIntrinsicRuns, mBreakClassifier);
     }
 
-    private void init(@NonNull String text, @NonNull Spanned spanned, @Nullable List<Object> defaultSpans) {
+    private void init(@NonNull String text, @NonNull Spanned spanned,
+                      @Nullable List<Object> defaultSpans, @NonNull WritingMode writingMode) {
         mText = text;
         mSpanned = spanned;
+        mWritingMode = writingMode;
 
         if (defaultSpans == null) {
             defaultSpans = Collections.emptyList();
         }
+        mDefaultSpans = defaultSpans;
 
-        ShapeResolver shapeResolver = new ShapeResolver(mText, mSpanned, defaultSpans);
+        ShapeResolver shapeResolver = new ShapeResolver(mText, mSpanned, defaultSpans, isVertical());
         Pair<ParagraphCollection, RunCollection> shapeResult = shapeResolver.createParagraphsAndRuns();
         mBidiParagraphs = shapeResult.getFirst();
         mIntrinsicRuns = shapeResult.getSecond();
+        mShapedStart = 0;
+        mShapedEnd = text.length();
 
-        mLineResolver = new LineResolver(spanned, mBidiParagraphs, mIntrinsicRuns);
+        mLineResolver = new LineResolver(mText, spanned, mBidiParagraphs, mIntrinsicRuns);
 
-        BreakClassifier breakClassifier = new BreakClassifier(text);
-        mBreakResolver = new BreakResolver(mText, mBidiParagraphs, mIntrinsicRuns, breakClassifier);
+        mBreakClassifier = new BreakClassifier(text);
+        mBreakResolver = new BreakResolver(mText, mBidiParagraphs, mIntrinsicRuns, mBreakClassifier);
     }
 
     /**
@@ -121,6 +199,19 @@ public class Typesetter {
         return mSpanned;
     }
 
+    /**
+     * Returns the writing mode in which the lines of this typesetter flow.
+     *
+     * @return The writing mode of this typesetter.
+     */
+    public @NonNull WritingMode getWritingMode() {
+        return mWritingMode;
+    }
+
+    boolean isVertical() {
+        return mWritingMode == WritingMode.VERTICAL;
+    }
+
     ParagraphCollection getParagraphs() {
         return mBidiParagraphs;
     }
@@ -129,6 +220,38 @@ public class Typesetter {
         return mIntrinsicRuns;
     }
 
+    /**
+     * Returns the start of the text range that was shaped afresh by this typesetter. The text
+     * outside of this range reuses the results of a previous typesetter.
+     */
+    int getShapedStart() {
+        return mShapedStart;
+    }
+
+    int getShapedEnd() {
+        return mShapedEnd;
+    }
+
+    /**
+     * Returns the amount by which the text after the shaped range has moved with respect to the
+     * previous typesetter.
+     */
+    int getCharShift() {
+        return mCharShift;
+    }
+
+    /**
+     * Returns the end of edited range in the text of this typesetter. The text after it is the
+     * same as the text of previous typesetter.
+     */
+    int getEditEnd() {
+        return mEditEnd;
+    }
+
+    ComposedLine createShiftedLine(@NonNull ComposedLine line, int charShift) {
+        return mLineResolver.createShiftedLine(line, charShift);
+    }
+
     private void checkSubRange(int charStart, int charEnd) {
         checkArgument(charStart >= 0, "Char Start: " + charStart);
         checkArgument(charEnd <= mText.length(), "Char End: " + charEnd + ", Text Length: " + mText.length());
@@ -181,6 +304,26 @@ public class Typesetter {
         return mBreakResolver.suggestBackwardBreak(charStart, charEnd, breakExtent, breakMode);
     }
 
+    int[] suggestForwardLineBreaks(int charStart, int charEnd,
+                                   float leadingExtent, int leadingLines,
+                                   float trailingExtent, int maxLines) {
+        return mBreakResolver.suggestForwardLineBreaks(charStart, charEnd,
+                                                       leadingExtent, leadingLines,
+                                                       trailingExtent, maxLines);
+    }
+
+    int[] suggestOptimalLineBreaks(int charStart, int charEnd,
+                                   float leadingExtent, float leadingLimit, int leadingLines,
+                                   float trailingExtent, float trailingLimit,
+                                   float hyphenPenalty, float widowPenalty, float tightnessPenalty,
+                                   int lookahead, int maxLines) {
+        return mBreakResolver.suggestOptimalLineBreaks(charStart, charEnd,
+                                                       leadingExtent, leadingLimit, leadingLines,
+                                                       trailingExtent, trailingLimit,
+                                                       hyphenPenalty, widowPenalty, tightnessPenalty,
+                                                       lookahead, maxLines);
+    }
+
     /**
      * Creates a simple line of specified string range.
      *
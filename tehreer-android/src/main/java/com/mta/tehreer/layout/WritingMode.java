@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.layout;
+
+/**
+ * Specifies the direction in which the lines of text flow.
+ */
+public enum WritingMode {
+    /**
+     * Lines are horizontal and are placed from top to bottom.
+     */
+    HORIZONTAL,
+    /**
+     * Lines are vertical and are placed from right to left. The glyphs are shaped with vertical
+     * metrics of the typefaces and are kept upright, as in vertical Chinese and Japanese text.
+     */
+    VERTICAL,
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.mta.tehreer.layout.style;
+
+import android.text.TextPaint;
+import android.text.style.MetricAffectingSpan;
+
+import androidx.annotation.NonNull;
+
+import com.mta.tehreer.graphics.Typeface;
+
+import java.util.List;
+
+import static com.mta.tehreer.internal.util.Preconditions.checkNotNull;
+
+/**
+ * The <code>FallbackSpan</code> class represents a span for specifying the typefaces that are used
+ * for the characters not supported by the primary typeface. The characters are matched against the
+ * fallback typefaces in the given order, keeping each grapheme cluster in a single typeface.
+ */
+public class FallbackSpan extends MetricAffectingSpan {
+
+    private final @NonNull List<Typeface> typefaces;
+
+    /**
+     * Constructs a fallback span object.
+     *
+     * @param typefaces The fallback typefaces in the order of preference.
+     *
+     * @throws NullPointerException if <code>typefaces</code> is null.
+     */
+    public FallbackSpan(@NonNull List<Typeface> typefaces) {
+        checkNotNull(typefaces, "typefaces");
+        this.typefaces = typefaces;
+    }
+
+    /**
+     * Returns this span's fallback typefaces.
+     *
+     * @return The fallback typefaces of this span.
+     */
+    public @NonNull List<Typeface> getTypefaces() {
+        return typefaces;
+    }
+
+    @Override
+    public void updateMeasureState(TextPaint textPaint) {
+    }
+
+    @Override
+    public void updateDrawState(TextPaint textPaint) {
+    }
+}
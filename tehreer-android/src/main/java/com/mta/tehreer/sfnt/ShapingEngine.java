@@ -265,6 +265,9 @@ public class ShapingEngine implements Disposable {
      * script so that cursive and mark glyphs are placed at appropriate locations. It should not be
      * confused with the direction of a bidirectional run as that may not reflect the script
      * direction if overridden explicitly.
+     * <p>
+     * If the writing direction is {@link WritingDirection#TOP_TO_BOTTOM}, the glyphs are placed
+     * with vertical metrics of the typeface and the resultant advances are measured downwards.
      *
      * @param writingDirection The new writing direction.
      */
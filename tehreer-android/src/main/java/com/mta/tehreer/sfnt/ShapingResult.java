@@ -126,6 +126,17 @@ public class ShapingResult implements Disposable {
 	    return nIsRTL(nativeResult);
     }
 
+    /**
+     * Returns <code>true</code> if the glyphs of this <code>ShapingResult</code> object are placed
+     * vertically. In this case, the glyph advances are measured downwards along the vertical line
+     * and the glyph offsets are relative to the vertical origin of each glyph.
+     *
+     * @return <code>true</code> if the glyphs are placed vertically, <code>false</code> otherwise.
+     */
+    public boolean isVertical() {
+        return nIsVertical(nativeResult);
+    }
+
     /**
      * Returns the index to the first character in source text for this <code>ShapingResult</code>
      * object.
@@ -493,6 +504,7 @@ public class ShapingResult implements Disposable {
 
 	private static native boolean nIsBackward(long nativeResult);
     private static native boolean nIsRTL(long nativeResult);
+    private static native boolean nIsVertical(long nativeResult);
     private static native float nGetSizeByEm(long nativeResult);
 	private static native int nGetCharStart(long nativeResult);
 	private static native int nGetCharEnd(long nativeResult);
@@ -27,7 +27,11 @@ public enum WritingDirection {
     /**
      * Text is written from right-to-left.
      */
-	RIGHT_TO_LEFT(1);
+	RIGHT_TO_LEFT(1),
+    /**
+     * Text is written from top-to-bottom.
+     */
+    TOP_TO_BOTTOM(2);
 
     final int value;
 
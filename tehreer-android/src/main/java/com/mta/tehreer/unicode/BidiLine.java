@@ -150,6 +150,18 @@ public class BidiLine implements Disposable {
         return new RunList(this);
     }
 
+    /**
+     * Returns all visually ordered runs of this line in a single array. Each run is stored as three
+     * consecutive values, i.e. char start, char end and embedding level, in the same order as they
+     * are returned by {@link #getVisualRuns()}. Unlike the list, it does not create a separate
+     * object for each run.
+     *
+     * @return An array containing the visually ordered runs of this line.
+     */
+    public @NonNull int[] getVisualRunArray() {
+        return nGetVisualRunArray(nativeLine);
+    }
+
     /**
      * Returns an iterable of mirroring pairs in this line. You can use the iterable to implement
      * Rule L4 of Unicode Bidirectional Algorithm.
@@ -163,6 +175,24 @@ public class BidiLine implements Disposable {
         return new MirrorIterable(this);
     }
 
+    /**
+     * Returns all mirroring pairs of this line in a single array. Each pair is stored as three
+     * consecutive values, i.e. char index, actual code point and pairing code point, in the same
+     * order as they are returned by {@link #getMirroringPairs()}. Unlike the iterable, it does not
+     * create a separate object for each pair.
+     *
+     * @return An array containing the mirroring pairs of this line.
+     */
+    public @NonNull int[] getMirroringPairArray() {
+        BidiMirrorLocator locator = new BidiMirrorLocator();
+        try {
+            locator.loadLine(this);
+            return locator.allPairs();
+        } finally {
+            locator.dispose();
+        }
+    }
+
     @Override
     public void dispose() {
         nDispose(nativeLine);
@@ -185,6 +215,7 @@ public class BidiLine implements Disposable {
 
 	private static native int nGetRunCount(long nativeLine);
 	private static native BidiRun nGetVisualRun(long nativeLine, int runIndex);
+	private static native int[] nGetVisualRunArray(long nativeLine);
 
     static final class RunList extends AbstractList<BidiRun> {
         final BidiLine owner;
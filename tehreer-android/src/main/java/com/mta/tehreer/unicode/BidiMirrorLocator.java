@@ -41,6 +41,10 @@ class BidiMirrorLocator implements Disposable {
         return nGetNextPair(nativeMirrorLocator);
     }
 
+    public @NonNull int[] allPairs() {
+        return nGetAllPairs(nativeMirrorLocator);
+    }
+
     @Override
     public void dispose() {
         nDispose(nativeMirrorLocator);
@@ -51,4 +55,5 @@ class BidiMirrorLocator implements Disposable {
 
 	private native void nLoadLine(long nativeMirrorLocator, long nativeLine, long nativeBuffer);
 	private native BidiPair nGetNextPair(long nativeMirrorLocator);
+	private native int[] nGetAllPairs(long nativeMirrorLocator);
 }
@@ -16,32 +16,52 @@
 
 package com.mta.tehreer.unicode
 
-import java.text.BreakIterator
+import com.mta.tehreer.internal.JniBridge.loadLibrary
 import kotlin.experimental.and
-import kotlin.experimental.or
 
 private const val BREAK_TYPE_CHARACTER = (1 shl 0).toByte()
 private const val BREAK_TYPE_LINE = (1 shl 2).toByte()
 
-internal class BreakClassifier(
-    val text: String
+internal class BreakClassifier private constructor(
+    val text: String,
+    val breakData: ByteArray
 ) {
-    private val breakData = ByteArray(text.length)
-
-    init {
-        fillBreaks(BreakIterator.getCharacterInstance(), BREAK_TYPE_CHARACTER)
-        fillBreaks(BreakIterator.getLineInstance(), BREAK_TYPE_LINE)
+    constructor(text: String) : this(text, ByteArray(text.length)) {
+        classify(0, text.length)
     }
 
-    private fun fillBreaks(iterator: BreakIterator, type: Byte) {
-        iterator.setText(text)
-        iterator.first()
-
-        var charNext: Int
+    /**
+     * Constructs a classifier for an edited text, copying the breaks of unchanged text from the
+     * classifier of previous text and resolving only the specified range.
+     *
+     * @param text The text after the edit.
+     * @param previous The classifier of the text before the edit.
+     * @param charStart The index to the first character of the range to classify. It must be a
+     *                  paragraph boundary.
+     * @param charEnd The index after the last character of the range to classify. It must be a
+     *                paragraph boundary.
+     * @param charShift The difference between the lengths of new and previous text.
+     */
+    constructor(
+        text: String, previous: BreakClassifier,
+        charStart: Int, charEnd: Int, charShift: Int
+    ) : this(text, ByteArray(text.length)) {
+        System.arraycopy(previous.breakData, 0, breakData, 0, charStart)
+        System.arraycopy(previous.breakData, charEnd - charShift, breakData, charEnd, text.length - charEnd)
+
+        classify(charStart, charEnd)
+    }
 
-        while (iterator.next().also { charNext = it } != BreakIterator.DONE) {
-            breakData[charNext - 1] = breakData[charNext - 1] or type
-        }
+    /**
+     * Resolves the grapheme and line break opportunities of the specified range, treating its
+     * bounds as the start and end of text. Disjoint ranges, such as paragraphs, can be classified
+     * concurrently.
+     *
+     * @param charStart The index to the first character of the range.
+     * @param charEnd The index after the last character of the range.
+     */
+    fun classify(charStart: Int, charEnd: Int) {
+        nClassify(text, breakData, charStart, charEnd)
     }
 
     fun getForwardGraphemeBreaks(fromIndex: Int, toIndex: Int) =
@@ -151,4 +171,15 @@ internal class BreakClassifier(
             return currentIndex
         }
     }
+
+    companion object {
+        init {
+            loadLibrary()
+        }
+
+        @JvmStatic private external fun nClassify(
+            text: String, breakData: ByteArray,
+            charStart: Int, charEnd: Int
+        )
+    }
 }
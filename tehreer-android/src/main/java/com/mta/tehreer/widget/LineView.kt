@@ -44,7 +44,7 @@ internal class LineView(context: Context?) : View(context) {
             return
         }
 
-        val lineTop = textLine.originY - textLine.ascent - frame.top
+        val lineTop = textLine.originY + offsetY - textLine.ascent - frame.top
         val lineBottom = lineTop + textLine.height
 
         val separatorLeft = floor(0.0f - frame.left)
@@ -56,7 +56,7 @@ internal class LineView(context: Context?) : View(context) {
 
     private fun drawTextLine(canvas: Canvas, textLine: ComposedLine) {
         val dx = textLine.originX - frame.left
-        val dy = textLine.originY - frame.top
+        val dy = textLine.originY + offsetY - frame.top
 
         textLine.draw(renderer, canvas, dx, dy)
     }
@@ -77,6 +77,11 @@ internal class LineView(context: Context?) : View(context) {
 
     var layoutWidth: Float = 0.0f
 
+    /**
+     * The vertical position of the frame that contains the line.
+     */
+    var offsetY: Float = 0.0f
+
     var separatorColor: Int
         get() = separatorPaint.color
         set(separatorColor) {
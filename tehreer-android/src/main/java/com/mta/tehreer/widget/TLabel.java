@@ -67,6 +67,7 @@ public class TLabel extends View {
     private @Nullable Typesetter mTypesetter = null;
 
     private boolean mNeedsTypesetter = false;
+    private boolean mNeedsFrame = true;
     private int mTextWidth = 0;
     private int mTextHeight = 0;
 
@@ -219,8 +220,15 @@ public class TLabel extends View {
         float layoutWidth = (widthMode == MeasureSpec.UNSPECIFIED ? Float.POSITIVE_INFINITY : widthSize - horizontalPadding);
         float layoutHeight = (heightMode == MeasureSpec.UNSPECIFIED ? Float.POSITIVE_INFINITY : heightSize - verticalPadding);
 
-        mResolver.setFitsHorizontally(widthMode != MeasureSpec.EXACTLY);
-        mResolver.setFitsVertically(heightMode != MeasureSpec.EXACTLY);
+        boolean fitsHorizontally = (widthMode != MeasureSpec.EXACTLY);
+        boolean fitsVertically = (heightMode != MeasureSpec.EXACTLY);
+
+        if (fitsHorizontally != mResolver.getFitsHorizontally()
+                || fitsVertically != mResolver.getFitsVertically()) {
+            mResolver.setFitsHorizontally(fitsHorizontally);
+            mResolver.setFitsVertically(fitsVertically);
+            mNeedsFrame = true;
+        }
         updateFrame(paddingLeft, paddingTop, layoutWidth, layoutHeight);
 
         setMeasuredDimension(mTextWidth + horizontalPadding, mTextHeight + verticalPadding);
@@ -244,7 +252,23 @@ public class TLabel extends View {
         Log.i("Tehreer", "Time taken to render label: " + ((t2 - t1) * 1E-6));
     }
 
+    @Override
+    public void requestLayout() {
+        // Every property affecting the frame requests a new layout.
+        mNeedsFrame = true;
+        super.requestLayout();
+    }
+
     private void updateFrame(float paddingLeft, float paddingTop, float layoutWidth, float layoutHeight) {
+        // Lists measure a view several times with the same constraints, so keep the previous frame
+        // including its truncated lines unless something has changed.
+        if (!mNeedsFrame
+                && mLayoutRect.left == paddingLeft && mLayoutRect.top == paddingTop
+                && mLayoutRect.right == layoutWidth && mLayoutRect.bottom == layoutHeight) {
+            return;
+        }
+
+        mNeedsFrame = false;
         mComposedFrame = null;
         mTextWidth = 0;
         mTextHeight = 0;
@@ -33,6 +33,7 @@ import androidx.annotation.RequiresApi;
 import com.mta.tehreer.R;
 import com.mta.tehreer.graphics.Typeface;
 import com.mta.tehreer.graphics.TypefaceManager;
+import com.mta.tehreer.layout.BreakStrategy;
 import com.mta.tehreer.layout.ComposedFrame;
 import com.mta.tehreer.layout.Typesetter;
 
@@ -128,7 +129,8 @@ public class TTextView extends ScrollView {
     }
 
     /**
-     * Returns the current composed frame that is being displayed.
+     * Returns the current composed frame that is being displayed. This property will be
+     * <code>null</code> if virtual layout is enabled, as the text is composed in separate blocks.
      *
      * @return The composed frame being displayed.
      */
@@ -137,7 +139,8 @@ public class TTextView extends ScrollView {
     }
 
     /**
-     * Returns the typesetter that is being used to compose text lines.
+     * Returns the typesetter that is being used to compose text lines. This property will be
+     * <code>null</code> if virtual layout is enabled, unless a typesetter was set explicitly.
      *
      * @return The current typesetter.
      */
@@ -362,6 +365,26 @@ public class TTextView extends ScrollView {
         mTextContainer.setJustificationLevel(justificationLevel);
     }
 
+    /**
+     * Returns the strategy for breaking paragraphs into lines. The default value is
+     * {@link BreakStrategy#GREEDY}.
+     *
+     * @return The current break strategy.
+     */
+    public @NonNull BreakStrategy getBreakStrategy() {
+        return mTextContainer.getBreakStrategy();
+    }
+
+    /**
+     * Sets the strategy for breaking paragraphs into lines. The default value is
+     * {@link BreakStrategy#GREEDY}.
+     *
+     * @param breakStrategy A value of {@link BreakStrategy}.
+     */
+    public void setBreakStrategy(@NonNull BreakStrategy breakStrategy) {
+        mTextContainer.setBreakStrategy(breakStrategy);
+    }
+
     /**
      * Returns the color being used to display a separator line below each rendered text line. The
      * default value is <code>Color.TRANSPARENT</code>.
@@ -381,4 +404,30 @@ public class TTextView extends ScrollView {
     public void setSeparatorColor(@ColorInt int separatorColor) {
         mTextContainer.setSeparatorColor(separatorColor);
     }
+
+    /**
+     * Returns whether or not the text is laid out lazily around the visible region. The default
+     * value is <code>false</code>.
+     *
+     * @return <code>true</code> if virtual layout is enabled; <code>false</code> otherwise.
+     */
+    public boolean isVirtualLayoutEnabled() {
+        return mTextContainer.isVirtualLayoutEnabled();
+    }
+
+    /**
+     * Sets whether or not to lay out the text lazily around the visible region. It is suitable for
+     * very long documents such as books.
+     * <p>
+     * When enabled, the text is divided into blocks of whole paragraphs. Only the blocks near the
+     * visible region are typeset and composed, while the heights of remaining blocks are estimated
+     * at first and refined in the background. Composed blocks far from the visible region are
+     * discarded to keep the memory bounded. The setting has no effect if a typesetter has been set
+     * explicitly. The default value is <code>false</code>.
+     *
+     * @param virtualLayoutEnabled A boolean value specifying the virtual layout state.
+     */
+    public void setVirtualLayoutEnabled(boolean virtualLayoutEnabled) {
+        mTextContainer.setVirtualLayoutEnabled(virtualLayoutEnabled);
+    }
 }
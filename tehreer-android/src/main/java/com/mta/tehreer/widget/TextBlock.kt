@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.mta.tehreer.widget
+
+import android.graphics.Rect
+import com.mta.tehreer.layout.ComposedFrame
+import com.mta.tehreer.layout.Typesetter
+import java.util.concurrent.atomic.AtomicIntegerArray
+import kotlin.math.ceil
+import kotlin.math.max
+
+/**
+ * A run of whole paragraphs that is typeset and composed independently in virtual layout.
+ */
+internal class TextBlock(
+    val charStart: Int,
+    val charEnd: Int,
+    var height: Float
+) {
+    var top = 0.0f
+    var isMeasured = false
+
+    var typesetter: Typesetter? = null
+    var frame: ComposedFrame? = null
+    var lineBoxes: List<Rect>? = null
+
+    val bottom: Float
+        get() = top + height
+
+    val isComposed: Boolean
+        get() = frame != null
+
+    val isResident: Boolean
+        get() = typesetter != null || frame != null
+
+    /**
+     * Drops the composed lines while keeping the shaped text, so that the block can be composed
+     * again for a different width without typesetting.
+     */
+    fun invalidate() {
+        isMeasured = false
+        frame = null
+        lineBoxes = null
+    }
+
+    fun discard() {
+        typesetter = null
+        frame = null
+        lineBoxes = null
+    }
+}
+
+/**
+ * Keeps track of the blocks that resolving tasks have taken up for measurement, so that a task
+ * replacing a cancelled one continues from where the previous one stopped. A new instance is made
+ * whenever the blocks are split or rewrapped, which also tells apart the results of stale tasks.
+ */
+internal class BlockMeasurement(blockCount: Int) {
+    private val claims = AtomicIntegerArray(blockCount)
+
+    /**
+     * Takes up the block at the specified index, returning `false` if it has already been taken.
+     */
+    fun claim(index: Int): Boolean = claims.compareAndSet(index, 0, 1)
+}
+
+/**
+ * Returns `true` if the character at the specified index ends a paragraph, considering a CR LF
+ * pair as a single separator like the bidi algorithm does.
+ */
+private fun CharSequence.isParagraphEnd(index: Int): Boolean {
+    return when (this[index]) {
+        '\r' -> index + 1 == length || this[index + 1] != '\n'
+        '\n', '\u001C', '\u001D', '\u001E', '\u0085', '\u2029' -> true
+        else -> false
+    }
+}
+
+/**
+ * Splits the text into blocks of whole paragraphs having at least `blockLength` characters, and
+ * estimates their heights from the number of lines each paragraph would roughly take.
+ */
+internal fun splitTextBlocks(
+    text: CharSequence, blockLength: Int,
+    charsPerLine: Float, lineHeight: Float
+): MutableList<TextBlock> {
+    val blocks = mutableListOf<TextBlock>()
+    val length = text.length
+
+    var blockStart = 0
+    var paragraphStart = 0
+    var lineCount = 0.0f
+
+    for (i in 0 until length) {
+        if (text.isParagraphEnd(i) || i == length - 1) {
+            val paragraphLength = i + 1 - paragraphStart
+            lineCount += max(1.0f, ceil(paragraphLength / charsPerLine))
+            paragraphStart = i + 1
+
+            if (paragraphStart - blockStart >= blockLength || paragraphStart == length) {
+                blocks.add(TextBlock(blockStart, paragraphStart, lineCount * lineHeight))
+
+                blockStart = paragraphStart
+                lineCount = 0.0f
+            }
+        }
+    }
+
+    return blocks
+}
+
+/**
+ * Updates the top of each block starting from the specified index.
+ */
+internal fun MutableList<TextBlock>.arrangeBlocks(fromIndex: Int) {
+    var top = if (fromIndex > 0) this[fromIndex - 1].bottom else 0.0f
+
+    for (i in fromIndex until size) {
+        val block = this[i]
+        block.top = top
+        top += block.height
+    }
+}
+
+/**
+ * Drops the composed lines of all blocks for a new layout width while keeping their shaped text,
+ * and scales the heights on the assumption that lines take roughly inverse space of the width.
+ */
+internal fun MutableList<TextBlock>.rewrapBlocks(oldWidth: Int, newWidth: Int) {
+    val heightRatio = if (oldWidth > 0 && newWidth > 0) oldWidth.toFloat() / newWidth else 1.0f
+
+    for (block in this) {
+        block.invalidate()
+        block.height *= heightRatio
+    }
+    arrangeBlocks(0)
+}
+
+/**
+ * Returns the index of the block containing the specified vertical position.
+ */
+internal fun List<TextBlock>.searchBlockIndex(y: Float): Int {
+    var low = 0
+    var high = size - 1
+
+    while (low <= high) {
+        val mid = (low + high) ushr 1
+        val block = this[mid]
+
+        if (y >= block.bottom) {
+            low = mid + 1
+        } else if (y < block.top) {
+            high = mid - 1
+        } else {
+            return mid
+        }
+    }
+
+    return if (low >= size) size - 1 else max(0, low)
+}
@@ -16,13 +16,17 @@
 
 package com.mta.tehreer.widget
 
+import android.content.ComponentCallbacks2
 import android.content.Context
+import android.content.res.Configuration
 import android.graphics.Color
 import android.graphics.Rect
 import android.graphics.RectF
 import android.os.Handler
 import android.os.Looper
+import android.text.SpannableString
 import android.text.Spanned
+import android.text.SpannedString
 import android.util.AttributeSet
 import android.view.Gravity
 import android.view.ViewGroup
@@ -30,7 +34,9 @@ import android.widget.ScrollView
 import com.mta.tehreer.graphics.Renderer
 import com.mta.tehreer.graphics.Typeface
 import com.mta.tehreer.internal.util.SmartRunnable
+import com.mta.tehreer.layout.BreakStrategy
 import com.mta.tehreer.layout.ComposedFrame
+import com.mta.tehreer.layout.ComposedLine
 import com.mta.tehreer.layout.FrameResolver
 import com.mta.tehreer.layout.TextAlignment
 import com.mta.tehreer.layout.Typesetter
@@ -40,10 +46,21 @@ import java.util.ArrayDeque
 import java.util.Queue
 import java.util.concurrent.Executor
 import java.util.concurrent.Executors
+import kotlin.math.abs
 import kotlin.math.ceil
 import kotlin.math.max
+import kotlin.math.min
 import kotlin.math.roundToInt
 
+// The minimum number of characters typeset together in virtual layout.
+private const val BLOCK_LENGTH = 4096
+
+// The maximum number of composed blocks kept in memory in virtual layout.
+private const val MAX_RESIDENT_BLOCKS = 24
+
+// The number of measured blocks reported together while refining the heights.
+private const val MEASURE_CHUNK = 16
+
 private data class TextProperties(
     var handler: Handler,
     var layoutID: Any? = null,
@@ -58,13 +75,134 @@ private data class TextProperties(
     var lineHeightMultiplier: Float = 1.0f,
     var isJustificationEnabled: Boolean = false,
     var justificationLevel: Float = 1.0f,
+    var breakStrategy: BreakStrategy = BreakStrategy.GREEDY,
     var separatorColor: Int = Color.TRANSPARENT,
+    var isVirtualLayoutEnabled: Boolean = false,
     var typesetter: Typesetter? = null,
-    var composedFrame: ComposedFrame? = null
+    var composedFrame: ComposedFrame? = null,
+    var textEdit: TextEdit? = null
+)
+
+/**
+ * Describes how the text of a resolved typesetter has been edited, so that the layout of new text
+ * can reuse the paragraphs and lines that the edit has not touched.
+ */
+private data class TextEdit(
+    val typesetter: Typesetter,
+    val frame: ComposedFrame?,
+    val editStart: Int,
+    val oldEnd: Int,
+    val newEnd: Int
 )
 
 private typealias OnTaskUpdateListener<T> = (T) -> Unit
 
+private class BlockResult(
+    val index: Int,
+    val height: Float,
+    val typesetter: Typesetter?,
+    val frame: ComposedFrame?,
+    val lineBoxes: List<Rect>?
+)
+
+private fun createTypesetter(properties: TextProperties, charStart: Int, charEnd: Int): Typesetter? {
+    val text = properties.text
+    val spanned = properties.spanned
+
+    if (text != null) {
+        val typeface = properties.typeface
+        val textSize = properties.textSize
+
+        if (typeface != null && charEnd > charStart) {
+            return Typesetter(text.substring(charStart, charEnd), typeface, textSize)
+        }
+    } else if (spanned != null) {
+        if (charEnd > charStart) {
+            val typeface = properties.typeface
+            val textSize = properties.textSize
+
+            val defaultSpans = mutableListOf<Any>()
+
+            if (typeface != null) {
+                defaultSpans.add(TypefaceSpan(typeface))
+            }
+            defaultSpans.add(TypeSizeSpan(textSize))
+
+            val source = if (charStart == 0 && charEnd == spanned.length) {
+                spanned
+            } else {
+                SpannedString(spanned.subSequence(charStart, charEnd))
+            }
+
+            return Typesetter(source, defaultSpans)
+        }
+    }
+
+    return null
+}
+
+private fun createEditedTypesetter(properties: TextProperties, edit: TextEdit): Typesetter? {
+    val text = properties.text
+    val typeface = properties.typeface
+
+    if (text.isNullOrEmpty() || typeface == null) {
+        return null
+    }
+
+    val spanned = SpannableString(text)
+    spanned.setSpan(TypefaceSpan(typeface), 0, text.length, Spanned.SPAN_INCLUSIVE_INCLUSIVE)
+    spanned.setSpan(TypeSizeSpan(properties.textSize), 0, text.length, Spanned.SPAN_INCLUSIVE_INCLUSIVE)
+
+    return Typesetter(edit.typesetter, spanned, edit.editStart, edit.oldEnd, edit.newEnd)
+}
+
+private fun createFrameResolver(properties: TextProperties, input: Typesetter): FrameResolver {
+    val resolver = FrameResolver()
+    resolver.apply {
+        typesetter = input
+        frameBounds =
+            RectF(0.0f, 0.0f, properties.layoutWidth.toFloat(), Float.POSITIVE_INFINITY)
+        fitsHorizontally = false
+        fitsVertically = true
+        textAlignment = properties.textAlignment
+        extraLineSpacing = properties.extraLineSpacing
+        lineHeightMultiplier = properties.lineHeightMultiplier
+        isJustificationEnabled = properties.isJustificationEnabled
+        justificationLevel = properties.justificationLevel
+        breakStrategy = properties.breakStrategy
+    }
+
+    return resolver
+}
+
+private fun createRenderer(properties: TextProperties): Renderer {
+    val renderer = Renderer()
+    renderer.typeface = properties.typeface
+    renderer.typeSize = properties.textSize
+    renderer.fillColor = properties.textColor
+
+    return renderer
+}
+
+private fun computeLineBox(renderer: Renderer, line: ComposedLine, layoutWidth: Float): Rect {
+    val boundingBox = line.computeBoundingBox(renderer)
+    boundingBox.offset(line.originX, line.originY)
+
+    val lineLeft = 0.0f
+    val lineTop = line.originY - line.ascent
+    val lineRight = layoutWidth
+    val lineBottom = lineTop + line.height
+
+    boundingBox.union(lineLeft, lineTop, lineRight, lineBottom)
+
+    return Rect(
+        boundingBox.left.roundToInt(),
+        boundingBox.top.roundToInt(),
+        boundingBox.right.roundToInt(),
+        boundingBox.bottom.roundToInt()
+    )
+}
+
 internal class TextContainer : ViewGroup {
     private lateinit var properties: TextProperties
 
@@ -77,6 +215,7 @@ internal class TextContainer : ViewGroup {
     private var scrollHeight = 0
 
     private val visibleRect = Rect()
+    private val lineRect = Rect()
 
     private var isTextLayoutRequested = false
     private var isTypesetterUserDefined = false
@@ -91,6 +230,28 @@ internal class TextContainer : ViewGroup {
     private val executor: Executor = Executors.newCachedThreadPool()
     private var textTask: TextResolvingTask? = null
 
+    private var textBlocks: MutableList<TextBlock>? = null
+    private var blockTask: BlockResolvingTask? = null
+    private var blockMeasurement: BlockMeasurement? = null
+    private val pendingIndexes = mutableSetOf<Int>()
+    private var measuredChars = 0
+    private var measuredHeight = 0.0f
+    private var blockLayoutWidth = 0
+
+    private val memoryCallbacks = object : ComponentCallbacks2 {
+        override fun onTrimMemory(level: Int) {
+            if (level >= ComponentCallbacks2.TRIM_MEMORY_RUNNING_LOW) {
+                trimBlocks()
+            }
+        }
+
+        override fun onLowMemory() {
+            trimBlocks()
+        }
+
+        override fun onConfigurationChanged(newConfig: Configuration) { }
+    }
+
     constructor(context: Context) : super(context) {
         setup()
     }
@@ -113,6 +274,16 @@ internal class TextContainer : ViewGroup {
         )
     }
 
+    override fun onAttachedToWindow() {
+        super.onAttachedToWindow()
+        context.registerComponentCallbacks(memoryCallbacks)
+    }
+
+    override fun onDetachedFromWindow() {
+        super.onDetachedFromWindow()
+        context.unregisterComponentCallbacks(memoryCallbacks)
+    }
+
     fun setScrollView(view: ScrollView?) {
         scrollView = view
     }
@@ -152,8 +323,15 @@ internal class TextContainer : ViewGroup {
             widthSize = 0
         }
 
-        properties.composedFrame?.let {
-            heightSize = ceil(it.height).toInt()
+        val blocks = textBlocks
+        if (blocks != null) {
+            if (blocks.isNotEmpty()) {
+                heightSize = ceil(blocks[blocks.size - 1].bottom).toInt()
+            }
+        } else {
+            properties.composedFrame?.let {
+                heightSize = ceil(it.height).toInt()
+            }
         }
 
         setMeasuredDimension(widthSize, heightSize)
@@ -185,30 +363,19 @@ internal class TextContainer : ViewGroup {
         }
 
         override fun run() {
-            val text = properties.text
-            val spanned = properties.spanned
-
-            if (text != null) {
-                val typeface = properties.typeface
-                val textSize = properties.textSize
-
-                if (typeface != null && text.isNotEmpty()) {
-                    properties.typesetter = Typesetter(text, typeface, textSize)
-                }
-            } else if (spanned != null) {
-                if (spanned.isNotEmpty()) {
-                    val typeface = properties.typeface
-                    val textSize = properties.textSize
-
-                    val defaultSpans = mutableListOf<Any>()
+            val length = (properties.text ?: properties.spanned)?.length ?: 0
+            val edit = properties.textEdit
 
-                    if (typeface != null) {
-                        defaultSpans.add(TypefaceSpan(typeface))
-                    }
-                    defaultSpans.add(TypeSizeSpan(textSize))
+            val typesetter = if (edit != null) {
+                createEditedTypesetter(properties, edit)
+            } else {
+                createTypesetter(properties, 0, length)
+            }
 
-                    properties.typesetter = Typesetter(spanned, defaultSpans)
-                }
+            if (typesetter == null) {
+                properties.textEdit = null
+            } else {
+                properties.typesetter = typesetter
             }
 
             notifyUpdateIfNeeded()
@@ -230,21 +397,14 @@ internal class TextContainer : ViewGroup {
         override fun run() {
             val input = properties.typesetter
             if (input != null) {
-                val resolver = FrameResolver()
-                resolver.apply {
-                    typesetter = input
-                    frameBounds =
-                        RectF(0.0f, 0.0f, properties.layoutWidth.toFloat(), Float.POSITIVE_INFINITY)
-                    fitsHorizontally = false
-                    fitsVertically = true
-                    textAlignment = properties.textAlignment
-                    extraLineSpacing = properties.extraLineSpacing
-                    lineHeightMultiplier = properties.lineHeightMultiplier
-                    isJustificationEnabled = properties.isJustificationEnabled
-                    justificationLevel = properties.justificationLevel
-                }
+                val resolver = createFrameResolver(properties, input)
+                val previousFrame = properties.textEdit?.frame
 
-                properties.composedFrame = resolver.createFrame(0, input.spanned.length)
+                properties.composedFrame = if (previousFrame != null) {
+                    resolver.createFrame(0, input.spanned.length, previousFrame)
+                } else {
+                    resolver.createFrame(0, input.spanned.length)
+                }
             }
 
             notifyUpdateIfNeeded()
@@ -270,32 +430,13 @@ internal class TextContainer : ViewGroup {
         override fun run() {
             val input = properties.composedFrame?.lines
             if (input != null) {
-                val renderer = Renderer()
-                renderer.typeface = properties.typeface
-                renderer.typeSize = properties.textSize
-                renderer.fillColor = properties.textColor
+                val renderer = createRenderer(properties)
+                val layoutWidth = properties.layoutWidth.toFloat()
 
                 var lineChunk = 0
 
                 for (line in input) {
-                    val boundingBox = line.computeBoundingBox(renderer)
-                    boundingBox.offset(line.originX, line.originY)
-
-                    val lineLeft = 0.0f
-                    val lineTop = line.originY - line.ascent
-                    val lineRight = properties.layoutWidth.toFloat()
-                    val lineBottom = lineTop + line.height
-
-                    boundingBox.union(lineLeft, lineTop, lineRight, lineBottom)
-
-                    lineBoxes.add(
-                        Rect(
-                            boundingBox.left.roundToInt(),
-                            boundingBox.top.roundToInt(),
-                            boundingBox.right.roundToInt(),
-                            boundingBox.bottom.roundToInt()
-                        )
-                    )
+                    lineBoxes.add(computeLineBox(renderer, line, layoutWidth))
 
                     if (isCancelled) {
                         break
@@ -314,6 +455,116 @@ internal class TextContainer : ViewGroup {
         }
     }
 
+    private class BlockSplittingTask(
+        private val properties: TextProperties,
+        private val listener: OnTaskUpdateListener<MutableList<TextBlock>>
+    ) : SmartRunnable() {
+        override fun run() {
+            val source: CharSequence? = properties.text ?: properties.spanned
+            var blocks = mutableListOf<TextBlock>()
+
+            if (source != null && source.isNotEmpty()) {
+                val typeface = properties.typeface
+                val textSize = properties.textSize
+                var lineHeight = textSize
+
+                if (typeface != null) {
+                    val sizeByEm = textSize / typeface.unitsPerEm
+                    lineHeight = (typeface.ascent + typeface.descent + typeface.leading) * sizeByEm
+                }
+                if (properties.lineHeightMultiplier != 0.0f) {
+                    lineHeight *= properties.lineHeightMultiplier
+                }
+                lineHeight += properties.extraLineSpacing
+
+                // Assume that an average character is half an em wide.
+                val charsPerLine = max(1.0f, properties.layoutWidth / (textSize * 0.5f))
+
+                blocks = splitTextBlocks(source, BLOCK_LENGTH, charsPerLine, lineHeight)
+                blocks.arrangeBlocks(0)
+            }
+
+            if (!isCancelled) {
+                properties.handler.run {
+                    post { listener(blocks) }
+                }
+            }
+        }
+    }
+
+    private class BlockResolvingTask(
+        private val properties: TextProperties,
+        private val blockRanges: IntArray,
+        private val typesetters: Array<Typesetter?>,
+        private val composedIndexes: List<Int>,
+        private val measuredIndexes: List<Int>,
+        private val measurement: BlockMeasurement,
+        private val listener: OnTaskUpdateListener<List<BlockResult>>
+    ) : SmartRunnable() {
+        private fun notifyUpdate(results: List<BlockResult>) {
+            // The results remain valid after cancellation, so deliver them for the next task to
+            // build upon; stale ones are rejected by their measurement.
+            properties.handler.run {
+                post { listener(results) }
+            }
+        }
+
+        private fun resolveBlock(index: Int): BlockResult {
+            val charStart = blockRanges[index * 2]
+            val charEnd = blockRanges[index * 2 + 1]
+
+            // Reuse the shaped text of the block if it only needs to be wrapped again.
+            val typesetter = typesetters[index]
+                ?: createTypesetter(properties, charStart, charEnd)
+                ?: return BlockResult(index, 0.0f, null, null, null)
+
+            val resolver = createFrameResolver(properties, typesetter)
+            val frame = resolver.createFrame(0, charEnd - charStart)
+
+            val renderer = createRenderer(properties)
+            val layoutWidth = properties.layoutWidth.toFloat()
+            val lineBoxes = frame.lines.map { computeLineBox(renderer, it, layoutWidth) }
+
+            return BlockResult(index, frame.height, typesetter, frame, lineBoxes)
+        }
+
+        override fun run() {
+            // Compose the blocks around viewport first.
+            for (index in composedIndexes) {
+                if (isCancelled) {
+                    return
+                }
+
+                measurement.claim(index)
+                notifyUpdate(listOf(resolveBlock(index)))
+            }
+
+            // Refine the estimated heights of remaining blocks in the background, keeping their
+            // lines so that the nearest ones need not be composed again when scrolled to.
+            val results = mutableListOf<BlockResult>()
+
+            for (index in measuredIndexes) {
+                if (isCancelled) {
+                    break
+                }
+                if (!measurement.claim(index)) {
+                    continue
+                }
+
+                results.add(resolveBlock(index))
+
+                if (results.size == MEASURE_CHUNK) {
+                    notifyUpdate(results.toList())
+                    results.clear()
+                }
+            }
+
+            if (results.isNotEmpty()) {
+                notifyUpdate(results.toList())
+            }
+        }
+    }
+
     private class TextResolvingTask(
         private val subTasks: Queue<SmartRunnable>
     ) : SmartRunnable() {
@@ -353,7 +604,32 @@ internal class TextContainer : ViewGroup {
     private fun performTextLayout() {
         val context = properties.copy()
 
+        // An edit can only be applied to the layout that it was found against.
+        properties.textEdit = null
+
         val subTasks: Queue<SmartRunnable> = ArrayDeque()
+        if (properties.isVirtualLayoutEnabled && !isTypesetterUserDefined) {
+            val blocks = textBlocks
+            if (isTypesetterResolved && blocks != null) {
+                rewrapTextBlocks(blocks)
+
+                isTextLayoutRequested = false
+                return
+            }
+
+            subTasks.add(
+                BlockSplittingTask(context) { blocks ->
+                    updateTextBlocks(context.layoutID, blocks)
+                }
+            )
+
+            textTask = TextResolvingTask(subTasks)
+            executor.execute(textTask)
+
+            isTextLayoutRequested = false
+            return
+        }
+
         if (!isTypesetterResolved) {
             subTasks.add(
                 TypesettingTask(context) { typesetter ->
@@ -388,6 +664,8 @@ internal class TextContainer : ViewGroup {
         if (layoutID === properties.layoutID) {
             isComposedFrameResolved = true
             properties.composedFrame = composedFrame
+            textBlocks = null
+            blockMeasurement = null
 
             lineBoxes.clear()
             lineViews.clear()
@@ -405,7 +683,182 @@ internal class TextContainer : ViewGroup {
         }
     }
 
-    private fun layoutLines() = properties.composedFrame?.let {
+    private fun updateTextBlocks(layoutID: Any?, blocks: MutableList<TextBlock>) {
+        if (layoutID === properties.layoutID) {
+            isTypesetterResolved = true
+            isComposedFrameResolved = true
+            properties.typesetter = null
+            properties.composedFrame = null
+
+            textBlocks = blocks
+            blockMeasurement = BlockMeasurement(blocks.size)
+            pendingIndexes.clear()
+            measuredChars = 0
+            measuredHeight = 0.0f
+            blockLayoutWidth = properties.layoutWidth
+
+            lineBoxes.clear()
+            lineViews.clear()
+            removeAllViews()
+
+            scrollView?.scrollTo(0, 0)
+            requestLayout()
+            layoutLines()
+        }
+    }
+
+    private fun rewrapTextBlocks(blocks: MutableList<TextBlock>) {
+        val newWidth = properties.layoutWidth
+        blocks.rewrapBlocks(blockLayoutWidth, newWidth)
+
+        blockMeasurement = BlockMeasurement(blocks.size)
+        pendingIndexes.clear()
+        measuredChars = 0
+        measuredHeight = 0.0f
+        blockLayoutWidth = newWidth
+
+        requestLayout()
+        layoutLines()
+    }
+
+    private fun updateBlockResults(layoutID: Any?, measurement: BlockMeasurement, results: List<BlockResult>) {
+        val blocks = textBlocks
+        if (layoutID !== properties.layoutID || measurement !== blockMeasurement
+                || blocks == null || blocks.isEmpty()) {
+            return
+        }
+
+        // Keep the block at the top of viewport steady while heights change.
+        val anchorIndex = blocks.searchBlockIndex(scrollY.toFloat())
+        val anchorOffset = scrollY - blocks[anchorIndex].top
+        var changedIndex = blocks.size
+
+        for (result in results) {
+            val block = blocks[result.index]
+
+            if (result.frame != null) {
+                block.typesetter = result.typesetter
+                block.frame = result.frame
+                block.lineBoxes = result.lineBoxes
+                pendingIndexes.remove(result.index)
+            }
+
+            if (!block.isMeasured) {
+                block.isMeasured = true
+                measuredChars += block.charEnd - block.charStart
+                measuredHeight += result.height
+            }
+
+            if (block.height != result.height) {
+                block.height = result.height
+                changedIndex = min(changedIndex, result.index)
+            }
+        }
+
+        // Estimate the remaining blocks from the ones measured so far.
+        if (measuredChars > 0) {
+            val heightPerChar = measuredHeight / measuredChars
+
+            for (i in blocks.indices) {
+                val block = blocks[i]
+                if (!block.isMeasured) {
+                    block.height = (block.charEnd - block.charStart) * heightPerChar
+                    changedIndex = min(changedIndex, i)
+                }
+            }
+        }
+
+        if (changedIndex < blocks.size) {
+            blocks.arrangeBlocks(changedIndex)
+
+            val anchoredY = (blocks[anchorIndex].top + anchorOffset).roundToInt()
+            if (anchoredY != scrollY) {
+                scrollView?.scrollTo(scrollX, anchoredY)
+            }
+
+            requestLayout()
+        }
+
+        layoutLines()
+    }
+
+    private fun requestResidentBlocks() {
+        val blocks = textBlocks
+        if (blocks == null || blocks.isEmpty()) {
+            return
+        }
+
+        // Compose one viewport ahead of and behind the visible region.
+        val windowTop = (scrollY - scrollHeight).toFloat()
+        val windowBottom = (scrollY + scrollHeight * 2).toFloat()
+        val firstIndex = blocks.searchBlockIndex(windowTop)
+        val lastIndex = blocks.searchBlockIndex(windowBottom)
+
+        val composedIndexes = (firstIndex..lastIndex).filter { !blocks[it].isComposed }
+        if (composedIndexes.isEmpty() || pendingIndexes.containsAll(composedIndexes)) {
+            return
+        }
+
+        val measurement = blockMeasurement ?: return
+        val sortedIndexes = composedIndexes.sortedBy { abs(blocks[it].top - scrollY) }
+        val measuredIndexes = blocks.indices.filter {
+            !blocks[it].isMeasured && it !in composedIndexes
+        }.sortedBy { abs(blocks[it].top - scrollY) }
+
+        val blockRanges = IntArray(blocks.size * 2)
+        val typesetters = arrayOfNulls<Typesetter>(blocks.size)
+
+        for (i in blocks.indices) {
+            blockRanges[i * 2] = blocks[i].charStart
+            blockRanges[i * 2 + 1] = blocks[i].charEnd
+            typesetters[i] = blocks[i].typesetter
+        }
+
+        blockTask?.cancel()
+        pendingIndexes.clear()
+        pendingIndexes.addAll(composedIndexes)
+
+        val context = properties.copy()
+        blockTask = BlockResolvingTask(
+            context, blockRanges, typesetters,
+            sortedIndexes, measuredIndexes, measurement
+        ) { results ->
+            updateBlockResults(context.layoutID, measurement, results)
+        }
+        executor.execute(blockTask)
+    }
+
+    private fun evictBlocks() {
+        val blocks = textBlocks ?: return
+        val residentIndexes = blocks.indices.filter { blocks[it].isResident }
+        val excessCount = residentIndexes.size - MAX_RESIDENT_BLOCKS
+
+        if (excessCount > 0) {
+            val centerY = scrollY + scrollHeight / 2.0f
+            val farthestIndexes = residentIndexes.sortedByDescending {
+                abs((blocks[it].top + blocks[it].bottom) / 2.0f - centerY)
+            }
+
+            for (i in 0 until excessCount) {
+                blocks[farthestIndexes[i]].discard()
+            }
+        }
+    }
+
+    private fun trimBlocks() {
+        val blocks = textBlocks ?: return
+        val windowTop = (scrollY - scrollHeight).toFloat()
+        val windowBottom = (scrollY + scrollHeight * 2).toFloat()
+
+        // Keep only the blocks that would be composed again right away.
+        for (block in blocks) {
+            if (block.bottom < windowTop || block.top > windowBottom) {
+                block.discard()
+            }
+        }
+    }
+
+    private fun layoutLines() {
         visibleRect.set(scrollX, scrollY, scrollX + scrollWidth, scrollY + scrollHeight)
 
         insideViews.clear()
@@ -420,6 +873,41 @@ internal class TextContainer : ViewGroup {
             }
         }
 
+        val blocks = textBlocks
+        if (blocks != null) {
+            layoutBlockLines(blocks)
+        } else {
+            layoutFrameLines()
+        }
+    }
+
+    private fun layoutBlockLines(blocks: List<TextBlock>) {
+        if (blocks.isNotEmpty()) {
+            val firstIndex = blocks.searchBlockIndex(visibleRect.top.toFloat())
+            val lastIndex = blocks.searchBlockIndex(visibleRect.bottom.toFloat())
+
+            for (i in firstIndex..lastIndex) {
+                val block = blocks[i]
+                val lines = block.frame?.lines ?: continue
+                val boxes = block.lineBoxes ?: continue
+                val blockTop = block.top.roundToInt()
+
+                for (j in lines.indices) {
+                    lineRect.set(boxes[j])
+                    lineRect.offset(0, blockTop)
+
+                    if (Rect.intersects(lineRect, visibleRect)) {
+                        placeLineView(lines[j], lineRect, blockTop.toFloat())
+                    }
+                }
+            }
+        }
+
+        requestResidentBlocks()
+        evictBlocks()
+    }
+
+    private fun layoutFrameLines() = properties.composedFrame?.let {
         visibleIndexes.clear()
 
         // Get line indexes that should be visible.
@@ -430,51 +918,55 @@ internal class TextContainer : ViewGroup {
         }
 
         val allLines = it.lines
-        val layoutWidth = properties.layoutWidth.toFloat()
-        val separatorColor = properties.separatorColor
 
         // Layout the lines.
         for (index in visibleIndexes) {
-            val textLine = allLines[index]
-            var insideView: LineView? = null
-            var lineView: LineView
-
-            for (view in insideViews) {
-                if (view.line === textLine) {
-                    insideView = view
-                    break
-                }
-            }
+            placeLineView(allLines[index], lineBoxes[index], 0.0f)
+        }
+    }
 
-            if (insideView != null) {
-                lineView = insideView
-            } else {
-                val outsideCount = outsideViews.size
-                if (outsideCount > 0) {
-                    lineView = outsideViews[outsideCount - 1]
-                    outsideViews.removeAt(outsideCount - 1)
-                } else {
-                    lineView = LineView(context)
-                    lineView.setBackgroundColor(Color.TRANSPARENT)
+    private fun placeLineView(textLine: ComposedLine, lineBox: Rect, offsetY: Float) {
+        val layoutWidth = properties.layoutWidth.toFloat()
+        val separatorColor = properties.separatorColor
 
-                    lineViews.add(lineView)
-                }
+        var insideView: LineView? = null
+        var lineView: LineView
 
-                updateRenderer(lineView.renderer)
-                lineView.line = textLine
+        for (view in insideViews) {
+            if (view.line === textLine) {
+                insideView = view
+                break
             }
+        }
+
+        if (insideView != null) {
+            lineView = insideView
+        } else {
+            val outsideCount = outsideViews.size
+            if (outsideCount > 0) {
+                lineView = outsideViews[outsideCount - 1]
+                outsideViews.removeAt(outsideCount - 1)
+            } else {
+                lineView = LineView(context)
+                lineView.setBackgroundColor(Color.TRANSPARENT)
 
-            if (lineView.parent == null) {
-                addView(lineView)
+                lineViews.add(lineView)
             }
 
-            lineView.layoutWidth = layoutWidth
-            lineView.separatorColor = separatorColor
-            lineView.bringToFront()
+            updateRenderer(lineView.renderer)
+            lineView.line = textLine
+        }
 
-            val lineBox = lineBoxes[index]
-            lineView.layout(lineBox.left, lineBox.top, lineBox.right, lineBox.bottom)
+        if (lineView.parent == null) {
+            addView(lineView)
         }
+
+        lineView.layoutWidth = layoutWidth
+        lineView.separatorColor = separatorColor
+        lineView.offsetY = offsetY
+        lineView.bringToFront()
+
+        lineView.layout(lineBox.left, lineBox.top, lineBox.right, lineBox.bottom)
     }
 
     private fun updateRenderer(renderer: Renderer) {
@@ -483,12 +975,25 @@ internal class TextContainer : ViewGroup {
         renderer.typeSize = properties.textSize
     }
 
-    fun hitTestPosition(x: Float, y: Float): Int = properties.composedFrame?.let {
-        val adjustedX = x - it.originX
-        val adjustedY = y - it.originY
-        val lineIndex = it.getLineIndexForPosition(adjustedX, adjustedY)
+    fun hitTestPosition(x: Float, y: Float): Int {
+        val blocks = textBlocks ?: return properties.composedFrame?.let { hitTestFrame(it, x, y) } ?: -1
+        if (blocks.isEmpty()) {
+            return -1
+        }
+
+        val block = blocks[blocks.searchBlockIndex(y)]
+        val frame = block.frame ?: return -1
+        val charIndex = hitTestFrame(frame, x, y - block.top)
+
+        return if (charIndex >= 0) charIndex + block.charStart else -1
+    }
 
-        val composedLine = it.lines[lineIndex]
+    private fun hitTestFrame(frame: ComposedFrame, x: Float, y: Float): Int {
+        val adjustedX = x - frame.originX
+        val adjustedY = y - frame.originY
+        val lineIndex = frame.getLineIndexForPosition(adjustedX, adjustedY)
+
+        val composedLine = frame.lines[lineIndex]
         val lineLeft = composedLine.originX
         val lineRight = lineLeft + composedLine.width
 
@@ -506,20 +1011,51 @@ internal class TextContainer : ViewGroup {
         }
 
         return -1
-    } ?: -1
+    }
 
     private fun requestTypesetter() {
         isTypesetterResolved = isTypesetterUserDefined
+        properties.textEdit = null
         requestComposedFrame()
     }
 
     private fun requestComposedFrame() {
         isComposedFrameResolved = false
+        properties.textEdit = properties.textEdit?.copy(frame = null)
         requestTextLayout()
     }
 
+    private fun findTextEdit(newText: String): TextEdit? {
+        val typesetter = properties.typesetter
+        if (!isTypesetterResolved || isTypesetterUserDefined || properties.text == null
+            || typesetter == null || newText.isEmpty()) {
+            return null
+        }
+
+        val oldText = typesetter.spanned
+        val oldLength = oldText.length
+        val newLength = newText.length
+        val minLength = min(oldLength, newLength)
+
+        var prefixLength = 0
+        while (prefixLength < minLength && oldText[prefixLength] == newText[prefixLength]) {
+            prefixLength++
+        }
+
+        var suffixLength = 0
+        while (suffixLength < minLength - prefixLength
+               && oldText[oldLength - suffixLength - 1] == newText[newLength - suffixLength - 1]) {
+            suffixLength++
+        }
+
+        val frame = if (isComposedFrameResolved) properties.composedFrame else null
+
+        return TextEdit(typesetter, frame, prefixLength, oldLength - suffixLength, newLength - suffixLength)
+    }
+
     private fun requestTextLayout() {
         textTask?.cancel()
+        blockTask?.cancel()
 
         properties.layoutID = Any()
         isTextLayoutRequested = true
@@ -573,10 +1109,16 @@ internal class TextContainer : ViewGroup {
     var text: String?
         get() = properties.text
         set(text) {
-            properties.text = text ?: ""
+            val newText = text ?: ""
+            val textEdit = findTextEdit(newText)
+
+            properties.text = newText
             properties.spanned = null
             isTypesetterUserDefined = false
             requestTypesetter()
+
+            // Relayout only the paragraphs touched by the edit.
+            properties.textEdit = textEdit
         }
 
     var textSize: Float
@@ -621,10 +1163,24 @@ internal class TextContainer : ViewGroup {
             requestComposedFrame()
         }
 
+    var breakStrategy: BreakStrategy
+        get() = properties.breakStrategy
+        set(breakStrategy) {
+            properties.breakStrategy = breakStrategy
+            requestComposedFrame()
+        }
+
     var separatorColor: Int
         get() = properties.separatorColor
         set(separatorColor) {
             properties.separatorColor = separatorColor
             invalidate()
         }
+
+    var isVirtualLayoutEnabled: Boolean
+        get() = properties.isVirtualLayoutEnabled
+        set(isVirtualLayoutEnabled) {
+            properties.isVirtualLayoutEnabled = isVirtualLayoutEnabled
+            requestTypesetter()
+        }
 }
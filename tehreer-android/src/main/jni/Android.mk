@@ -144,11 +144,22 @@ FILE_LIST := \
     BidiLine.cpp \
     BidiMirrorLocator.cpp \
     BidiParagraph.cpp \
+    BreakClassifier.cpp \
+    BufferTable.cpp \
+    BreakLookup.cpp \
+    CoverageSet.cpp \
+    FontFallback.cpp \
     FontFile.cpp \
     FreeType.cpp \
     GlyphOutline.cpp \
     GlyphRasterizer.cpp \
+    GlyphTypeTable.cpp \
     JavaBridge.cpp \
+    JoiningLookup.cpp \
+    KashidaLocator.cpp \
+    LineBreaker.cpp \
+    PaintGraph.cpp \
+    PaintRenderer.cpp \
     Raw.cpp \
     RenderableFace.cpp \
     ScriptClassifier.cpp \
@@ -21,10 +21,12 @@ extern "C" {
 }
 
 #include <jni.h>
+#include <vector>
 
 #include "JavaBridge.h"
 #include "BidiLine.h"
 
+using namespace std;
 using namespace Tehreer;
 
 static void dispose(JNIEnv *env, jobject obj, jlong lineHandle)
@@ -70,12 +72,38 @@ static jobject getVisualRun(JNIEnv *env, jobject obj, jlong lineHandle, jint run
     return JavaBridge(env).BidiRun_construct(charStart, charEnd, embeddingLevel);
 }
 
+static jintArray getVisualRunArray(JNIEnv *env, jobject obj, jlong lineHandle)
+{
+    auto bidiLine = reinterpret_cast<SBLineRef>(lineHandle);
+    SBUInteger runCount = SBLineGetRunCount(bidiLine);
+    const SBRun *runArray = SBLineGetRunsPtr(bidiLine);
+
+    /* Each run is packed as its char start, char end and embedding level. */
+    vector<jint> values(runCount * 3);
+
+    for (SBUInteger i = 0; i < runCount; i++) {
+        const SBRun &run = runArray[i];
+        jint *runValues = &values[i * 3];
+
+        runValues[0] = static_cast<jint>(run.offset);
+        runValues[1] = static_cast<jint>(run.offset + run.length);
+        runValues[2] = static_cast<jint>(run.level);
+    }
+
+    auto length = static_cast<jsize>(values.size());
+    jintArray array = env->NewIntArray(length);
+    env->SetIntArrayRegion(array, 0, length, values.data());
+
+    return array;
+}
+
 static JNINativeMethod JNI_METHODS[] = {
     { "nDispose", "(J)V", (void *)dispose },
     { "nGetCharStart", "(J)I", (void *)getCharStart },
     { "nGetCharEnd", "(J)I", (void *)getCharEnd },
     { "nGetRunCount", "(J)I", (void *)getRunCount },
     { "nGetVisualRun", "(JI)Lcom/mta/tehreer/unicode/BidiRun;", (void *)getVisualRun },
+    { "nGetVisualRunArray", "(J)[I", (void *)getVisualRunArray },
 };
 
 jint register_com_mta_tehreer_unicode_BidiLine(JNIEnv *env)
@@ -21,11 +21,13 @@ extern "C" {
 }
 
 #include <jni.h>
+#include <vector>
 
 #include "BidiBuffer.h"
 #include "JavaBridge.h"
 #include "BidiMirrorLocator.h"
 
+using namespace std;
 using namespace Tehreer;
 
 static jlong create(JNIEnv *env, jobject obj)
@@ -66,11 +68,31 @@ static jobject getNextPair(JNIEnv *env, jobject obj, jlong locatorHandle)
     return nullptr;
 }
 
+static jintArray getAllPairs(JNIEnv *env, jobject obj, jlong locatorHandle)
+{
+    auto mirrorLocator = reinterpret_cast<SBMirrorLocatorRef>(locatorHandle);
+    const SBMirrorAgent *mirrorAgent = SBMirrorLocatorGetAgent(mirrorLocator);
+    vector<jint> values;
+
+    while (SBMirrorLocatorMoveNext(mirrorLocator)) {
+        values.push_back(static_cast<jint>(mirrorAgent->index));
+        values.push_back(static_cast<jint>(mirrorAgent->codepoint));
+        values.push_back(static_cast<jint>(mirrorAgent->mirror));
+    }
+
+    auto length = static_cast<jsize>(values.size());
+    jintArray array = env->NewIntArray(length);
+    env->SetIntArrayRegion(array, 0, length, values.data());
+
+    return array;
+}
+
 static JNINativeMethod JNI_METHODS[] = {
     { "nCreate", "()J", (void *)create },
     { "nDispose", "(J)V", (void *)dispose },
     { "nLoadLine", "(JJJ)V", (void *)loadLine },
     { "nGetNextPair", "(J)Lcom/mta/tehreer/unicode/BidiPair;", (void *)getNextPair },
+    { "nGetAllPairs", "(J)[I", (void *)getAllPairs },
 };
 
 jint register_com_mta_tehreer_unicode_BidiMirrorLocator(JNIEnv *env)
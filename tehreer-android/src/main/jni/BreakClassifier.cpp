@@ -0,0 +1,348 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <jni.h>
+#include <vector>
+
+#include "JavaBridge.h"
+#include "BreakClassifier.h"
+
+using namespace std;
+using namespace Tehreer;
+
+static inline uint32_t nextCodePoint(const jchar *charArray, jint &charIndex, jint charEnd)
+{
+    jchar lead = charArray[charIndex++];
+
+    if (lead >= 0xD800 && lead <= 0xDBFF && charIndex < charEnd) {
+        jchar trail = charArray[charIndex];
+
+        if (trail >= 0xDC00 && trail <= 0xDFFF) {
+            charIndex += 1;
+            return ((lead - 0xD800) << 10) + (trail - 0xDC00) + 0x10000;
+        }
+    }
+
+    return lead;
+}
+
+BreakClassifier::BreakClassifier(const jchar *charArray, jbyte *breakData)
+    : m_charArray(charArray)
+    , m_breakData(breakData)
+{
+}
+
+void BreakClassifier::classify(jint charStart, jint charEnd)
+{
+    const jbyte breakMask = BreakTypeCharacter | BreakTypeLine;
+
+    for (jint i = charStart; i < charEnd; i++) {
+        m_breakData[i] &= ~breakMask;
+    }
+
+    if (charStart < charEnd) {
+        fillCharacterBreaks(charStart, charEnd);
+        fillLineBreaks(charStart, charEnd);
+
+        /* GB2, LB3: Always break at the end of text. */
+        m_breakData[charEnd - 1] |= breakMask;
+    }
+}
+
+bool BreakClassifier::startsNumber(jint charIndex, jint charEnd, bool allowsInfix) const
+{
+    using namespace LineBreak;
+
+    while (charIndex < charEnd) {
+        uint8_t props = lookupBreakProperties(nextCodePoint(m_charArray, charIndex, charEnd));
+        auto charClass = static_cast<Class>(props & CLASS_MASK);
+
+        /* Skip the combining marks as they attach to the previous character. */
+        if (charClass == CM || charClass == ZWJ) {
+            continue;
+        }
+        if (charClass == IS && allowsInfix) {
+            allowsInfix = false;
+            continue;
+        }
+
+        return charClass == NU;
+    }
+
+    return false;
+}
+
+void BreakClassifier::fillCharacterBreaks(jint charStart, jint charEnd)
+{
+    using namespace GraphemeBreak;
+
+    jint charIndex = charStart;
+    uint8_t props = lookupBreakProperties(nextCodePoint(m_charArray, charIndex, charEnd)) >> 8;
+    auto prevClass = static_cast<Class>(props & CLASS_MASK);
+    bool inPictographic = props & EXTENDED_PICTOGRAPHIC;
+    bool afterPictographicZWJ = false;
+    jint riCount = (prevClass == RI ? 1 : 0);
+
+    while (charIndex < charEnd) {
+        jint prevEnd = charIndex;
+        props = lookupBreakProperties(nextCodePoint(m_charArray, charIndex, charEnd)) >> 8;
+        auto currClass = static_cast<Class>(props & CLASS_MASK);
+        bool isPictographic = props & EXTENDED_PICTOGRAPHIC;
+        bool isBreak;
+
+        if (prevClass == CR && currClass == LF) {
+            isBreak = false;                                        /* GB3 */
+        } else if (prevClass == CR || prevClass == LF || prevClass == CN) {
+            isBreak = true;                                         /* GB4 */
+        } else if (currClass == CR || currClass == LF || currClass == CN) {
+            isBreak = true;                                         /* GB5 */
+        } else if (prevClass == L && (currClass == L || currClass == V
+                                      || currClass == LV || currClass == LVT)) {
+            isBreak = false;                                        /* GB6 */
+        } else if ((prevClass == LV || prevClass == V) && (currClass == V || currClass == T)) {
+            isBreak = false;                                        /* GB7 */
+        } else if ((prevClass == LVT || prevClass == T) && currClass == T) {
+            isBreak = false;                                        /* GB8 */
+        } else if (currClass == EX || currClass == ZWJ || currClass == SM) {
+            isBreak = false;                                        /* GB9, GB9a */
+        } else if (prevClass == PP) {
+            isBreak = false;                                        /* GB9b */
+        } else if (afterPictographicZWJ && isPictographic) {
+            isBreak = false;                                        /* GB11 */
+        } else if (prevClass == RI && currClass == RI && (riCount & 1)) {
+            isBreak = false;                                        /* GB12, GB13 */
+        } else {
+            isBreak = true;                                         /* GB999 */
+        }
+
+        if (isBreak) {
+            m_breakData[prevEnd - 1] |= BreakTypeCharacter;
+        }
+
+        afterPictographicZWJ = (inPictographic && currClass == ZWJ);
+        inPictographic = isPictographic || (inPictographic && currClass == EX);
+        riCount = (currClass == RI ? riCount + 1 : 0);
+        prevClass = currClass;
+    }
+}
+
+void BreakClassifier::fillLineBreaks(jint charStart, jint charEnd)
+{
+    using namespace LineBreak;
+
+    jint charIndex = charStart;
+    uint32_t codePoint = nextCodePoint(m_charArray, charIndex, charEnd);
+    uint8_t props = lookupBreakProperties(codePoint);
+    auto rawClass = static_cast<Class>(props & CLASS_MASK);
+    auto prevClass = rawClass;
+
+    /* LB10: Treat a leading combining mark as AL. */
+    if (prevClass == CM || prevClass == ZWJ) {
+        prevClass = AL;
+        props &= ~CLASS_MASK;
+    }
+
+    Class prevRaw = rawClass;
+    Class beforePrev = prevClass;
+    Class baseClass = prevClass;
+    uint8_t prevProps = props;
+    uint32_t prevCodePoint = codePoint;
+    jint riCount = (prevClass == RI ? 1 : 0);
+    bool atWordStart = true;
+    bool inNumber = (prevClass == NU);
+    bool closesNumber = false;
+
+    while (charIndex < charEnd) {
+        jint prevEnd = charIndex;
+        codePoint = nextCodePoint(m_charArray, charIndex, charEnd);
+        props = lookupBreakProperties(codePoint);
+        rawClass = static_cast<Class>(props & CLASS_MASK);
+        auto currClass = rawClass;
+
+        /* The class preceding a sequence of spaces, if any. */
+        Class spaceBase = (prevClass == SP ? baseClass : prevClass);
+        bool isBreak;
+
+        if (prevClass == BK) {
+            isBreak = true;                                         /* LB4 */
+        } else if (prevClass == CR) {
+            isBreak = (currClass != LF);                            /* LB5 */
+        } else if (prevClass == LF || prevClass == NL) {
+            isBreak = true;                                         /* LB5 */
+        } else if (currClass == BK || currClass == CR || currClass == LF || currClass == NL) {
+            isBreak = false;                                        /* LB6 */
+        } else if (currClass == SP || currClass == ZW) {
+            isBreak = false;                                        /* LB7 */
+        } else if (prevClass == SP && spaceBase != OP && currClass == IS
+                   && startsNumber(charIndex, charEnd, false)) {
+            isBreak = true;                                         /* LB13 (tailored) */
+        } else if (spaceBase == ZW) {
+            isBreak = true;                                         /* LB8 */
+        } else if ((currClass == CM || currClass == ZWJ) && prevClass != SP && prevClass != ZW) {
+            /* LB9: Attach the combining mark to the previous character. */
+            prevRaw = rawClass;
+            continue;
+        } else if (prevRaw == ZWJ) {
+            isBreak = false;                                        /* LB8a */
+        } else {
+            if (currClass == CM || currClass == ZWJ) {
+                currClass = AL;                                     /* LB10 */
+                props &= ~CLASS_MASK;
+            }
+
+            if (prevClass == WJ || currClass == WJ) {
+                isBreak = false;                                    /* LB11 */
+            } else if (prevClass == GL) {
+                isBreak = false;                                    /* LB12 */
+            } else if (currClass == GL && prevClass != SP && prevClass != BA && prevClass != HY) {
+                isBreak = false;                                    /* LB12a */
+            } else if (currClass == CL || currClass == CP || currClass == EX
+                       || currClass == IS || currClass == SY) {
+                isBreak = false;                                    /* LB13 */
+            } else if (spaceBase == OP) {
+                isBreak = false;                                    /* LB14 */
+            } else if (spaceBase == QU && currClass == OP) {
+                isBreak = false;                                    /* LB15 */
+            } else if ((spaceBase == CL || spaceBase == CP) && currClass == NS) {
+                isBreak = false;                                    /* LB16 */
+            } else if (spaceBase == B2 && currClass == B2) {
+                isBreak = false;                                    /* LB17 */
+            } else if (prevClass == SP) {
+                isBreak = true;                                     /* LB18 */
+            } else if (prevClass == QU || currClass == QU) {
+                isBreak = false;                                    /* LB19 */
+            } else if (prevClass == CB || currClass == CB) {
+                isBreak = true;                                     /* LB20 */
+            } else if (atWordStart && (prevClass == HY || prevCodePoint == 0x2010) && currClass == AL) {
+                isBreak = false;                                    /* LB20 (tailored) */
+            } else if (currClass == BA || currClass == HY || currClass == NS || prevClass == BB) {
+                isBreak = false;                                    /* LB21 */
+            } else if (beforePrev == HL && (prevClass == HY || prevClass == BA)) {
+                isBreak = false;                                    /* LB21a */
+            } else if (prevClass == SY && currClass == HL) {
+                isBreak = false;                                    /* LB21b */
+            } else if (currClass == IN) {
+                isBreak = false;                                    /* LB22 */
+            } else if ((prevClass == AL || prevClass == HL) && currClass == NU) {
+                isBreak = false;                                    /* LB23 */
+            } else if (prevClass == NU && (currClass == AL || currClass == HL)) {
+                isBreak = false;                                    /* LB23 */
+            } else if (prevClass == PR && (currClass == ID || currClass == EB || currClass == EM)) {
+                isBreak = false;                                    /* LB23a */
+            } else if ((prevClass == ID || prevClass == EB || prevClass == EM) && currClass == PO) {
+                isBreak = false;                                    /* LB23a */
+            } else if ((prevClass == PR || prevClass == PO) && (currClass == AL || currClass == HL)) {
+                isBreak = false;                                    /* LB24 */
+            } else if ((prevClass == AL || prevClass == HL) && (currClass == PR || currClass == PO)) {
+                isBreak = false;                                    /* LB24 */
+            } else if ((inNumber || closesNumber) && (currClass == PO || currClass == PR)) {
+                isBreak = false;                                    /* LB25 */
+            } else if ((inNumber || prevClass == PO || prevClass == PR || prevClass == HY
+                        || prevClass == IS) && currClass == NU) {
+                isBreak = false;                                    /* LB25 */
+            } else if ((prevClass == PO || prevClass == PR) && (currClass == OP || currClass == HY)
+                       && startsNumber(charIndex, charEnd, true)) {
+                isBreak = false;                                    /* LB25 */
+            } else if (prevClass == JL && (currClass == JL || currClass == JV
+                                           || currClass == H2 || currClass == H3)) {
+                isBreak = false;                                    /* LB26 */
+            } else if ((prevClass == JV || prevClass == H2) && (currClass == JV || currClass == JT)) {
+                isBreak = false;                                    /* LB26 */
+            } else if ((prevClass == JT || prevClass == H3) && currClass == JT) {
+                isBreak = false;                                    /* LB26 */
+            } else if ((prevClass == JL || prevClass == JV || prevClass == JT
+                        || prevClass == H2 || prevClass == H3) && currClass == PO) {
+                isBreak = false;                                    /* LB27 */
+            } else if (prevClass == PR && (currClass == JL || currClass == JV || currClass == JT
+                                           || currClass == H2 || currClass == H3)) {
+                isBreak = false;                                    /* LB27 */
+            } else if ((prevClass == AL || prevClass == HL) && (currClass == AL || currClass == HL)) {
+                isBreak = false;                                    /* LB28 */
+            } else if (prevClass == IS && (currClass == AL || currClass == HL)) {
+                isBreak = false;                                    /* LB29 */
+            } else if ((prevClass == AL || prevClass == HL || prevClass == NU)
+                       && currClass == OP && !(props & EAST_ASIAN)) {
+                isBreak = false;                                    /* LB30 */
+            } else if (prevClass == CP && !(prevProps & EAST_ASIAN)
+                       && (currClass == AL || currClass == HL || currClass == NU)) {
+                isBreak = false;                                    /* LB30 */
+            } else if (prevClass == RI && currClass == RI && (riCount & 1)) {
+                isBreak = false;                                    /* LB30a */
+            } else if (currClass == EM && (prevClass == EB || (prevProps & UNASSIGNED_PICTOGRAPHIC))) {
+                isBreak = false;                                    /* LB30b */
+            } else {
+                isBreak = true;                                     /* LB31 */
+            }
+        }
+
+        if (isBreak) {
+            m_breakData[prevEnd - 1] |= BreakTypeLine;
+        }
+
+        /* LB10: Treat a combining mark that follows a hard break, a space or ZW as AL. */
+        if (currClass == CM || currClass == ZWJ) {
+            currClass = AL;
+            props &= ~CLASS_MASK;
+        }
+
+        if (currClass != SP) {
+            baseClass = currClass;
+        }
+        riCount = (currClass == RI ? riCount + 1 : 0);
+        atWordStart = (prevClass == BK || prevClass == CR || prevClass == LF || prevClass == NL
+                       || prevClass == ZW || prevClass == CB || (prevClass == SP && spaceBase != OP));
+        closesNumber = (inNumber && (currClass == CL || currClass == CP));
+        inNumber = (currClass == NU || (inNumber && (currClass == SY || currClass == IS)));
+        beforePrev = prevClass;
+        prevClass = currClass;
+        prevRaw = rawClass;
+        prevProps = props;
+        prevCodePoint = codePoint;
+    }
+}
+
+static void classify(JNIEnv *env, jobject obj, jstring text, jbyteArray breakData, jint charStart, jint charEnd)
+{
+    jint charCount = charEnd - charStart;
+    if (charCount <= 0) {
+        return;
+    }
+
+    /*
+     * Work on copies of the range so that disjoint ranges of the same array can be classified
+     * concurrently without one thread writing back stale data of another.
+     */
+    vector<jchar> charArray(charCount);
+    vector<jbyte> breakArray(charCount);
+
+    env->GetStringRegion(text, charStart, charCount, charArray.data());
+    env->GetByteArrayRegion(breakData, charStart, charCount, breakArray.data());
+
+    BreakClassifier breakClassifier(charArray.data(), breakArray.data());
+    breakClassifier.classify(0, charCount);
+
+    env->SetByteArrayRegion(breakData, charStart, charCount, breakArray.data());
+}
+
+static JNINativeMethod JNI_METHODS[] = {
+    { "nClassify", "(Ljava/lang/String;[BII)V", (void *)classify },
+};
+
+jint register_com_mta_tehreer_unicode_BreakClassifier(JNIEnv *env)
+{
+    return JavaBridge::registerClass(env, "com/mta/tehreer/unicode/BreakClassifier", JNI_METHODS, sizeof(JNI_METHODS) / sizeof(JNI_METHODS[0]));
+}
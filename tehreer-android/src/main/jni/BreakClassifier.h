@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _TEHREER__BREAK_CLASSIFIER_H
+#define _TEHREER__BREAK_CLASSIFIER_H
+
+#include <jni.h>
+
+#include "BreakLookup.h"
+
+namespace Tehreer {
+
+/*
+ * Resolves grapheme cluster breaks of UAX #29 and line breaks of UAX #14 as of Unicode 14.0.0, the
+ * version of BreakLookup data. Line breaking follows the tailorings of ICU so that the results
+ * match java.text.BreakIterator, i.e. it breaks before an infix separator starting a number after
+ * spaces and keeps a word-initial hyphen with the following letter.
+ */
+class BreakClassifier {
+public:
+    static const jbyte BreakTypeCharacter = 1 << 0;
+    static const jbyte BreakTypeLine = 1 << 2;
+
+    BreakClassifier(const jchar *charArray, jbyte *breakData);
+
+    void classify(jint charStart, jint charEnd);
+
+private:
+    bool startsNumber(jint charIndex, jint charEnd, bool allowsInfix) const;
+
+    void fillCharacterBreaks(jint charStart, jint charEnd);
+    void fillLineBreaks(jint charStart, jint charEnd);
+
+    const jchar *m_charArray;
+    jbyte *m_breakData;
+};
+
+}
+
+jint register_com_mta_tehreer_unicode_BreakClassifier(JNIEnv *env);
+
+#endif
@@ -0,0 +1,1993 @@
+/*
+ * Automatically generated by SheenBidiGenerator tool from LineBreak.txt,
+ * GraphemeBreakProperty.txt, emoji-data.txt and EastAsianWidth.txt of Unicode 14.0.0.
+ * DO NOT EDIT!!
+ *
+ * REQUIRED MEMORY: (4592*2)+(6016*2)+(1800*2) = 24816 Bytes
+ */
+
+#include <cstdint>
+
+#include "BreakLookup.h"
+
+using namespace Tehreer;
+
+static const uint16_t PrimaryBreakData[4592] = {
+/* DATA_BLOCK: -- 0x0000..0x0007 -- */
+    0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307,
+/* DATA_BLOCK: -- 0x0008..0x000F -- */
+    0x0307, 0x0302, 0x0218, 0x0304, 0x0304, 0x0109, 0x0307, 0x0307,
+/* DATA_BLOCK: -- 0x0010..0x0017 -- */
+    0x0021, 0x000C, 0x001F, 0x0000, 0x001E, 0x001D, 0x0000, 0x001F,
+/* DATA_BLOCK: -- 0x0018..0x001F -- */
+    0x001C, 0x0008, 0x0000, 0x001E, 0x0014, 0x0011, 0x0014, 0x0022,
+/* DATA_BLOCK: -- 0x0020..0x0027 -- */
+    0x001B, 0x001B, 0x001B, 0x001B, 0x001B, 0x001B, 0x001B, 0x001B,
+/* DATA_BLOCK: -- 0x0028..0x002F -- */
+    0x001B, 0x001B, 0x0014, 0x0014, 0x0000, 0x0000, 0x0000, 0x000C,
+/* DATA_BLOCK: -- 0x0030..0x0037 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0038..0x003F -- */
+    0x0000, 0x0000, 0x0000, 0x001C, 0x001E, 0x0008, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0040..0x0047 -- */
+    0x0000, 0x0000, 0x0000, 0x001C, 0x0002, 0x0006, 0x0000, 0x0307,
+/* DATA_BLOCK: -- 0x0048..0x004F -- */
+    0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0319, 0x0307, 0x0307,
+/* DATA_BLOCK: -- 0x0050..0x0057 -- */
+    0x000D, 0x001C, 0x001D, 0x001E, 0x001E, 0x001E, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0058..0x005F -- */
+    0x0000, 0x1000, 0x0000, 0x001F, 0x0000, 0x0302, 0x1000, 0x0000,
+/* DATA_BLOCK: -- 0x0060..0x0067 -- */
+    0x001D, 0x001E, 0x0000, 0x0000, 0x0003, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0068..0x006F -- */
+    0x0000, 0x0000, 0x0000, 0x001F, 0x0000, 0x0000, 0x0000, 0x001C,
+/* DATA_BLOCK: -- 0x0070..0x0077 -- */
+    0x0003, 0x0000, 0x0000, 0x0000, 0x0003, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0078..0x007F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0003,
+/* DATA_BLOCK: -- 0x0080..0x0087 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0088..0x008F -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x040D,
+/* DATA_BLOCK: -- 0x0090..0x0097 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x040D, 0x040D, 0x040D, 0x040D,
+/* DATA_BLOCK: -- 0x0098..0x009F -- */
+    0x040D, 0x040D, 0x040D, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x00A0..0x00A7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0014, 0x0000,
+/* DATA_BLOCK: -- 0x00A8..0x00AF -- */
+    0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x00B0..0x00B7 -- */
+    0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x00B8..0x00BF -- */
+    0x0000, 0x0014, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x001E,
+/* DATA_BLOCK: -- 0x00C0..0x00C7 -- */
+    0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x00C8..0x00CF -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0002, 0x0407,
+/* DATA_BLOCK: -- 0x00D0..0x00D7 -- */
+    0x0000, 0x0407, 0x0407, 0x0000, 0x0407, 0x0407, 0x000C, 0x0407,
+/* DATA_BLOCK: -- 0x00D8..0x00DF -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x00E0..0x00E7 -- */
+    0x0010, 0x0010, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010,
+/* DATA_BLOCK: -- 0x00E8..0x00EF -- */
+    0x0010, 0x0010, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x00F0..0x00F7 -- */
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x00F8..0x00FF -- */
+    0x0000, 0x001D, 0x001D, 0x001D, 0x0014, 0x0014, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0100..0x0107 -- */
+    0x0407, 0x0407, 0x0407, 0x000C, 0x0307, 0x000C, 0x000C, 0x000C,
+/* DATA_BLOCK: -- 0x0108..0x010F -- */
+    0x001B, 0x001B, 0x001D, 0x001B, 0x001B, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0110..0x0117 -- */
+    0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0118..0x011F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0120..0x0127 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0700, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x0128..0x012F -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x0130..0x0137 -- */
+    0x0407, 0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0138..0x013F -- */
+    0x001B, 0x001B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0140..0x0147 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0700,
+/* DATA_BLOCK: -- 0x0148..0x014F -- */
+    0x0000, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0150..0x0157 -- */
+    0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0158..0x015F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0160..0x0167 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0168..0x016F -- */
+    0x0014, 0x000C, 0x0000, 0x0000, 0x0000, 0x0407, 0x001E, 0x001E,
+/* DATA_BLOCK: -- 0x0170..0x0177 -- */
+    0x0407, 0x0407, 0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0178..0x017F -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0180..0x0187 -- */
+    0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0188..0x018F -- */
+    0x0000, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0190..0x0197 -- */
+    0x0700, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0198..0x019F -- */
+    0x0000, 0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x01A0..0x01A7 -- */
+    0x0407, 0x0407, 0x0700, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x01A8..0x01AF -- */
+    0x0407, 0x0407, 0x0407, 0x0807, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x01B0..0x01B7 -- */
+    0x0000, 0x0000, 0x0407, 0x0807, 0x0407, 0x0000, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x01B8..0x01BF -- */
+    0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x01C0..0x01C7 -- */
+    0x0407, 0x0807, 0x0807, 0x0807, 0x0807, 0x0407, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x01C8..0x01CF -- */
+    0x0000, 0x0000, 0x0407, 0x0407, 0x0002, 0x0002, 0x001B, 0x001B,
+/* DATA_BLOCK: -- 0x01D0..0x01D7 -- */
+    0x0000, 0x0407, 0x0807, 0x0807, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x01D8..0x01DF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x01E0..0x01E7 -- */
+    0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0807,
+/* DATA_BLOCK: -- 0x01E8..0x01EF -- */
+    0x0807, 0x0000, 0x0000, 0x0807, 0x0807, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x01F0..0x01F7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x01F8..0x01FF -- */
+    0x0000, 0x0000, 0x0407, 0x0407, 0x0000, 0x0000, 0x001B, 0x001B,
+/* DATA_BLOCK: -- 0x0200..0x0207 -- */
+    0x0000, 0x0000, 0x001D, 0x001D, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0208..0x020F -- */
+    0x0000, 0x001D, 0x0000, 0x001E, 0x0000, 0x0000, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0210..0x0217 -- */
+    0x0000, 0x0407, 0x0407, 0x0807, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0218..0x021F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0220..0x0227 -- */
+    0x0807, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x0228..0x022F -- */
+    0x0407, 0x0000, 0x0000, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0230..0x0237 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001B, 0x001B,
+/* DATA_BLOCK: -- 0x0238..0x023F -- */
+    0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0240..0x0247 -- */
+    0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x0248..0x024F -- */
+    0x0407, 0x0807, 0x0000, 0x0807, 0x0807, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0250..0x0257 -- */
+    0x0000, 0x001E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0258..0x025F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0260..0x0267 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0268..0x026F -- */
+    0x0000, 0x0000, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0270..0x0277 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x0278..0x027F -- */
+    0x0407, 0x0807, 0x0807, 0x0000, 0x0000, 0x0000, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0280..0x0287 -- */
+    0x0807, 0x0000, 0x0807, 0x0807, 0x0807, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0288..0x028F -- */
+    0x0407, 0x0807, 0x0807, 0x0807, 0x0407, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0290..0x0297 -- */
+    0x0407, 0x0807, 0x0807, 0x0807, 0x0807, 0x0000, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0298..0x029F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x02A0..0x02A7 -- */
+    0x0000, 0x0407, 0x0807, 0x0807, 0x0003, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x02A8..0x02AF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x02B0..0x02B7 -- */
+    0x0807, 0x0807, 0x0407, 0x0807, 0x0807, 0x0000, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x02B8..0x02BF -- */
+    0x0807, 0x0000, 0x0807, 0x0807, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x02C0..0x02C7 -- */
+    0x0407, 0x0407, 0x0807, 0x0807, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x02C8..0x02CF -- */
+    0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0000, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x02D0..0x02D7 -- */
+    0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x02D8..0x02DF -- */
+    0x0807, 0x0000, 0x0807, 0x0807, 0x0807, 0x0407, 0x0700, 0x0000,
+/* DATA_BLOCK: -- 0x02E0..0x02E7 -- */
+    0x0000, 0x001D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x02E8..0x02EF -- */
+    0x0000, 0x0000, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x02F0..0x02F7 -- */
+    0x0807, 0x0807, 0x0407, 0x0407, 0x0407, 0x0000, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x02F8..0x02FF -- */
+    0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0300..0x0307 -- */
+    0x0000, 0x0000, 0x0807, 0x0807, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0308..0x030F -- */
+    0x0000, 0x0407, 0x0000, 0x0800, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0310..0x0317 -- */
+    0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x001E,
+/* DATA_BLOCK: -- 0x0318..0x031F -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0320..0x0327 -- */
+    0x001B, 0x001B, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0328..0x032F -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0330..0x0337 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0338..0x033F -- */
+    0x0000, 0x0003, 0x0003, 0x0003, 0x0003, 0x0000, 0x0003, 0x0003,
+/* DATA_BLOCK: -- 0x0340..0x0347 -- */
+    0x000D, 0x0003, 0x0003, 0x0002, 0x000D, 0x000C, 0x000C, 0x000C,
+/* DATA_BLOCK: -- 0x0348..0x034F -- */
+    0x000C, 0x000C, 0x000D, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0350..0x0357 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0407, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x0358..0x035F -- */
+    0x0000, 0x0407, 0x001C, 0x0006, 0x001C, 0x0006, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0360..0x0367 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0802,
+/* DATA_BLOCK: -- 0x0368..0x036F -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0002, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0370..0x0377 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0378..0x037F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0380..0x0387 -- */
+    0x0003, 0x0003, 0x0002, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0388..0x038F -- */
+    0x0000, 0x000D, 0x000D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0390..0x0397 -- */
+    0x0000, 0x0000, 0x0000, 0x0007, 0x0007, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0398..0x039F -- */
+    0x0407, 0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x03A0..0x03A7 -- */
+    0x0007, 0x0407, 0x0407, 0x0807, 0x0807, 0x0407, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x03A8..0x03AF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x03B0..0x03B7 -- */
+    0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x03B8..0x03BF -- */
+    0x0407, 0x0000, 0x0007, 0x0007, 0x0007, 0x0000, 0x0000, 0x0007,
+/* DATA_BLOCK: -- 0x03C0..0x03C7 -- */
+    0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x03C8..0x03CF -- */
+    0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x03D0..0x03D7 -- */
+    0x0000, 0x0000, 0x0407, 0x0007, 0x0807, 0x0407, 0x0407, 0x0007,
+/* DATA_BLOCK: -- 0x03D8..0x03DF -- */
+    0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0407, 0x0000, 0x0007,
+/* DATA_BLOCK: -- 0x03E0..0x03E7 -- */
+    0x001B, 0x001B, 0x0007, 0x0007, 0x0007, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x03E8..0x03EF -- */
+    0x0955, 0x0955, 0x0955, 0x0955, 0x0955, 0x0955, 0x0955, 0x0955,
+/* DATA_BLOCK: -- 0x03F0..0x03F7 -- */
+    0x0A17, 0x0A17, 0x0A17, 0x0A17, 0x0A17, 0x0A17, 0x0A17, 0x0A17,
+/* DATA_BLOCK: -- 0x03F8..0x03FF -- */
+    0x0B16, 0x0B16, 0x0B16, 0x0B16, 0x0B16, 0x0B16, 0x0B16, 0x0B16,
+/* DATA_BLOCK: -- 0x0400..0x0407 -- */
+    0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0408..0x040F -- */
+    0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0410..0x0417 -- */
+    0x0000, 0x0000, 0x0000, 0x001C, 0x0006, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0418..0x041F -- */
+    0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0420..0x0427 -- */
+    0x0000, 0x0000, 0x0407, 0x0407, 0x0407, 0x0807, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0428..0x042F -- */
+    0x0000, 0x0000, 0x0407, 0x0407, 0x0807, 0x0002, 0x0002, 0x0000,
+/* DATA_BLOCK: -- 0x0430..0x0437 -- */
+    0x0000, 0x0000, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0438..0x043F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0440..0x0447 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0448..0x044F -- */
+    0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x0450..0x0457 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0002, 0x0002, 0x001A, 0x0000,
+/* DATA_BLOCK: -- 0x0458..0x045F -- */
+    0x0002, 0x0000, 0x0002, 0x001E, 0x0000, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0460..0x0467 -- */
+    0x0000, 0x0000, 0x000C, 0x000C, 0x0002, 0x0002, 0x0003, 0x0000,
+/* DATA_BLOCK: -- 0x0468..0x046F -- */
+    0x000C, 0x000C, 0x0000, 0x0407, 0x0407, 0x0407, 0x030D, 0x0407,
+/* DATA_BLOCK: -- 0x0470..0x0477 -- */
+    0x0407, 0x0407, 0x0407, 0x0807, 0x0807, 0x0807, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0478..0x047F -- */
+    0x0407, 0x0807, 0x0807, 0x0807, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0480..0x0487 -- */
+    0x0807, 0x0807, 0x0407, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0488..0x048F -- */
+    0x0807, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0490..0x0497 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x000C, 0x000C, 0x001B, 0x001B,
+/* DATA_BLOCK: -- 0x0498..0x049F -- */
+    0x0407, 0x0807, 0x0807, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x04A0..0x04A7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0807, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x04A8..0x04AF -- */
+    0x0407, 0x0007, 0x0407, 0x0007, 0x0007, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x04B0..0x04B7 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0807, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x04B8..0x04BF -- */
+    0x0807, 0x0807, 0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x04C0..0x04C7 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0807, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x04C8..0x04CF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x04D0..0x04D7 -- */
+    0x0407, 0x0407, 0x0407, 0x0807, 0x0407, 0x0807, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x04D8..0x04DF -- */
+    0x0807, 0x0807, 0x0407, 0x0807, 0x0807, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x04E0..0x04E7 -- */
+    0x001B, 0x001B, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x04E8..0x04EF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000,
+/* DATA_BLOCK: -- 0x04F0..0x04F7 -- */
+    0x0407, 0x0407, 0x0807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x04F8..0x04FF -- */
+    0x0000, 0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0500..0x0507 -- */
+    0x0407, 0x0407, 0x0807, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0508..0x050F -- */
+    0x0407, 0x0407, 0x0807, 0x0807, 0x0807, 0x0407, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0510..0x0517 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0807, 0x0807, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0518..0x051F -- */
+    0x0807, 0x0807, 0x0807, 0x0807, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0520..0x0527 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0807, 0x0807, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0528..0x052F -- */
+    0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0530..0x0537 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0538..0x053F -- */
+    0x0407, 0x0407, 0x0407, 0x0000, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0540..0x0547 -- */
+    0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0548..0x054F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0000, 0x0807,
+/* DATA_BLOCK: -- 0x0550..0x0557 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0003, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0558..0x055F -- */
+    0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x000D,
+/* DATA_BLOCK: -- 0x0560..0x0567 -- */
+    0x0002, 0x0002, 0x0002, 0x0324, 0x0407, 0x0525, 0x0307, 0x0307,
+/* DATA_BLOCK: -- 0x0568..0x056F -- */
+    0x0002, 0x000D, 0x0002, 0x0002, 0x0001, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0570..0x0577 -- */
+    0x001F, 0x001F, 0x001C, 0x001F, 0x001F, 0x001F, 0x001C, 0x001F,
+/* DATA_BLOCK: -- 0x0578..0x057F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0013, 0x0013, 0x0013, 0x0002,
+/* DATA_BLOCK: -- 0x0580..0x0587 -- */
+    0x0304, 0x0304, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x000D,
+/* DATA_BLOCK: -- 0x0588..0x058F -- */
+    0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D,
+/* DATA_BLOCK: -- 0x0590..0x0597 -- */
+    0x0000, 0x001F, 0x001F, 0x0000, 0x101A, 0x001A, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0598..0x059F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0014, 0x001C, 0x0006, 0x001A,
+/* DATA_BLOCK: -- 0x05A0..0x05A7 -- */
+    0x001A, 0x101A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x05A8..0x05AF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000,
+/* DATA_BLOCK: -- 0x05B0..0x05B7 -- */
+    0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x05B8..0x05BF -- */
+    0x0323, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0307, 0x0307,
+/* DATA_BLOCK: -- 0x05C0..0x05C7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001C, 0x0006, 0x0000,
+/* DATA_BLOCK: -- 0x05C8..0x05CF -- */
+    0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001D,
+/* DATA_BLOCK: -- 0x05D0..0x05D7 -- */
+    0x001E, 0x005E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E,
+/* DATA_BLOCK: -- 0x05D8..0x05DF -- */
+    0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001D, 0x001E,
+/* DATA_BLOCK: -- 0x05E0..0x05E7 -- */
+    0x001E, 0x001E, 0x001E, 0x001D, 0x001E, 0x001E, 0x001D, 0x001E,
+/* DATA_BLOCK: -- 0x05E8..0x05EF -- */
+    0x001D, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E,
+/* DATA_BLOCK: -- 0x05F0..0x05F7 -- */
+    0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E,
+/* DATA_BLOCK: -- 0x05F8..0x05FF -- */
+    0x0000, 0x0000, 0x0000, 0x001D, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0600..0x0607 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001E, 0x0000,
+/* DATA_BLOCK: -- 0x0608..0x060F -- */
+    0x0000, 0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0610..0x0617 -- */
+    0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0618..0x061F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x0620..0x0627 -- */
+    0x1000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0628..0x062F -- */
+    0x0000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0630..0x0637 -- */
+    0x0000, 0x0000, 0x001E, 0x001E, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0638..0x063F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0013,
+/* DATA_BLOCK: -- 0x0640..0x0647 -- */
+    0x001C, 0x0006, 0x001C, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0648..0x064F -- */
+    0x0000, 0x0000, 0x1052, 0x1052, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0650..0x0657 -- */
+    0x1000, 0x005C, 0x0046, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0658..0x065F -- */
+    0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0660..0x0667 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000,
+/* DATA_BLOCK: -- 0x0668..0x066F -- */
+    0x0000, 0x1040, 0x1040, 0x1040, 0x1040, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x0670..0x0677 -- */
+    0x1052, 0x1012, 0x1012, 0x1052, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0678..0x067F -- */
+    0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0680..0x0687 -- */
+    0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0688..0x068F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000,
+/* DATA_BLOCK: -- 0x0690..0x0697 -- */
+    0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1040, 0x1040, 0x0000,
+/* DATA_BLOCK: -- 0x0698..0x069F -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1000, 0x1000, 0x0000, 0x1000,
+/* DATA_BLOCK: -- 0x06A0..0x06A7 -- */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x06A8..0x06AF -- */
+    0x1000, 0x1000, 0x1000, 0x0000, 0x1052, 0x1052, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x06B0..0x06B7 -- */
+    0x1012, 0x1000, 0x1012, 0x1012, 0x1012, 0x100A, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x06B8..0x06BF -- */
+    0x1000, 0x1012, 0x1012, 0x1012, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x06C0..0x06C7 -- */
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+/* DATA_BLOCK: -- 0x06C8..0x06CF -- */
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x06D0..0x06D7 -- */
+    0x1012, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x06D8..0x06DF -- */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1052,
+/* DATA_BLOCK: -- 0x06E0..0x06E7 -- */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x06E8..0x06EF -- */
+    0x1000, 0x1000, 0x1000, 0x1040, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x06F0..0x06F7 -- */
+    0x1000, 0x1040, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x06F8..0x06FF -- */
+    0x1000, 0x1000, 0x1040, 0x1040, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x0700..0x0707 -- */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1052, 0x1052, 0x1012,
+/* DATA_BLOCK: -- 0x0708..0x070F -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1052, 0x1052, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0710..0x0717 -- */
+    0x1012, 0x1000, 0x1000, 0x1000, 0x1000, 0x1012, 0x1040, 0x1012,
+/* DATA_BLOCK: -- 0x0718..0x071F -- */
+    0x1012, 0x1012, 0x1000, 0x1012, 0x1052, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x0720..0x0727 -- */
+    0x1012, 0x1012, 0x1000, 0x1000, 0x1012, 0x1000, 0x1000, 0x1012,
+/* DATA_BLOCK: -- 0x0728..0x072F -- */
+    0x1012, 0x1012, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x0730..0x0737 -- */
+    0x1000, 0x1000, 0x1052, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x0738..0x073F -- */
+    0x1000, 0x1012, 0x1052, 0x1052, 0x1012, 0x1052, 0x1000, 0x1012,
+/* DATA_BLOCK: -- 0x0740..0x0747 -- */
+    0x1012, 0x100A, 0x1052, 0x1000, 0x1000, 0x1052, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0748..0x074F -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1040, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0750..0x0757 -- */
+    0x1012, 0x1012, 0x104A, 0x104A, 0x100A, 0x100A, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x0758..0x075F -- */
+    0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
+/* DATA_BLOCK: -- 0x0760..0x0767 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0768..0x076F -- */
+    0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0770..0x0777 -- */
+    0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0778..0x077F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0000, 0x1000,
+/* DATA_BLOCK: -- 0x0780..0x0787 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x0000, 0x1040, 0x0000,
+/* DATA_BLOCK: -- 0x0788..0x078F -- */
+    0x0000, 0x0000, 0x0000, 0x1040, 0x1040, 0x1040, 0x0000, 0x1040,
+/* DATA_BLOCK: -- 0x0790..0x0797 -- */
+    0x0000, 0x0000, 0x0000, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F,
+/* DATA_BLOCK: -- 0x0798..0x079F -- */
+    0x001F, 0x0000, 0x000C, 0x100C, 0x1012, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x07A0..0x07A7 -- */
+    0x001C, 0x0006, 0x001C, 0x0006, 0x001C, 0x0006, 0x001C, 0x0006,
+/* DATA_BLOCK: -- 0x07A8..0x07AF -- */
+    0x001C, 0x0006, 0x001C, 0x0006, 0x001C, 0x0006, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x07B0..0x07B7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040, 0x1040,
+/* DATA_BLOCK: -- 0x07B8..0x07BF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
+/* DATA_BLOCK: -- 0x07C0..0x07C7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001C, 0x0006,
+/* DATA_BLOCK: -- 0x07C8..0x07CF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x07D0..0x07D7 -- */
+    0x0000, 0x0000, 0x0000, 0x001C, 0x0006, 0x001C, 0x0006, 0x001C,
+/* DATA_BLOCK: -- 0x07D8..0x07DF -- */
+    0x0006, 0x001C, 0x0006, 0x001C, 0x0006, 0x001C, 0x0006, 0x001C,
+/* DATA_BLOCK: -- 0x07E0..0x07E7 -- */
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x07E8..0x07EF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x001C, 0x0006, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x07F0..0x07F7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x07F8..0x07FF -- */
+    0x0000, 0x0000, 0x0000, 0x1040, 0x1040, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0800..0x0807 -- */
+    0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0808..0x080F -- */
+    0x0000, 0x000C, 0x0002, 0x0002, 0x0002, 0x0000, 0x000C, 0x0002,
+/* DATA_BLOCK: -- 0x0810..0x0817 -- */
+    0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F,
+/* DATA_BLOCK: -- 0x0818..0x081F -- */
+    0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0820..0x0827 -- */
+    0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0002,
+/* DATA_BLOCK: -- 0x0828..0x082F -- */
+    0x001C, 0x0002, 0x0000, 0x0000, 0x001F, 0x001F, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0830..0x0837 -- */
+    0x001F, 0x001F, 0x001C, 0x0006, 0x001C, 0x0006, 0x001C, 0x0006,
+/* DATA_BLOCK: -- 0x0838..0x083F -- */
+    0x001C, 0x0006, 0x0002, 0x0002, 0x0002, 0x0002, 0x000C, 0x0000,
+/* DATA_BLOCK: -- 0x0840..0x0847 -- */
+    0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0848..0x084F -- */
+    0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0000,
+/* DATA_BLOCK: -- 0x0850..0x0857 -- */
+    0x0002, 0x0002, 0x001C, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0858..0x085F -- */
+    0x0002, 0x0002, 0x0002, 0x0000, 0x0002, 0x0000, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0860..0x0867 -- */
+    0x0000, 0x0000, 0x0000, 0x000C, 0x000C, 0x001C, 0x0006, 0x001C,
+/* DATA_BLOCK: -- 0x0868..0x086F -- */
+    0x0006, 0x001C, 0x0006, 0x001C, 0x0006, 0x0002, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0870..0x0877 -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0878..0x087F -- */
+    0x0052, 0x0052, 0x0000, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0880..0x0887 -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0888..0x088F -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0890..0x0897 -- */
+    0x0042, 0x0046, 0x0046, 0x0052, 0x0052, 0x005A, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0898..0x089F -- */
+    0x005C, 0x0046, 0x005C, 0x0046, 0x005C, 0x0046, 0x005C, 0x0046,
+/* DATA_BLOCK: -- 0x08A0..0x08A7 -- */
+    0x005C, 0x0046, 0x0052, 0x0052, 0x005C, 0x0046, 0x005C, 0x0046,
+/* DATA_BLOCK: -- 0x08A8..0x08AF -- */
+    0x005C, 0x0046, 0x005C, 0x0046, 0x005A, 0x005C, 0x0046, 0x0046,
+/* DATA_BLOCK: -- 0x08B0..0x08B7 -- */
+    0x0052, 0x0052, 0x0447, 0x0447, 0x0447, 0x0447, 0x0447, 0x0447,
+/* DATA_BLOCK: -- 0x08B8..0x08BF -- */
+    0x1052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0047, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x08C0..0x08C7 -- */
+    0x0052, 0x0052, 0x0052, 0x005A, 0x005A, 0x1052, 0x0052, 0x0012,
+/* DATA_BLOCK: -- 0x08C8..0x08CF -- */
+    0x0000, 0x005A, 0x0052, 0x005A, 0x0052, 0x005A, 0x0052, 0x005A,
+/* DATA_BLOCK: -- 0x08D0..0x08D7 -- */
+    0x0052, 0x005A, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x08D8..0x08DF -- */
+    0x0052, 0x0052, 0x0052, 0x005A, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x08E0..0x08E7 -- */
+    0x0052, 0x0052, 0x0052, 0x005A, 0x0052, 0x005A, 0x0052, 0x005A,
+/* DATA_BLOCK: -- 0x08E8..0x08EF -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x005A, 0x0052,
+/* DATA_BLOCK: -- 0x08F0..0x08F7 -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x005A, 0x005A, 0x0000,
+/* DATA_BLOCK: -- 0x08F8..0x08FF -- */
+    0x0000, 0x0447, 0x0447, 0x005A, 0x005A, 0x005A, 0x005A, 0x0052,
+/* DATA_BLOCK: -- 0x0900..0x0907 -- */
+    0x005A, 0x005A, 0x0052, 0x005A, 0x0052, 0x005A, 0x0052, 0x005A,
+/* DATA_BLOCK: -- 0x0908..0x090F -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x005A, 0x005A, 0x0052,
+/* DATA_BLOCK: -- 0x0910..0x0917 -- */
+    0x0052, 0x0052, 0x0052, 0x005A, 0x005A, 0x005A, 0x005A, 0x0052,
+/* DATA_BLOCK: -- 0x0918..0x091F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0920..0x0927 -- */
+    0x0000, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0928..0x092F -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0000,
+/* DATA_BLOCK: -- 0x0930..0x0937 -- */
+    0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A, 0x005A,
+/* DATA_BLOCK: -- 0x0938..0x093F -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x1052,
+/* DATA_BLOCK: -- 0x0940..0x0947 -- */
+    0x0052, 0x1052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0948..0x094F -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x005A, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0950..0x0957 -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0958..0x095F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x000C, 0x0002,
+/* DATA_BLOCK: -- 0x0960..0x0967 -- */
+    0x0407, 0x0407, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0968..0x096F -- */
+    0x0000, 0x0000, 0x0407, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0970..0x0977 -- */
+    0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0978..0x097F -- */
+    0x0000, 0x0000, 0x0000, 0x0807, 0x0807, 0x0407, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x0980..0x0987 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0988..0x098F -- */
+    0x001D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0990..0x0997 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0003, 0x0003, 0x000C, 0x000C,
+/* DATA_BLOCK: -- 0x0998..0x099F -- */
+    0x0807, 0x0807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x09A0..0x09A7 -- */
+    0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x09A8..0x09AF -- */
+    0x0807, 0x0807, 0x0807, 0x0807, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x09B0..0x09B7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0003, 0x0000, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x09B8..0x09BF -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x09C0..0x09C7 -- */
+    0x0955, 0x0955, 0x0955, 0x0955, 0x0955, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x09C8..0x09CF -- */
+    0x0000, 0x0000, 0x0000, 0x0407, 0x0807, 0x0807, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x09D0..0x09D7 -- */
+    0x0407, 0x0407, 0x0807, 0x0807, 0x0407, 0x0407, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x09D8..0x09DF -- */
+    0x0807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+/* DATA_BLOCK: -- 0x09E0..0x09E7 -- */
+    0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x09E8..0x09EF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x09F0..0x09F7 -- */
+    0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x09F8..0x09FF -- */
+    0x0807, 0x0407, 0x0407, 0x0807, 0x0807, 0x0407, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0A00..0x0A07 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0807, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0A08..0x0A0F -- */
+    0x001B, 0x001B, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0A10..0x0A17 -- */
+    0x0000, 0x0000, 0x0000, 0x0007, 0x0407, 0x0007, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0A18..0x0A1F -- */
+    0x0407, 0x0000, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x0A20..0x0A27 -- */
+    0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0A28..0x0A2F -- */
+    0x0000, 0x0000, 0x0000, 0x0807, 0x0407, 0x0407, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0A30..0x0A37 -- */
+    0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0807, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0A38..0x0A3F -- */
+    0x0000, 0x0000, 0x0000, 0x0807, 0x0807, 0x0407, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0A40..0x0A47 -- */
+    0x0407, 0x0807, 0x0807, 0x0002, 0x0807, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0A48..0x0A4F -- */
+    0x0C4E, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F,
+/* DATA_BLOCK: -- 0x0A50..0x0A57 -- */
+    0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F,
+/* DATA_BLOCK: -- 0x0A58..0x0A5F -- */
+    0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0C4E, 0x0D4F, 0x0D4F, 0x0D4F,
+/* DATA_BLOCK: -- 0x0A60..0x0A67 -- */
+    0x0D4F, 0x0D4F, 0x0D4F, 0x0D4F, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0A68..0x0A6F -- */
+    0x0A17, 0x0A17, 0x0A17, 0x0A17, 0x0A17, 0x0A17, 0x0A17, 0x0000,
+/* DATA_BLOCK: -- 0x0A70..0x0A77 -- */
+    0x0000, 0x0000, 0x0000, 0x0B16, 0x0B16, 0x0B16, 0x0B16, 0x0B16,
+/* DATA_BLOCK: -- 0x0A78..0x0A7F -- */
+    0x0B16, 0x0B16, 0x0B16, 0x0B16, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0A80..0x0A87 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0407, 0x0010,
+/* DATA_BLOCK: -- 0x0A88..0x0A8F -- */
+    0x0010, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x0A90..0x0A97 -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0000,
+/* DATA_BLOCK: -- 0x0A98..0x0A9F -- */
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0000, 0x0010, 0x0000,
+/* DATA_BLOCK: -- 0x0AA0..0x0AA7 -- */
+    0x0010, 0x0010, 0x0000, 0x0010, 0x0010, 0x0000, 0x0010, 0x0010,
+/* DATA_BLOCK: -- 0x0AA8..0x0AAF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x001C,
+/* DATA_BLOCK: -- 0x0AB0..0x0AB7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x001D, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0AB8..0x0ABF -- */
+    0x0054, 0x0046, 0x0046, 0x0054, 0x0054, 0x004C, 0x004C, 0x005C,
+/* DATA_BLOCK: -- 0x0AC0..0x0AC7 -- */
+    0x0046, 0x0053, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0AC8..0x0ACF -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x005C, 0x0046, 0x005C,
+/* DATA_BLOCK: -- 0x0AD0..0x0AD7 -- */
+    0x0046, 0x005C, 0x0046, 0x005C, 0x0046, 0x005C, 0x0046, 0x005C,
+/* DATA_BLOCK: -- 0x0AD8..0x0ADF -- */
+    0x0046, 0x005C, 0x0046, 0x005C, 0x0046, 0x0052, 0x0052, 0x005C,
+/* DATA_BLOCK: -- 0x0AE0..0x0AE7 -- */
+    0x0046, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0AE8..0x0AEF -- */
+    0x0046, 0x0052, 0x0046, 0x0000, 0x005A, 0x005A, 0x004C, 0x004C,
+/* DATA_BLOCK: -- 0x0AF0..0x0AF7 -- */
+    0x0052, 0x005C, 0x0046, 0x005C, 0x0046, 0x005C, 0x0046, 0x0052,
+/* DATA_BLOCK: -- 0x0AF8..0x0AFF -- */
+    0x0052, 0x005E, 0x005D, 0x0052, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0B00..0x0B07 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0323,
+/* DATA_BLOCK: -- 0x0B08..0x0B0F -- */
+    0x0000, 0x004C, 0x0052, 0x0052, 0x005E, 0x005D, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0B10..0x0B17 -- */
+    0x005C, 0x0046, 0x0052, 0x0052, 0x0046, 0x0052, 0x0046, 0x0052,
+/* DATA_BLOCK: -- 0x0B18..0x0B1F -- */
+    0x0052, 0x0052, 0x005A, 0x005A, 0x0052, 0x0052, 0x0052, 0x004C,
+/* DATA_BLOCK: -- 0x0B20..0x0B27 -- */
+    0x0052, 0x0052, 0x0052, 0x005C, 0x0052, 0x0046, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0B28..0x0B2F -- */
+    0x0052, 0x0052, 0x0052, 0x005C, 0x0052, 0x0046, 0x0052, 0x005C,
+/* DATA_BLOCK: -- 0x0B30..0x0B37 -- */
+    0x0046, 0x0046, 0x005C, 0x0046, 0x0046, 0x005A, 0x0052, 0x005A,
+/* DATA_BLOCK: -- 0x0B38..0x0B3F -- */
+    0x005A, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0B40..0x0B47 -- */
+    0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x045A, 0x045A,
+/* DATA_BLOCK: -- 0x0B48..0x0B4F -- */
+    0x0000, 0x0000, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0B50..0x0B57 -- */
+    0x0000, 0x0000, 0x0052, 0x0052, 0x0052, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0B58..0x0B5F -- */
+    0x005D, 0x005E, 0x0052, 0x0052, 0x0052, 0x005E, 0x005E, 0x0000,
+/* DATA_BLOCK: -- 0x0B60..0x0B67 -- */
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000,
+/* DATA_BLOCK: -- 0x0B68..0x0B6F -- */
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+/* DATA_BLOCK: -- 0x0B70..0x0B77 -- */
+    0x0300, 0x0307, 0x0307, 0x0307, 0x0005, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0B78..0x0B7F -- */
+    0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0B80..0x0B87 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+/* DATA_BLOCK: -- 0x0B88..0x0B8F -- */
+    0x0000, 0x0407, 0x0407, 0x0407, 0x0000, 0x0407, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0B90..0x0B97 -- */
+    0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x0B98..0x0B9F -- */
+    0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0BA0..0x0BA7 -- */
+    0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0013, 0x0000,
+/* DATA_BLOCK: -- 0x0BA8..0x0BAF -- */
+    0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0BB0..0x0BB7 -- */
+    0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0002, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0BB8..0x0BBF -- */
+    0x0000, 0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0BC0..0x0BC7 -- */
+    0x0807, 0x0407, 0x0807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0BC8..0x0BCF -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0002,
+/* DATA_BLOCK: -- 0x0BD0..0x0BD7 -- */
+    0x0407, 0x0000, 0x0000, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0BD8..0x0BDF -- */
+    0x0807, 0x0807, 0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x0BE0..0x0BE7 -- */
+    0x0807, 0x0407, 0x0407, 0x0000, 0x0000, 0x0700, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0BE8..0x0BEF -- */
+    0x0002, 0x0002, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0BF0..0x0BF7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0700, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0BF8..0x0BFF -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0807, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0C00..0x0C07 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x001B, 0x001B,
+/* DATA_BLOCK: -- 0x0C08..0x0C0F -- */
+    0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0807, 0x0807, 0x0000,
+/* DATA_BLOCK: -- 0x0C10..0x0C17 -- */
+    0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0003, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0C18..0x0C1F -- */
+    0x0000, 0x0000, 0x0000, 0x0807, 0x0807, 0x0807, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0C20..0x0C27 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0807,
+/* DATA_BLOCK: -- 0x0C28..0x0C2F -- */
+    0x0807, 0x0000, 0x0700, 0x0700, 0x0000, 0x0002, 0x0002, 0x0000,
+/* DATA_BLOCK: -- 0x0C30..0x0C37 -- */
+    0x0002, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0C38..0x0C3F -- */
+    0x001B, 0x001B, 0x0000, 0x0003, 0x0000, 0x0002, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0C40..0x0C47 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0807, 0x0807, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0C48..0x0C4F -- */
+    0x0407, 0x0407, 0x0807, 0x0807, 0x0407, 0x0807, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0C50..0x0C57 -- */
+    0x0002, 0x0002, 0x0000, 0x0002, 0x0002, 0x0000, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0C58..0x0C5F -- */
+    0x0407, 0x0807, 0x0807, 0x0807, 0x0807, 0x0000, 0x0000, 0x0807,
+/* DATA_BLOCK: -- 0x0C60..0x0C67 -- */
+    0x0807, 0x0000, 0x0000, 0x0807, 0x0807, 0x0807, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0C68..0x0C6F -- */
+    0x0000, 0x0000, 0x0807, 0x0807, 0x0000, 0x0000, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0C70..0x0C77 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0807, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0C78..0x0C7F -- */
+    0x0807, 0x0807, 0x0407, 0x0407, 0x0407, 0x0807, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0C80..0x0C87 -- */
+    0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+/* DATA_BLOCK: -- 0x0C88..0x0C8F -- */
+    0x001B, 0x001B, 0x0002, 0x0002, 0x0000, 0x0000, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0C90..0x0C97 -- */
+    0x0407, 0x0807, 0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0C98..0x0C9F -- */
+    0x0407, 0x0807, 0x0407, 0x0807, 0x0807, 0x0407, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0CA0..0x0CA7 -- */
+    0x0407, 0x0807, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0CA8..0x0CAF -- */
+    0x0807, 0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0CB0..0x0CB7 -- */
+    0x0807, 0x0807, 0x0807, 0x0807, 0x0407, 0x0407, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0CB8..0x0CBF -- */
+    0x0407, 0x0003, 0x0002, 0x0002, 0x000C, 0x000C, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0CC0..0x0CC7 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0CC8..0x0CCF -- */
+    0x0407, 0x0407, 0x0407, 0x0807, 0x0807, 0x0407, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0CD0..0x0CD7 -- */
+    0x0407, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0CD8..0x0CDF -- */
+    0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+/* DATA_BLOCK: -- 0x0CE0..0x0CE7 -- */
+    0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0CE8..0x0CEF -- */
+    0x0000, 0x0000, 0x0000, 0x0407, 0x0807, 0x0407, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0CF0..0x0CF7 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0CF8..0x0CFF -- */
+    0x0007, 0x0007, 0x0407, 0x0407, 0x0407, 0x0407, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0D00..0x0D07 -- */
+    0x001B, 0x001B, 0x0000, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000,
+/* DATA_BLOCK: -- 0x0D08..0x0D0F -- */
+    0x0807, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0D10..0x0D17 -- */
+    0x0407, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0000, 0x0807,
+/* DATA_BLOCK: -- 0x0D18..0x0D1F -- */
+    0x0807, 0x0000, 0x0000, 0x0407, 0x0407, 0x0807, 0x0407, 0x0700,
+/* DATA_BLOCK: -- 0x0D20..0x0D27 -- */
+    0x0807, 0x0700, 0x0807, 0x0407, 0x0002, 0x0002, 0x0002, 0x0000,
+/* DATA_BLOCK: -- 0x0D28..0x0D2F -- */
+    0x0000, 0x0807, 0x0807, 0x0807, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0D30..0x0D37 -- */
+    0x0000, 0x0000, 0x0407, 0x0407, 0x0807, 0x0807, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0D38..0x0D3F -- */
+    0x0407, 0x0000, 0x0003, 0x0000, 0x0807, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0D40..0x0D47 -- */
+    0x0407, 0x0807, 0x0700, 0x0407, 0x0407, 0x0407, 0x0407, 0x0003,
+/* DATA_BLOCK: -- 0x0D48..0x0D4F -- */
+    0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x0D50..0x0D57 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0700, 0x0700, 0x0700, 0x0700,
+/* DATA_BLOCK: -- 0x0D58..0x0D5F -- */
+    0x0700, 0x0700, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0D60..0x0D67 -- */
+    0x0407, 0x0407, 0x0002, 0x0002, 0x0002, 0x0000, 0x0003, 0x0003,
+/* DATA_BLOCK: -- 0x0D68..0x0D6F -- */
+    0x0003, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0D70..0x0D77 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0807,
+/* DATA_BLOCK: -- 0x0D78..0x0D7F -- */
+    0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0D80..0x0D87 -- */
+    0x0003, 0x000C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0D88..0x0D8F -- */
+    0x0000, 0x0807, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0D90..0x0D97 -- */
+    0x0407, 0x0807, 0x0407, 0x0407, 0x0807, 0x0407, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0D98..0x0D9F -- */
+    0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0000,
+/* DATA_BLOCK: -- 0x0DA0..0x0DA7 -- */
+    0x0000, 0x0000, 0x0407, 0x0000, 0x0407, 0x0407, 0x0000, 0x0407,
+/* DATA_BLOCK: -- 0x0DA8..0x0DAF -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0700, 0x0407,
+/* DATA_BLOCK: -- 0x0DB0..0x0DB7 -- */
+    0x0000, 0x0000, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0000,
+/* DATA_BLOCK: -- 0x0DB8..0x0DBF -- */
+    0x0407, 0x0407, 0x0000, 0x0807, 0x0807, 0x0407, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0DC0..0x0DC7 -- */
+    0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0807, 0x0807, 0x0000,
+/* DATA_BLOCK: -- 0x0DC8..0x0DCF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001D, 0x001D, 0x001D,
+/* DATA_BLOCK: -- 0x0DD0..0x0DD7 -- */
+    0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0DD8..0x0DDF -- */
+    0x001C, 0x001C, 0x001C, 0x0006, 0x0006, 0x0006, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0DE0..0x0DE7 -- */
+    0x0000, 0x0000, 0x0006, 0x0000, 0x0000, 0x0000, 0x001C, 0x0006,
+/* DATA_BLOCK: -- 0x0DE8..0x0DEF -- */
+    0x001C, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0DF0..0x0DF7 -- */
+    0x0000, 0x001C, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0DF8..0x0DFF -- */
+    0x030D, 0x030D, 0x030D, 0x030D, 0x030D, 0x030D, 0x030D, 0x031C,
+/* DATA_BLOCK: -- 0x0E00..0x0E07 -- */
+    0x0306, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E08..0x0E0F -- */
+    0x001B, 0x001B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+/* DATA_BLOCK: -- 0x0E10..0x0E17 -- */
+    0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0002, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E18..0x0E1F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E20..0x0E27 -- */
+    0x0000, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807,
+/* DATA_BLOCK: -- 0x0E28..0x0E2F -- */
+    0x005A, 0x005A, 0x005A, 0x005A, 0x044D, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E30..0x0E37 -- */
+    0x0847, 0x0847, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E38..0x0E3F -- */
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+/* DATA_BLOCK: -- 0x0E40..0x0E47 -- */
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E48..0x0E4F -- */
+    0x0052, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E50..0x0E57 -- */
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0000, 0x0040, 0x0040, 0x0040,
+/* DATA_BLOCK: -- 0x0E58..0x0E5F -- */
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0000, 0x0040, 0x0040, 0x0000,
+/* DATA_BLOCK: -- 0x0E60..0x0E67 -- */
+    0x0052, 0x0052, 0x0052, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E68..0x0E6F -- */
+    0x005A, 0x005A, 0x005A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E70..0x0E77 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x005A, 0x005A, 0x005A, 0x005A,
+/* DATA_BLOCK: -- 0x0E78..0x0E7F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0407, 0x0002,
+/* DATA_BLOCK: -- 0x0E80..0x0E87 -- */
+    0x0307, 0x0307, 0x0307, 0x0307, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0E88..0x0E8F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0807, 0x0407,
+/* DATA_BLOCK: -- 0x0E90..0x0E97 -- */
+    0x0407, 0x0407, 0x0000, 0x0000, 0x0000, 0x0807, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0E98..0x0E9F -- */
+    0x0407, 0x0407, 0x0407, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307,
+/* DATA_BLOCK: -- 0x0EA0..0x0EA7 -- */
+    0x0307, 0x0307, 0x0307, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0EA8..0x0EAF -- */
+    0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0EB0..0x0EB7 -- */
+    0x0000, 0x0000, 0x0407, 0x0407, 0x0407, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0EB8..0x0EBF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x0000, 0x0002,
+/* DATA_BLOCK: -- 0x0EC0..0x0EC7 -- */
+    0x0407, 0x0000, 0x0000, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0EC8..0x0ECF -- */
+    0x0407, 0x0407, 0x0000, 0x0407, 0x0407, 0x0000, 0x0407, 0x0407,
+/* DATA_BLOCK: -- 0x0ED0..0x0ED7 -- */
+    0x001B, 0x001B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001E,
+/* DATA_BLOCK: -- 0x0ED8..0x0EDF -- */
+    0x001B, 0x001B, 0x0000, 0x0000, 0x0000, 0x0000, 0x001C, 0x001C,
+/* DATA_BLOCK: -- 0x0EE0..0x0EE7 -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1052, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0EE8..0x0EEF -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0EF0..0x0EF7 -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x0EF8..0x0EFF -- */
+    0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x0F00..0x0F07 -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1092,
+/* DATA_BLOCK: -- 0x0F08..0x0F0F -- */
+    0x1092, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0F10..0x0F17 -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1052,
+/* DATA_BLOCK: -- 0x0F18..0x0F1F -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x0F20..0x0F27 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0F28..0x0F2F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0F30..0x0F37 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x0F38..0x0F3F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x0000,
+/* DATA_BLOCK: -- 0x0F40..0x0F47 -- */
+    0x0000, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+/* DATA_BLOCK: -- 0x0F48..0x0F4F -- */
+    0x1040, 0x1040, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x0F50..0x0F57 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1012, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x0F58..0x0F5F -- */
+    0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x0620, 0x0620,
+/* DATA_BLOCK: -- 0x0F60..0x0F67 -- */
+    0x0620, 0x0620, 0x0620, 0x0620, 0x0620, 0x0620, 0x0620, 0x0620,
+/* DATA_BLOCK: -- 0x0F68..0x0F6F -- */
+    0x0052, 0x1052, 0x1052, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x0F70..0x0F77 -- */
+    0x0052, 0x0052, 0x1052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+/* DATA_BLOCK: -- 0x0F78..0x0F7F -- */
+    0x0052, 0x0052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x0F80..0x0F87 -- */
+    0x1052, 0x1052, 0x1052, 0x0052, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x0F88..0x0F8F -- */
+    0x0052, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x0F90..0x0F97 -- */
+    0x1052, 0x1052, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x0F98..0x0F9F -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x0FA0..0x0FA7 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x0FA8..0x0FAF -- */
+    0x1052, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0FB0..0x0FB7 -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1012, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x0FB8..0x0FBF -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1012, 0x1052,
+/* DATA_BLOCK: -- 0x0FC0..0x0FC7 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1012, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x0FC8..0x0FCF -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x104A, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x0FD0..0x0FD7 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1012, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0FD8..0x0FDF -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1000, 0x1000, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x0FE0..0x0FE7 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1040, 0x1040, 0x1052,
+/* DATA_BLOCK: -- 0x0FE8..0x0FEF -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1040, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x0FF0..0x0FF7 -- */
+    0x1052, 0x1052, 0x104A, 0x104A, 0x104A, 0x1052, 0x1052, 0x104A,
+/* DATA_BLOCK: -- 0x0FF8..0x0FFF -- */
+    0x1052, 0x1052, 0x104A, 0x100A, 0x100A, 0x1012, 0x1012, 0x1052,
+/* DATA_BLOCK: -- 0x1000..0x1007 -- */
+    0x1052, 0x1012, 0x1012, 0x1012, 0x1052, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x1008..0x100F -- */
+    0x1052, 0x1052, 0x1052, 0x044B, 0x044B, 0x044B, 0x044B, 0x044B,
+/* DATA_BLOCK: -- 0x1010..0x1017 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1012,
+/* DATA_BLOCK: -- 0x1018..0x101F -- */
+    0x1052, 0x1012, 0x104A, 0x104A, 0x1052, 0x1052, 0x104A, 0x104A,
+/* DATA_BLOCK: -- 0x1020..0x1027 -- */
+    0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A,
+/* DATA_BLOCK: -- 0x1028..0x102F -- */
+    0x104A, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1030..0x1037 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x104A, 0x104A,
+/* DATA_BLOCK: -- 0x1038..0x103F -- */
+    0x104A, 0x1052, 0x1052, 0x1052, 0x104A, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1040..0x1047 -- */
+    0x1052, 0x104A, 0x104A, 0x104A, 0x1052, 0x104A, 0x104A, 0x104A,
+/* DATA_BLOCK: -- 0x1048..0x104F -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x104A,
+/* DATA_BLOCK: -- 0x1050..0x1057 -- */
+    0x1052, 0x104A, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1058..0x105F -- */
+    0x1040, 0x1052, 0x1040, 0x1052, 0x1040, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1060..0x1067 -- */
+    0x1052, 0x1052, 0x104A, 0x1052, 0x1052, 0x1052, 0x1052, 0x1040,
+/* DATA_BLOCK: -- 0x1068..0x106F -- */
+    0x1052, 0x1040, 0x1040, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1070..0x1077 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1012, 0x1012, 0x1052,
+/* DATA_BLOCK: -- 0x1078..0x107F -- */
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1052,
+/* DATA_BLOCK: -- 0x1080..0x1087 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1040,
+/* DATA_BLOCK: -- 0x1088..0x108F -- */
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1090..0x1097 -- */
+    0x1052, 0x1052, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+/* DATA_BLOCK: -- 0x1098..0x109F -- */
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x10A0..0x10A7 -- */
+    0x1000, 0x1000, 0x1012, 0x1052, 0x1052, 0x1052, 0x1052, 0x1012,
+/* DATA_BLOCK: -- 0x10A8..0x10AF -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x100A, 0x100A, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x10B0..0x10B7 -- */
+    0x1012, 0x1012, 0x104A, 0x1012, 0x1012, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x10B8..0x10BF -- */
+    0x100A, 0x1012, 0x1012, 0x1012, 0x1012, 0x104A, 0x104A, 0x1012,
+/* DATA_BLOCK: -- 0x10C0..0x10C7 -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1000, 0x1000, 0x1000, 0x1000,
+/* DATA_BLOCK: -- 0x10C8..0x10CF -- */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1012, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x10D0..0x10D7 -- */
+    0x1000, 0x1000, 0x1012, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x10D8..0x10DF -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x104A, 0x104A, 0x104A,
+/* DATA_BLOCK: -- 0x10E0..0x10E7 -- */
+    0x1052, 0x1052, 0x1052, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A,
+/* DATA_BLOCK: -- 0x10E8..0x10EF -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x001F,
+/* DATA_BLOCK: -- 0x10F0..0x10F7 -- */
+    0x001F, 0x001A, 0x001A, 0x001A, 0x0000, 0x0000, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x10F8..0x10FF -- */
+    0x1052, 0x1052, 0x1052, 0x104A, 0x1052, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1100..0x1107 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x104A, 0x104A, 0x104A, 0x1052,
+/* DATA_BLOCK: -- 0x1108..0x110F -- */
+    0x104A, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x1110..0x1117 -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x104A, 0x1012, 0x1012, 0x1012,
+/* DATA_BLOCK: -- 0x1118..0x111F -- */
+    0x1052, 0x1052, 0x1052, 0x1012, 0x1012, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1120..0x1127 -- */
+    0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1128..0x112F -- */
+    0x1012, 0x1012, 0x1012, 0x1052, 0x1052, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x1130..0x1137 -- */
+    0x1012, 0x1012, 0x1012, 0x1012, 0x1052, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x1138..0x113F -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x1140..0x1147 -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x1148..0x114F -- */
+    0x1012, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x1150..0x1157 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x1158..0x115F -- */
+    0x1052, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x1160..0x1167 -- */
+    0x0000, 0x0000, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x1168..0x116F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x1170..0x1177 -- */
+    0x1012, 0x1012, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x1178..0x117F -- */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x104A, 0x1052, 0x1052, 0x104A,
+/* DATA_BLOCK: -- 0x1180..0x1187 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x104A, 0x1052,
+/* DATA_BLOCK: -- 0x1188..0x118F -- */
+    0x104A, 0x104A, 0x1052, 0x0012, 0x104A, 0x104A, 0x104A, 0x1052,
+/* DATA_BLOCK: -- 0x1190..0x1197 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x0012, 0x1052,
+/* DATA_BLOCK: -- 0x1198..0x119F -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x104A, 0x104A, 0x1052,
+/* DATA_BLOCK: -- 0x11A0..0x11A7 -- */
+    0x104A, 0x104A, 0x1052, 0x104A, 0x1052, 0x1052, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x11A8..0x11AF -- */
+    0x1052, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A,
+/* DATA_BLOCK: -- 0x11B0..0x11B7 -- */
+    0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x1052, 0x1052,
+/* DATA_BLOCK: -- 0x11B8..0x11BF -- */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x11C0..0x11C7 -- */
+    0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1052, 0x1092,
+/* DATA_BLOCK: -- 0x11C8..0x11CF -- */
+    0x1052, 0x1052, 0x1052, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x11D0..0x11D7 -- */
+    0x1052, 0x1052, 0x1052, 0x104A, 0x104A, 0x104A, 0x1092, 0x1092,
+/* DATA_BLOCK: -- 0x11D8..0x11DF -- */
+    0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x104A, 0x1092,
+/* DATA_BLOCK: -- 0x11E0..0x11E7 -- */
+    0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x1092, 0x0000, 0x0000,
+/* DATA_BLOCK: -- 0x11E8..0x11EF -- */
+    0x0300, 0x0307, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300
+};
+
+static const uint16_t MainBreakIndexes[6016] = {
+/* INDEX_BLOCK: -- 0x0000..0x003F -- */
+    0x0000, 0x0008, 0x0000, 0x0000, 0x0010, 0x0018, 0x0020, 0x0028, 0x0030, 0x0030, 0x0030, 0x0038,
+    0x0030, 0x0030, 0x0030, 0x0040, 0x0048, 0x0000, 0x0000, 0x0000, 0x0050, 0x0058, 0x0060, 0x0068,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0040..0x007F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0070, 0x0030, 0x0078, 0x0030, 0x0030, 0x0030, 0x0030, 0x0080, 0x0080, 0x0080, 0x0080,
+    0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0088, 0x0080, 0x0090, 0x0098, 0x0080, 0x0030, 0x00A0,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0080..0x00BF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x00A8, 0x00B0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x00B8, 0x00C0, 0x0080, 0x0080, 0x0080, 0x0080, 0x00C8, 0x00D0, 0x0030, 0x00D8, 0x00D8,
+    0x00D8, 0x00E0, 0x00E8, 0x0030,
+/* INDEX_BLOCK: -- 0x00C0..0x00FF -- */
+    0x00F0, 0x00F8, 0x0080, 0x0100, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x00A8, 0x0080, 0x0080,
+    0x0020, 0x0108, 0x0110, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0118, 0x0120, 0x0128, 0x0130, 0x0020, 0x0138, 0x0030, 0x0140, 0x0148, 0x0030,
+    0x0030, 0x0030, 0x0080, 0x0080, 0x0080, 0x0150, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0158, 0x0080, 0x0110, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030,
+    0x0030, 0x00A8, 0x0160, 0x0168,
+/* INDEX_BLOCK: -- 0x0100..0x013F -- */
+    0x0030, 0x0030, 0x0158, 0x0170, 0x0178, 0x0180, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0188,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0190, 0x0080, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0198, 0x0080, 0x0080, 0x01A0, 0x0080, 0x0080, 0x0080, 0x01A8, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x01B0, 0x01B8, 0x01C0, 0x00C0, 0x0030, 0x01C8, 0x0020, 0x0030, 0x0030,
+    0x01D0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x01D8, 0x01E0, 0x01E8, 0x01F0, 0x0030,
+    0x01F8, 0x0020, 0x0200, 0x0208,
+/* INDEX_BLOCK: -- 0x0140..0x017F -- */
+    0x0210, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0218, 0x0220, 0x0228, 0x0148, 0x0030,
+    0x0230, 0x0020, 0x0238, 0x0030, 0x0210, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0218,
+    0x0240, 0x0248, 0x0030, 0x0030, 0x01F8, 0x0020, 0x0250, 0x0198, 0x01D0, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0258, 0x01E0, 0x01E8, 0x0260, 0x0030, 0x01F8, 0x0020, 0x0030, 0x0030,
+    0x0268, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0270, 0x0278, 0x0280, 0x01F0, 0x0030,
+    0x0230, 0x0020, 0x0030, 0x0250,
+/* INDEX_BLOCK: -- 0x0180..0x01BF -- */
+    0x0288, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0258, 0x0290, 0x0130, 0x0298, 0x0030,
+    0x01F8, 0x0020, 0x0078, 0x0030, 0x02A0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x02A8,
+    0x02B0, 0x02B8, 0x0298, 0x0030, 0x01F8, 0x0020, 0x0030, 0x0030, 0x02C0, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x02C8, 0x02D0, 0x02D8, 0x01F0, 0x0030, 0x01F8, 0x0020, 0x0030, 0x02E0,
+    0x01D0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x02E8, 0x02F0, 0x02F8,
+    0x0230, 0x0020, 0x0300, 0x0030,
+/* INDEX_BLOCK: -- 0x01C0..0x01FF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0308, 0x0310, 0x01F0, 0x0318, 0x0020, 0x0320,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0308, 0x0328,
+    0x0030, 0x0330, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0338, 0x0340, 0x0348, 0x00B0,
+    0x0020, 0x0138, 0x0350, 0x0358, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x00C0, 0x0360,
+    0x0368, 0x0260, 0x0080, 0x00C0, 0x0080, 0x0080, 0x0080, 0x0370, 0x0378, 0x0030, 0x0380, 0x0388,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0200..0x023F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0390, 0x0398, 0x03A0, 0x0020, 0x0320, 0x03A8, 0x03B0,
+    0x03B8, 0x03C0, 0x03C8, 0x0030, 0x03D0, 0x03D8, 0x0020, 0x03E0, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x03E8, 0x03E8, 0x03E8, 0x03E8,
+    0x03E8, 0x03E8, 0x03E8, 0x03E8, 0x03E8, 0x03E8, 0x03E8, 0x03E8, 0x03F0, 0x03F0, 0x03F0, 0x03F0,
+    0x03F0, 0x03F0, 0x03F0, 0x03F0, 0x03F0, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8,
+    0x03F8, 0x03F8, 0x03F8, 0x03F8,
+/* INDEX_BLOCK: -- 0x0240..0x027F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0260, 0x0400, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0280..0x02BF -- */
+    0x0408, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x02C0..0x02FF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0408, 0x0030, 0x0030, 0x0410, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0418, 0x0030, 0x0030, 0x0030, 0x0030, 0x0420, 0x0030,
+    0x0030, 0x0030, 0x0428, 0x0030, 0x0030, 0x0030, 0x0430, 0x0030, 0x0030, 0x0030, 0x0430, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0438, 0x0440, 0x0448, 0x01B8, 0x0450, 0x0458,
+    0x0020, 0x0138, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0300..0x033F -- */
+    0x0460, 0x0468, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0298, 0x0030, 0x0030, 0x0030, 0x0030, 0x0148, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0470, 0x0478, 0x0480, 0x0488, 0x0490, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0020, 0x0138,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0340..0x037F -- */
+    0x0030, 0x0030, 0x01F0, 0x0498, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x04A0, 0x0318,
+    0x04A8, 0x04B0, 0x04B8, 0x0128, 0x0020, 0x0138, 0x0020, 0x0138, 0x0030, 0x0030, 0x0080, 0x0080,
+    0x0080, 0x0318, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x04C0, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x04C8, 0x04D0, 0x04D8, 0x0030, 0x0020, 0x04E0, 0x0408, 0x00A8, 0x0160, 0x04E8,
+    0x04F0, 0x0030, 0x0030, 0x0030, 0x04F8, 0x0500, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0270, 0x0508, 0x02C0, 0x0030,
+/* INDEX_BLOCK: -- 0x0380..0x03BF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0510, 0x0518, 0x0520, 0x0528, 0x0020, 0x0138, 0x0020, 0x0138,
+    0x0030, 0x0030, 0x0030, 0x0530, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0538, 0x0080, 0x0398, 0x0540, 0x0548, 0x00B0, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0080, 0x0080, 0x0080, 0x0080,
+    0x0080, 0x0080, 0x0080, 0x0080,
+/* INDEX_BLOCK: -- 0x03C0..0x03FF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0550,
+/* INDEX_BLOCK: -- 0x0400..0x043F -- */
+    0x0558, 0x0560, 0x0568, 0x0570, 0x0578, 0x0580, 0x0588, 0x0590, 0x0598, 0x05A0, 0x05A8, 0x05B0,
+    0x05B8, 0x0000, 0x0030, 0x05C0, 0x0030, 0x05C0, 0x0030, 0x0030, 0x05C8, 0x05D0, 0x05D8, 0x05E0,
+    0x05E8, 0x05F0, 0x0080, 0x0080, 0x0080, 0x0080, 0x0110, 0x0030, 0x05F8, 0x02E0, 0x0600, 0x0030,
+    0x0608, 0x0030, 0x0030, 0x0610, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0618, 0x0620, 0x0030, 0x0628, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0440..0x047F -- */
+    0x0030, 0x0030, 0x0630, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0638, 0x0030, 0x0030, 0x0030, 0x0640, 0x0030, 0x0648,
+    0x0030, 0x0650, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0658, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0660, 0x0030, 0x0030,
+    0x0030, 0x0668, 0x0670, 0x0678,
+/* INDEX_BLOCK: -- 0x0480..0x04BF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0608, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0680, 0x0688, 0x0030, 0x0658, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0690,
+/* INDEX_BLOCK: -- 0x04C0..0x04FF -- */
+    0x0698, 0x06A0, 0x06A8, 0x06B0, 0x06A0, 0x06A0, 0x06A0, 0x06B8, 0x06A0, 0x06C0, 0x06C8, 0x06A0,
+    0x06A0, 0x06D0, 0x06A0, 0x06D8, 0x06E0, 0x0030, 0x06E8, 0x06A0, 0x06F0, 0x06F8, 0x06A0, 0x0700,
+    0x0708, 0x0710, 0x0718, 0x0720, 0x0728, 0x0730, 0x0738, 0x0740, 0x0748, 0x0750, 0x0758, 0x0760,
+    0x0610, 0x0768, 0x0770, 0x0030, 0x0778, 0x0780, 0x0788, 0x0790, 0x0798, 0x07A0, 0x07A8, 0x0030,
+    0x0030, 0x0030, 0x07B0, 0x0030, 0x0610, 0x0030, 0x0768, 0x07B8, 0x05C0, 0x0030, 0x0030, 0x0030,
+    0x07C0, 0x07A0, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0500..0x053F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x07C8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x07D0, 0x07D8, 0x07D8, 0x07E0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0640,
+    0x0030, 0x0030, 0x0030, 0x07E8,
+/* INDEX_BLOCK: -- 0x0540..0x057F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x07F0, 0x0030, 0x0030, 0x07F8,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0800, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0580..0x05BF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x01F0, 0x00B0, 0x0808, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0408, 0x01F0,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0080, 0x0080, 0x0080, 0x0080,
+/* INDEX_BLOCK: -- 0x05C0..0x05FF -- */
+    0x0810, 0x0818, 0x0820, 0x0828, 0x0830, 0x0838, 0x0840, 0x0848, 0x0850, 0x0858, 0x0860, 0x0868,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0870, 0x0870, 0x0870, 0x0878, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0880, 0x0030, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0888, 0x0030,
+    0x0030, 0x0030, 0x0870, 0x0880,
+/* INDEX_BLOCK: -- 0x0600..0x063F -- */
+    0x0890, 0x0898, 0x08A0, 0x08A8, 0x0870, 0x08B0, 0x08B8, 0x08C0, 0x08C8, 0x08D0, 0x0870, 0x0870,
+    0x08D8, 0x0870, 0x0870, 0x0870, 0x08E0, 0x08E8, 0x08F0, 0x08F8, 0x0900, 0x08D0, 0x0870, 0x0870,
+    0x08D8, 0x0870, 0x0870, 0x0870, 0x08E0, 0x08E8, 0x0908, 0x0910, 0x0918, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0920, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0928, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0880, 0x0030, 0x0930, 0x0930,
+/* INDEX_BLOCK: -- 0x0640..0x067F -- */
+    0x0870, 0x0870, 0x0870, 0x0928, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0030, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0938, 0x0940, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870,
+/* INDEX_BLOCK: -- 0x0680..0x06BF -- */
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870,
+/* INDEX_BLOCK: -- 0x06C0..0x06FF -- */
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0700..0x073F -- */
+    0x0870, 0x0870, 0x0948, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870,
+/* INDEX_BLOCK: -- 0x0740..0x077F -- */
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0950, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0928, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0530, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0780..0x07BF -- */
+    0x0030, 0x0958, 0x0030, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x01F0, 0x0538, 0x0330, 0x0030, 0x0030, 0x0030, 0x0158, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0960, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x07C0..0x07FF -- */
+    0x0968, 0x0970, 0x0030, 0x0030, 0x0978, 0x0980, 0x0030, 0x0988, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0990, 0x0030, 0x0998, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0510, 0x09A0,
+    0x09A8, 0x0530, 0x0020, 0x0138, 0x0080, 0x0080, 0x00B0, 0x09B0, 0x0020, 0x0138, 0x0030, 0x0030,
+    0x0158, 0x09B8, 0x0030, 0x0030, 0x01F0, 0x0080, 0x02C0, 0x0030, 0x03E8, 0x03E8, 0x03E8, 0x09C0,
+    0x01A8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x09C8, 0x09D0, 0x09D8, 0x09E0, 0x0020, 0x0138,
+    0x09E8, 0x0030, 0x0020, 0x0138,
+/* INDEX_BLOCK: -- 0x0800..0x083F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x09F0, 0x09F8, 0x0030, 0x0970, 0x0A00, 0x0020, 0x0A08,
+    0x0030, 0x0030, 0x0030, 0x0A10, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0A18, 0x0A20,
+    0x0148, 0x0030, 0x0030, 0x0030, 0x0030, 0x0A28, 0x0A30, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0A38, 0x0A40, 0x0020, 0x0138,
+/* INDEX_BLOCK: -- 0x0840..0x087F -- */
+    0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50,
+    0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50,
+    0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48,
+    0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50,
+    0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58,
+    0x0A50, 0x0A50, 0x0A50, 0x0A48,
+/* INDEX_BLOCK: -- 0x0880..0x08BF -- */
+    0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50,
+    0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58,
+    0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50,
+    0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50,
+    0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50,
+    0x0A50, 0x0A50, 0x0A48, 0x0A50,
+/* INDEX_BLOCK: -- 0x08C0..0x08FF -- */
+    0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50,
+    0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50,
+    0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50,
+    0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48,
+    0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50,
+    0x0A50, 0x0A48, 0x0A50, 0x0A50,
+/* INDEX_BLOCK: -- 0x0900..0x093F -- */
+    0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48,
+    0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50,
+    0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58,
+    0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50,
+    0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50,
+    0x0A48, 0x0A50, 0x0A50, 0x0A58,
+/* INDEX_BLOCK: -- 0x0940..0x097F -- */
+    0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50,
+    0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50,
+    0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50,
+    0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50,
+    0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48,
+    0x0A50, 0x0A50, 0x0A58, 0x0A50,
+/* INDEX_BLOCK: -- 0x0980..0x09BF -- */
+    0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50,
+    0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48,
+    0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50,
+    0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58,
+    0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50,
+    0x0A50, 0x0A58, 0x0A50, 0x0A50,
+/* INDEX_BLOCK: -- 0x09C0..0x09FF -- */
+    0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58,
+    0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50,
+    0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50,
+    0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50,
+    0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50,
+    0x0A58, 0x0A50, 0x0A50, 0x0A50,
+/* INDEX_BLOCK: -- 0x0A00..0x0A3F -- */
+    0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50,
+    0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50,
+    0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48,
+    0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50, 0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A58, 0x0A50, 0x0A50,
+    0x0A50, 0x0A48, 0x0A50, 0x0A50, 0x0A60, 0x0030, 0x03F0, 0x03F0, 0x0A68, 0x0A70, 0x03F8, 0x03F8,
+    0x03F8, 0x03F8, 0x03F8, 0x0A78,
+/* INDEX_BLOCK: -- 0x0A40..0x0A7F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0A80..0x0ABF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870,
+/* INDEX_BLOCK: -- 0x0AC0..0x0AFF -- */
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0030, 0x0030, 0x0030, 0x0A80,
+    0x00D8, 0x0A88, 0x0A90, 0x0A98, 0x0AA0, 0x00D8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0B00..0x0B3F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0AA8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0AB0,
+/* INDEX_BLOCK: -- 0x0B40..0x0B7F -- */
+    0x0080, 0x0080, 0x0AB8, 0x0AC0, 0x0080, 0x0080, 0x0AC8, 0x0AD0, 0x0AD8, 0x0AE0, 0x0AE8, 0x0AF0,
+    0x0928, 0x0AF8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0B00, 0x0B08, 0x0B10, 0x0870, 0x0B18,
+    0x0870, 0x0870, 0x0870, 0x0B20, 0x0870, 0x0870, 0x0870, 0x0B28, 0x0B30, 0x0930, 0x0B38, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0B40, 0x0870, 0x0870, 0x0870, 0x0928, 0x0B48, 0x0B48, 0x0B48, 0x0B50,
+    0x0B58, 0x0B60, 0x0B68, 0x0B70,
+/* INDEX_BLOCK: -- 0x0B80..0x0BBF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0B78, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x09E8,
+/* INDEX_BLOCK: -- 0x0BC0..0x0BFF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0110, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0158, 0x0150,
+    0x0030, 0x0030, 0x0030, 0x0B80, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0408, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0C00..0x0C3F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0C40..0x0C7F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0B80, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0B80,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0C80..0x0CBF -- */
+    0x0B88, 0x04C8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0B90, 0x0030, 0x0030, 0x0B98, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0298, 0x0030, 0x0BA0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0BA8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0CC0..0x0CFF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x04C8, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0D00..0x0D3F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0BB0, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0158, 0x0080, 0x0110, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0BB8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0D40..0x0D7F -- */
+    0x0BC0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0080, 0x0BC8, 0x0408, 0x0030, 0x0030,
+    0x0230, 0x0020, 0x0BD0, 0x01F0, 0x04F0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0BD8, 0x0BE0,
+    0x0BE8, 0x0BF0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0020, 0x0138, 0x0150, 0x0030, 0x0030, 0x0030,
+    0x01F0, 0x0BF8, 0x0C00, 0x0020, 0x0C08, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0C10, 0x0030,
+    0x04F0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0C18, 0x0C20, 0x0C28, 0x0C30, 0x0020, 0x0C38,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0D80..0x0DBF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0C40, 0x0C48, 0x0C50, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0400, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x01F0, 0x04B8, 0x0150, 0x0020, 0x0138, 0x02C0, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x02C8, 0x0C58, 0x0C60, 0x01F0, 0x0030, 0x0C68, 0x0328, 0x0328, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0DC0..0x0DFF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0C70, 0x0080, 0x0C78, 0x0C80, 0x0020, 0x0C88,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0C90, 0x0C98,
+    0x0CA0, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x01F0, 0x0CA8, 0x0CB0, 0x0CB8, 0x0BA8, 0x0B98, 0x0CC0,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0E00..0x0E3F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x04B8, 0x0CC8, 0x0CD0, 0x0030, 0x0020, 0x0138,
+    0x0CD8, 0x0CE0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0CE8, 0x0CF0, 0x0030,
+    0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0260,
+    0x0CF8, 0x0160, 0x0020, 0x0D00, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0E40..0x0E7F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0C40, 0x0080, 0x0D08, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0D10, 0x0D18, 0x0D20, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0D28, 0x0D30,
+    0x0D38, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0E80..0x0EBF -- */
+    0x00C0, 0x0150, 0x0030, 0x0030, 0x0030, 0x0030, 0x00A8, 0x0D40, 0x0D48, 0x0030, 0x09F0, 0x0488,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0D50, 0x0D58, 0x0C20, 0x0D60, 0x0D68, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0EC0..0x0EFF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0D70, 0x0318, 0x0CF0, 0x0D78, 0x0030, 0x0020, 0x0138,
+    0x0030, 0x0030, 0x0D80, 0x0030, 0x0030, 0x0030, 0x0198, 0x0080, 0x0080, 0x0D88, 0x0D90, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0D98, 0x0DA0, 0x0DA8, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0DB0, 0x0DB8, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0F00..0x0F3F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0DC0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0DC8,
+    0x0988, 0x0030, 0x0030, 0x0B80,
+/* INDEX_BLOCK: -- 0x0F40..0x0F7F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0DD0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0F80..0x0FBF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0DD8,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0DE0, 0x0DE8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0DF0,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x0FC0..0x0FFF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0DF8, 0x0E00, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1000..0x103F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x07C0, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1040..0x107F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0020, 0x0E08, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0E10, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0BC8, 0x09E0, 0x0E18, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1080..0x10BF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0B80, 0x0408, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x01F0, 0x0E20, 0x09A0, 0x09A0, 0x09A0, 0x09A0, 0x09A0,
+    0x09A0, 0x01F0, 0x0150, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0E28, 0x0030, 0x0E30, 0x0030,
+/* INDEX_BLOCK: -- 0x10C0..0x10FF -- */
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0030,
+/* INDEX_BLOCK: -- 0x1100..0x113F -- */
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0E38, 0x0E38, 0x0E38, 0x0E38,
+    0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38,
+    0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38,
+    0x0E38, 0x0E38, 0x0E38, 0x0E38,
+/* INDEX_BLOCK: -- 0x1140..0x117F -- */
+    0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38,
+    0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38, 0x0E38,
+    0x0E38, 0x0E38, 0x0E40, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0870, 0x0E48, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1180..0x11BF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0E50, 0x0E58,
+/* INDEX_BLOCK: -- 0x11C0..0x11FF -- */
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0E60, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0E68, 0x0030, 0x0E70, 0x0030, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870,
+/* INDEX_BLOCK: -- 0x1200..0x123F -- */
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0880, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1240..0x127F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0E78, 0x0E80, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1280..0x12BF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0080, 0x0080, 0x0080, 0x0080,
+    0x0080, 0x0330, 0x0080, 0x0080, 0x0318, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x12C0..0x12FF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0E88, 0x0E90, 0x0E98, 0x0EA0,
+    0x0EA8, 0x0160, 0x0030, 0x0030, 0x0030, 0x0BB8, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1300..0x133F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0EB0, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1340..0x137F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0230, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020,
+/* INDEX_BLOCK: -- 0x1380..0x13BF -- */
+    0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0318, 0x00A8, 0x0080, 0x0080, 0x0080, 0x0080,
+    0x0080, 0x0328, 0x09E8, 0x0030, 0x0EB8, 0x0B78, 0x0030, 0x00A8, 0x00C0, 0x0080, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x13C0..0x13FF -- */
+    0x0318, 0x0080, 0x0080, 0x0EC0, 0x0EC8, 0x0150, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0318, 0x0030, 0x0020, 0x0138, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1400..0x143F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0378, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x04C8, 0x0020, 0x0ED0, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1440..0x147F -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0318, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x04C8, 0x0150, 0x0020, 0x0ED8, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x1480..0x14BF -- */
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0AB0, 0x0988, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030,
+/* INDEX_BLOCK: -- 0x14C0..0x14FF -- */
+    0x0EE0, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EF0, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EE8,
+    0x0EE8, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EF0, 0x0EF8, 0x0EE8, 0x0F00, 0x0F08, 0x0EE8,
+    0x0F08, 0x0F10, 0x0F08, 0x0EE8, 0x0EE8, 0x0EE8, 0x0F18, 0x0EF8, 0x0030, 0x0F20, 0x0030, 0x0030,
+    0x0030, 0x0660, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0F28, 0x0620, 0x0F30,
+    0x0030, 0x0F38, 0x0F40, 0x0F48, 0x0030, 0x0F50, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0F58, 0x0F60, 0x0F60, 0x0F60,
+/* INDEX_BLOCK: -- 0x1500..0x153F -- */
+    0x0F68, 0x0EF8, 0x0870, 0x0F70, 0x0870, 0x0938, 0x0F78, 0x0F80, 0x0870, 0x0F88, 0x0F90, 0x0EF8,
+    0x0F98, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0,
+    0x0FA8, 0x0FB0, 0x0FB8, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FC0,
+    0x0FC8, 0x0FA0, 0x0FD0, 0x0FD8, 0x0FA0, 0x0FA0, 0x0FE0, 0x0FE8, 0x0FF0, 0x0FF8, 0x0FD0, 0x0EE8,
+    0x0FA0, 0x0FA0, 0x1000, 0x1008,
+/* INDEX_BLOCK: -- 0x1540..0x157F -- */
+    0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x1010, 0x1018, 0x1020, 0x1028, 0x0FA0,
+    0x1030, 0x1020, 0x1020, 0x1038, 0x1040, 0x1048, 0x1050, 0x0FA0, 0x1058, 0x1060, 0x1068, 0x0FA0,
+    0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x1070, 0x1078, 0x0FA0, 0x1080, 0x06C0,
+    0x1088, 0x0FA0, 0x1090, 0x1098, 0x0F30, 0x10A0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0EE8, 0x10A8, 0x10B0,
+    0x0EE8, 0x0EE8, 0x10B8, 0x0EE8, 0x0EE0, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EE8, 0x0EE8, 0x10C0, 0x10C8,
+    0x0EE8, 0x0EE8, 0x10C0, 0x10D0,
+/* INDEX_BLOCK: -- 0x1580..0x15BF -- */
+    0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x10D8, 0x10E0, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x10E8, 0x10F0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x10F8, 0x0FA0, 0x1100, 0x0FA0,
+    0x1108, 0x1110, 0x1118, 0x1120, 0x0EE8, 0x1128, 0x1130, 0x1138, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x1140, 0x0EF8,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0F20, 0x1148,
+    0x0FA0, 0x1150, 0x1158, 0x0EF8,
+/* INDEX_BLOCK: -- 0x15C0..0x15FF -- */
+    0x0030, 0x1140, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0EF8, 0x0030, 0x1160,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0EF8, 0x0030, 0x0030, 0x0030, 0x1168, 0x1170, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0030, 0x1178, 0x0FA0, 0x1020,
+    0x1180, 0x0FA0, 0x1020, 0x1188, 0x1190, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x1048, 0x0FA0,
+    0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0, 0x1198, 0x11A0, 0x0FA0, 0x10D8, 0x11A8, 0x11B0,
+    0x0FA0, 0x0FA0, 0x0FA0, 0x0FA0,
+/* INDEX_BLOCK: -- 0x1600..0x163F -- */
+    0x06A0, 0x06A0, 0x06A0, 0x06A0, 0x06A0, 0x06A0, 0x06A0, 0x06A0, 0x06A0, 0x06A0, 0x11B8, 0x0EF8,
+    0x0EE8, 0x0F18, 0x1138, 0x1138, 0x11C0, 0x0EF8, 0x0FA0, 0x0FA0, 0x0FA0, 0x1138, 0x0FA0, 0x11C8,
+    0x11D0, 0x0EF8, 0x0FA0, 0x0F90, 0x0FA0, 0x0EF8, 0x11D8, 0x0EF8, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0020, 0x0138,
+/* INDEX_BLOCK: -- 0x1640..0x167F -- */
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+/* INDEX_BLOCK: -- 0x1680..0x16BF -- */
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8, 0x0EF8,
+    0x0EF8, 0x0EF8, 0x0EF8, 0x11E0,
+/* INDEX_BLOCK: -- 0x16C0..0x16FF -- */
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870, 0x0870,
+    0x0870, 0x0870, 0x0870, 0x0888,
+/* INDEX_BLOCK: -- 0x1700..0x173F -- */
+    0x11E8, 0x0B68, 0x0B68, 0x0B68, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+    0x0080, 0x0080, 0x0080, 0x0080, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68,
+    0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0080, 0x0080, 0x0080, 0x0080,
+    0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+    0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+    0x0080, 0x0080, 0x0B68, 0x0B68,
+/* INDEX_BLOCK: -- 0x1740..0x177F -- */
+    0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68,
+    0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68,
+    0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68,
+    0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68,
+    0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68, 0x0B68,
+    0x0B68, 0x0B68, 0x0B68, 0x0B68
+};
+
+static const uint16_t BranchBreakIndexes[1800] = {
+    0x0000, 0x0040, 0x0080, 0x00C0, 0x0100, 0x0140, 0x0180, 0x01C0, 0x0200, 0x0240, 0x0280, 0x02C0,
+    0x0300, 0x0340, 0x0380, 0x03C0, 0x0400, 0x0440, 0x0480, 0x04C0, 0x0500, 0x0540, 0x0580, 0x05C0,
+    0x0600, 0x0640, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x06C0, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0700, 0x0680, 0x0740, 0x0780,
+    0x07C0, 0x0800, 0x0840, 0x0880, 0x08C0, 0x0900, 0x0940, 0x0980, 0x09C0, 0x0840, 0x0880, 0x08C0,
+    0x0900, 0x0940, 0x0980, 0x09C0, 0x0840, 0x0880, 0x08C0, 0x0900, 0x0940, 0x0980, 0x09C0, 0x0A00,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A80, 0x0AC0, 0x0B00, 0x0B40, 0x0B80, 0x0BC0, 0x0C00, 0x0A40,
+    0x0C40, 0x0C80, 0x0CC0, 0x0D00, 0x0D40, 0x0D80, 0x0DC0, 0x0E00, 0x0E40, 0x0E80, 0x0EC0, 0x0F00,
+    0x0A40, 0x0A40, 0x0F40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0F80, 0x0FC0, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x1000, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x1040, 0x0A40, 0x1080, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x10C0, 0x0680, 0x1100, 0x1140, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x1180,
+    0x11C0, 0x1200, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x1240, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x1280, 0x12C0, 0x1300, 0x0A40, 0x1340, 0x0A40, 0x1380, 0x0A40, 0x0A40,
+    0x13C0, 0x1400, 0x0A40, 0x0A40, 0x1440, 0x0A40, 0x1480, 0x0A40, 0x14C0, 0x1500, 0x1540, 0x1580,
+    0x15C0, 0x1600, 0x1640, 0x1680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x16C0,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680,
+    0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x0680, 0x16C0, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x0A40,
+    0x0A40, 0x0A40, 0x0A40, 0x0A40, 0x1700, 0x1740, 0x1740, 0x1740, 0x1740, 0x1740, 0x1740, 0x1740
+};
+
+uint16_t Tehreer::lookupBreakProperties(uint32_t codePoint)
+{
+    if (codePoint <= 0xE0FFF) {
+        return PrimaryBreakData[
+                MainBreakIndexes[
+                 BranchBreakIndexes[
+                      codePoint / 0x0200
+                 ] + (codePoint % 0x0200) / 0x0008
+                ] + (codePoint % 0x0008)
+               ];
+    }
+
+    return 0;
+}
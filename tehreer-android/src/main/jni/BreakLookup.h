@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _TEHREER__BREAK_LOOKUP_H
+#define _TEHREER__BREAK_LOOKUP_H
+
+#include <cstdint>
+
+namespace Tehreer {
+
+namespace LineBreak {
+
+/* Line break classes of UAX #14 after applying the resolution of rule LB1. */
+enum Class : uint8_t {
+    AL = 0, B2 = 1, BA = 2, BB = 3, BK = 4, CB = 5, CL = 6, CM = 7,
+    CP = 8, CR = 9, EB = 10, EM = 11, EX = 12, GL = 13, H2 = 14, H3 = 15,
+    HL = 16, HY = 17, ID = 18, IN = 19, IS = 20, JL = 21, JT = 22, JV = 23,
+    LF = 24, NL = 25, NS = 26, NU = 27, OP = 28, PO = 29, PR = 30, QU = 31,
+    RI = 32, SP = 33, SY = 34, WJ = 35, ZW = 36, ZWJ = 37,
+};
+
+enum Flag : uint8_t {
+    CLASS_MASK = 0x3F,
+    EAST_ASIAN = 1 << 6,                /* East_Asian_Width is F, W or H. */
+    UNASSIGNED_PICTOGRAPHIC = 1 << 7,   /* Extended_Pictographic with General_Category Cn. */
+};
+
+}
+
+namespace GraphemeBreak {
+
+/* Grapheme cluster break classes of UAX #29. */
+enum Class : uint8_t {
+    XX = 0, CR = 1, LF = 2, CN = 3, EX = 4, ZWJ = 5, RI = 6,
+    PP = 7, SM = 8, L = 9, V = 10, T = 11, LV = 12, LVT = 13,
+};
+
+enum Flag : uint8_t {
+    CLASS_MASK = 0x0F,
+    EXTENDED_PICTOGRAPHIC = 1 << 4,
+};
+
+}
+
+/*
+ * Returns the break properties of a code point with line break byte in the low eight bits and
+ * grapheme break byte in the high eight bits.
+ */
+uint16_t lookupBreakProperties(uint32_t codePoint);
+
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <jni.h>
+
+#include "BufferTable.h"
+#include "JavaBridge.h"
+#include "Typeface.h"
+
+using namespace Tehreer;
+
+static jobject getTableBuffer(JNIEnv *env, jobject obj, jobject jtypeface, jint tableTag)
+{
+    jlong typefaceHandle = JavaBridge(env).Typeface_getNativeTypeface(jtypeface);
+    if (!typefaceHandle) {
+        return nullptr;
+    }
+
+    auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
+    auto inputTag = static_cast<uint32_t>(tableTag);
+
+    size_t tableLength = 0;
+    const FT_Byte *tableBuffer = typeface->getTableBuffer(inputTag, tableLength);
+    if (!tableBuffer) {
+        return nullptr;
+    }
+
+    /* The buffer is owned by the typeface, which the Java table keeps reachable. */
+    void *address = const_cast<FT_Byte *>(tableBuffer);
+    auto capacity = static_cast<jlong>(tableLength);
+
+    return env->NewDirectByteBuffer(address, capacity);
+}
+
+static JNINativeMethod JNI_METHODS[] = {
+    { "getTableBuffer", "(Lcom/mta/tehreer/graphics/Typeface;I)Ljava/nio/ByteBuffer;", (void *)getTableBuffer },
+};
+
+jint register_com_mta_tehreer_internal_sfnt_BufferTable(JNIEnv *env)
+{
+    return JavaBridge::registerClass(env, "com/mta/tehreer/internal/sfnt/BufferTable", JNI_METHODS, sizeof(JNI_METHODS) / sizeof(JNI_METHODS[0]));
+}
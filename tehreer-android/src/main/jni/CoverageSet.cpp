@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include <ft2build.h>
+#include FT_FREETYPE_H
+}
+
+#include <cstdint>
+#include <vector>
+
+#include "CoverageSet.h"
+
+using namespace std;
+using namespace Tehreer;
+
+CoverageSet::CoverageSet(FT_Face ftFace)
+    : m_pageIndexes()
+    , m_pageWords(WordsPerPage, 0)
+{
+    FT_UInt glyphID;
+    FT_ULong codePoint = FT_Get_First_Char(ftFace, &glyphID);
+
+    while (glyphID != 0 && codePoint <= MaxCodePoint) {
+        auto page = static_cast<uint32_t>(codePoint >> PageShift);
+        if (page >= m_pageIndexes.size()) {
+            m_pageIndexes.resize(page + 1, 0);
+        }
+
+        uint16_t pageIndex = m_pageIndexes[page];
+        if (pageIndex == 0) {
+            pageIndex = static_cast<uint16_t>(m_pageWords.size() / WordsPerPage);
+            m_pageIndexes[page] = pageIndex;
+            m_pageWords.resize(m_pageWords.size() + WordsPerPage, 0);
+        }
+
+        uint32_t bit = codePoint & PageMask;
+        m_pageWords[pageIndex * WordsPerPage + (bit >> 5)] |= 1U << (bit & 31);
+
+        codePoint = FT_Get_Next_Char(ftFace, codePoint, &glyphID);
+    }
+
+    m_pageIndexes.shrink_to_fit();
+    m_pageWords.shrink_to_fit();
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _TEHREER__COVERAGE_SET_H
+#define _TEHREER__COVERAGE_SET_H
+
+extern "C" {
+#include <ft2build.h>
+#include FT_FREETYPE_H
+}
+
+#include <cstdint>
+#include <vector>
+
+namespace Tehreer {
+
+/*
+ * A compact set of the code points mapped by the character map of a face. The code points are
+ * grouped in pages of 256 bits and only the pages having at least one code point are stored.
+ */
+class CoverageSet {
+public:
+    CoverageSet(FT_Face ftFace);
+
+    inline bool contains(uint32_t codePoint) const {
+        uint32_t page = codePoint >> PageShift;
+        if (page >= m_pageIndexes.size()) {
+            return false;
+        }
+
+        uint32_t bit = codePoint & PageMask;
+        const uint32_t *words = &m_pageWords[m_pageIndexes[page] * WordsPerPage];
+
+        return words[bit >> 5] & (1U << (bit & 31));
+    }
+
+private:
+    static const uint32_t MaxCodePoint = 0x10FFFF;
+    static const uint32_t PageShift = 8;
+    static const uint32_t PageMask = (1U << PageShift) - 1;
+    static const uint32_t WordsPerPage = (1U << PageShift) / 32;
+
+    /* The location of each page in words, where zero refers to an empty page. */
+    std::vector<uint16_t> m_pageIndexes;
+    std::vector<uint32_t> m_pageWords;
+};
+
+}
+
+#endif
@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <jni.h>
+#include <vector>
+
+#include "BreakLookup.h"
+#include "CoverageSet.h"
+#include "FontFallback.h"
+#include "JavaBridge.h"
+#include "Typeface.h"
+
+using namespace std;
+using namespace Tehreer;
+
+static inline bool isVariationSelector(uint32_t codePoint)
+{
+    return (codePoint >= 0xFE00 && codePoint <= 0xFE0F)
+        || (codePoint >= 0xE0100 && codePoint <= 0xE01EF)
+        || (codePoint >= 0x180B && codePoint <= 0x180D);
+}
+
+static inline bool isIgnorable(uint32_t codePoint)
+{
+    return codePoint == 0x034F || codePoint == 0x200C || codePoint == 0x200D
+        || isVariationSelector(codePoint);
+}
+
+static inline uint8_t graphemeProperties(uint32_t codePoint)
+{
+    return lookupBreakProperties(codePoint) >> 8;
+}
+
+static uint32_t nextCodePoint(const jchar *charArray, jint charCount, jint &index)
+{
+    uint32_t codePoint = charArray[index++];
+
+    if (codePoint >= 0xD800 && codePoint <= 0xDBFF && index < charCount) {
+        uint32_t low = charArray[index];
+
+        if (low >= 0xDC00 && low <= 0xDFFF) {
+            codePoint = ((codePoint - 0xD800) << 10) + (low - 0xDC00) + 0x10000;
+            index++;
+        }
+    }
+
+    return codePoint;
+}
+
+/* Tells whether the two adjacent code points belong to the same grapheme cluster. */
+static bool isClusterContinued(uint8_t prevProps, uint8_t currProps, bool &regionalPair, bool pictographic)
+{
+    auto prevClass = prevProps & GraphemeBreak::CLASS_MASK;
+    auto currClass = currProps & GraphemeBreak::CLASS_MASK;
+
+    switch (currClass) {
+    case GraphemeBreak::EX:
+    case GraphemeBreak::ZWJ:
+    case GraphemeBreak::SM:
+        return prevClass != GraphemeBreak::CR && prevClass != GraphemeBreak::LF
+            && prevClass != GraphemeBreak::CN;
+    }
+
+    switch (prevClass) {
+    case GraphemeBreak::CR:
+        return currClass == GraphemeBreak::LF;
+    case GraphemeBreak::PP:
+        return currClass != GraphemeBreak::CR && currClass != GraphemeBreak::LF
+            && currClass != GraphemeBreak::CN;
+    case GraphemeBreak::L:
+        return currClass == GraphemeBreak::L || currClass == GraphemeBreak::V
+            || currClass == GraphemeBreak::LV || currClass == GraphemeBreak::LVT;
+    case GraphemeBreak::LV:
+    case GraphemeBreak::V:
+        return currClass == GraphemeBreak::V || currClass == GraphemeBreak::T;
+    case GraphemeBreak::LVT:
+    case GraphemeBreak::T:
+        return currClass == GraphemeBreak::T;
+    case GraphemeBreak::ZWJ:
+        return pictographic && (currProps & GraphemeBreak::EXTENDED_PICTOGRAPHIC);
+    case GraphemeBreak::RI:
+        if (currClass == GraphemeBreak::RI && !regionalPair) {
+            regionalPair = true;
+            return true;
+        }
+        return false;
+    }
+
+    return false;
+}
+
+FontFallback::FontFallback(const CoverageSet *const *coverages, size_t count)
+    : m_coverages(coverages)
+    , m_count(count)
+{
+}
+
+bool FontFallback::covers(size_t index, const uint32_t *codePoints, size_t count, bool strict) const
+{
+    const CoverageSet &coverage = *m_coverages[index];
+
+    for (size_t i = 0; i < count; i++) {
+        uint32_t codePoint = codePoints[i];
+
+        if (!coverage.contains(codePoint) && (strict || !isIgnorable(codePoint))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+size_t FontFallback::select(const uint32_t *codePoints, size_t count, size_t current) const
+{
+    /*
+     * Prefer the primary typeface, then the one selected for previous cluster so that common
+     * characters do not break a fallback run, and then the rest in order. A typeface supporting
+     * the variation selectors of the cluster is preferred over the ones that only map its base.
+     */
+    for (int pass = 0; pass < 2; pass++) {
+        bool strict = (pass == 0);
+
+        if (covers(0, codePoints, count, strict)) {
+            return 0;
+        }
+        if (current != 0 && covers(current, codePoints, count, strict)) {
+            return current;
+        }
+
+        for (size_t i = 1; i < m_count; i++) {
+            if (i != current && covers(i, codePoints, count, strict)) {
+                return i;
+            }
+        }
+    }
+
+    /* Fall back to the typeface that maps at least the base character. */
+    for (size_t i = 0; i < m_count; i++) {
+        if (m_coverages[i]->contains(codePoints[0])) {
+            return i;
+        }
+    }
+
+    return current;
+}
+
+void FontFallback::segment(const jchar *charArray, jint charCount, vector<FallbackRun> &runs) const
+{
+    if (charCount == 0) {
+        return;
+    }
+
+    vector<uint32_t> cluster;
+    size_t current = 0;
+    jint index = 0;
+
+    uint32_t codePoint = nextCodePoint(charArray, charCount, index);
+    uint8_t props = graphemeProperties(codePoint);
+    bool hasCluster = true;
+
+    while (hasCluster) {
+        bool regionalPair = false;
+        bool pictographic = props & GraphemeBreak::EXTENDED_PICTOGRAPHIC;
+        jint clusterEnd = index;
+
+        cluster.clear();
+        cluster.push_back(codePoint);
+        hasCluster = false;
+
+        /* Collect the code points of current grapheme cluster. */
+        while (index < charCount) {
+            uint32_t nextPoint = nextCodePoint(charArray, charCount, index);
+            uint8_t nextProps = graphemeProperties(nextPoint);
+
+            if (!isClusterContinued(props, nextProps, regionalPair, pictographic)) {
+                codePoint = nextPoint;
+                props = nextProps;
+                hasCluster = true;
+                break;
+            }
+
+            auto nextClass = nextProps & GraphemeBreak::CLASS_MASK;
+            if (nextClass != GraphemeBreak::EX && nextClass != GraphemeBreak::ZWJ
+                && !(nextProps & GraphemeBreak::EXTENDED_PICTOGRAPHIC)) {
+                pictographic = false;
+            }
+
+            cluster.push_back(nextPoint);
+            clusterEnd = index;
+            props = nextProps;
+        }
+
+        size_t selected = select(cluster.data(), cluster.size(), current);
+
+        if (!runs.empty() && static_cast<size_t>(runs.back().typefaceIndex) == selected) {
+            runs.back().charEnd = clusterEnd;
+        } else {
+            runs.push_back({ clusterEnd, static_cast<jint>(selected) });
+        }
+        current = selected;
+    }
+}
+
+static jintArray segment(JNIEnv *env, jobject obj, jstring text, jint charStart, jint charEnd, jobjectArray typefaces)
+{
+    JavaBridge bridge(env);
+    jsize typefaceCount = env->GetArrayLength(typefaces);
+    vector<const CoverageSet *> coverages(typefaceCount);
+
+    for (jsize i = 0; i < typefaceCount; i++) {
+        jobject jtypeface = env->GetObjectArrayElement(typefaces, i);
+        jlong typefaceHandle = bridge.Typeface_getNativeTypeface(jtypeface);
+        if (!typefaceHandle) {
+            return nullptr;
+        }
+
+        auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
+
+        coverages[i] = &typeface->coverage();
+        env->DeleteLocalRef(jtypeface);
+    }
+
+    jint charCount = charEnd - charStart;
+    vector<jchar> charArray(charCount);
+    env->GetStringRegion(text, charStart, charCount, charArray.data());
+
+    vector<FallbackRun> runs;
+    FontFallback fontFallback(coverages.data(), coverages.size());
+    fontFallback.segment(charArray.data(), charCount, runs);
+
+    vector<jint> values;
+    values.reserve(runs.size() * 2);
+
+    for (const auto &run : runs) {
+        values.push_back(run.charEnd + charStart);
+        values.push_back(run.typefaceIndex);
+    }
+
+    auto length = static_cast<jsize>(values.size());
+    jintArray array = env->NewIntArray(length);
+    env->SetIntArrayRegion(array, 0, length, values.data());
+
+    return array;
+}
+
+static jintArray findCovering(JNIEnv *env, jobject obj, jint codePoint, jobjectArray typefaces)
+{
+    JavaBridge bridge(env);
+    jsize typefaceCount = env->GetArrayLength(typefaces);
+    vector<jint> indexes;
+
+    for (jsize i = 0; i < typefaceCount; i++) {
+        jobject jtypeface = env->GetObjectArrayElement(typefaces, i);
+        jlong typefaceHandle = bridge.Typeface_getNativeTypeface(jtypeface);
+        if (!typefaceHandle) {
+            return nullptr;
+        }
+
+        auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
+        if (typeface->coverage().contains(static_cast<uint32_t>(codePoint))) {
+            indexes.push_back(i);
+        }
+
+        env->DeleteLocalRef(jtypeface);
+    }
+
+    auto length = static_cast<jsize>(indexes.size());
+    jintArray array = env->NewIntArray(length);
+    env->SetIntArrayRegion(array, 0, length, indexes.data());
+
+    return array;
+}
+
+static JNINativeMethod JNI_METHODS[] = {
+    { "findCovering", "(I[Lcom/mta/tehreer/graphics/Typeface;)[I", (void *)findCovering },
+    { "segment", "(Ljava/lang/String;II[Lcom/mta/tehreer/graphics/Typeface;)[I", (void *)segment },
+};
+
+jint register_com_mta_tehreer_internal_layout_FontFallback(JNIEnv *env)
+{
+    return JavaBridge::registerClass(env, "com/mta/tehreer/internal/layout/FontFallback", JNI_METHODS, sizeof(JNI_METHODS) / sizeof(JNI_METHODS[0]));
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _TEHREER__FONT_FALLBACK_H
+#define _TEHREER__FONT_FALLBACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <jni.h>
+#include <vector>
+
+#include "CoverageSet.h"
+
+namespace Tehreer {
+
+struct FallbackRun {
+    jint charEnd;
+    jint typefaceIndex;
+};
+
+class FontFallback {
+public:
+    FontFallback(const CoverageSet *const *coverages, size_t count);
+
+    void segment(const jchar *charArray, jint charCount, std::vector<FallbackRun> &runs) const;
+
+private:
+    const CoverageSet *const *m_coverages;
+    size_t m_count;
+
+    bool covers(size_t index, const uint32_t *codePoints, size_t count, bool strict) const;
+    size_t select(const uint32_t *codePoints, size_t count, size_t current) const;
+};
+
+}
+
+jint register_com_mta_tehreer_internal_layout_FontFallback(JNIEnv *env);
+
+#endif
@@ -26,20 +26,28 @@ extern "C" {
 }
 
 #include <jni.h>
+#include <vector>
 
 #include "Convert.h"
 #include "FreeType.h"
 #include "JavaBridge.h"
 #include "Miscellaneous.h"
+#include "PaintGraph.h"
+#include "PaintRenderer.h"
 #include "GlyphRasterizer.h"
 
+using namespace std;
 using namespace Tehreer;
 
+/* Painted glyphs exceeding this area are left to FreeType to avoid huge allocations. */
+static const FT_Pos MaxPaintedArea = 2048 * 2048;
+
 enum GlyphType : jint {
     UNKNOWN = 0,
     MASK = 1,
     COLOR = 2,
     MIXED = 3,
+    PAINTED = 4,
 };
 
 GlyphRasterizer::GlyphRasterizer(Typeface &typeface, FT_F26Dot6 pixelWidth, FT_F26Dot6 pixelHeight, FT_Matrix transform)
@@ -128,10 +136,101 @@ jobject GlyphRasterizer::unsafeCreateBitmap(const JavaBridge bridge, const FT_Bi
     return glyphBitmap;
 }
 
+jobject GlyphRasterizer::unsafeCreatePaintedBitmap(const JavaBridge bridge, FT_Face face,
+    FT_UInt glyphID, const PaintGraph &paintGraph, FT_Color foregroundColor, jint &left, jint &top)
+{
+    FT_Color *palette = nullptr;
+    FT_Palette_Data paletteData;
+    size_t paletteSize = 0;
+
+    if (FT_Palette_Select(face, 0, &palette) == FT_Err_Ok
+        && FT_Palette_Data_Get(face, &paletteData) == FT_Err_Ok) {
+        paletteSize = paletteData.num_palette_entries;
+    }
+
+    /* The graph is in font units, so the root transform maps it to the rasterizer's pixels. */
+    const FT_Size_Metrics &metrics = m_size->metrics;
+    float scaleX = metrics.x_scale / 65536.0f / 64.0f;
+    float scaleY = metrics.y_scale / 65536.0f / 64.0f;
+
+    PaintRenderer::Affine transform;
+    transform.xx = m_transform.xx / 65536.0f * scaleX;
+    transform.xy = m_transform.xy / 65536.0f * scaleY;
+    transform.dx = 0.0f;
+    transform.yx = m_transform.yx / 65536.0f * scaleX;
+    transform.yy = m_transform.yy / 65536.0f * scaleY;
+    transform.dy = 0.0f;
+
+    PaintRenderer renderer(face, paintGraph, palette, paletteSize, foregroundColor);
+    FT_ClipBox clipBox;
+    FT_BBox bounds;
+
+    if (FT_Get_Color_Glyph_ClipBox(face, glyphID, &clipBox)) {
+        const FT_Vector corners[] = {
+            clipBox.bottom_left, clipBox.top_left, clipBox.top_right, clipBox.bottom_right
+        };
+
+        bounds = { corners[0].x, corners[0].y, corners[0].x, corners[0].y };
+
+        for (const FT_Vector &corner : corners) {
+            bounds.xMin = min(bounds.xMin, corner.x);
+            bounds.yMin = min(bounds.yMin, corner.y);
+            bounds.xMax = max(bounds.xMax, corner.x);
+            bounds.yMax = max(bounds.yMax, corner.y);
+        }
+
+        bounds.xMin = (bounds.xMin & -64) / 64;
+        bounds.yMin = (bounds.yMin & -64) / 64;
+        bounds.xMax = ((bounds.xMax + 63) & -64) / 64;
+        bounds.yMax = ((bounds.yMax + 63) & -64) / 64;
+    } else if (!renderer.computeBounds(transform, bounds)) {
+        return nullptr;
+    }
+
+    FT_Pos width = bounds.xMax - bounds.xMin;
+    FT_Pos height = bounds.yMax - bounds.yMin;
+    if (width <= 0 || height <= 0 || width * height > MaxPaintedArea) {
+        return nullptr;
+    }
+
+    vector<uint8_t> pixels;
+    renderer.render(transform, bounds, pixels);
+
+    jobject glyphBitmap = bridge.Bitmap_create(width, height, JavaBridge::BitmapConfig::ARGB_8888);
+    bridge.Bitmap_setPixels(glyphBitmap, pixels.data(), pixels.size());
+
+    left = static_cast<jint>(bounds.xMin);
+    top = static_cast<jint>(bounds.yMax);
+
+    return glyphBitmap;
+}
+
 jint GlyphRasterizer::getGlyphType(FT_UInt glyphID)
 {
+    /* The type of a glyph does not depend on the size, so it is looked up from the face. */
+    switch (m_typeface.glyphTypes().get(glyphID)) {
+    case GlyphTypeTable::PLAIN:
+        return GlyphType::MASK;
+    case GlyphTypeTable::COLORED:
+        return GlyphType::COLOR;
+    case GlyphTypeTable::MIXED:
+        return GlyphType::MIXED;
+    default:
+        break;
+    }
+
+    /* Only the painted glyphs need their graph to know if they refer to the foreground color. */
     m_typeface.lock();
 
+    const PaintGraph *paintGraph = m_typeface.unsafeGetPaintGraph(glyphID);
+    if (paintGraph) {
+        bool usesForeground = paintGraph->usesForeground();
+        m_typeface.unlock();
+
+        /* Painted glyphs referring to the foreground color are cached per color like mixed ones. */
+        return usesForeground ? GlyphType::MIXED : GlyphType::PAINTED;
+    }
+
     FT_Face face = m_typeface.ftFace();
     FT_LayerIterator iterator;
     iterator.p = nullptr;
@@ -176,14 +275,23 @@ jobject GlyphRasterizer::getGlyphImage(const JavaBridge bridge,
     unsafeActivate(face, m_typeface.palette());
 
     FT_Palette_Set_Foreground_Color(face, foregroundColor);
-    FT_Error error = FT_Load_Glyph(face, glyphID, FT_LOAD_COLOR | FT_LOAD_RENDER);
-    if (error == FT_Err_Ok) {
-        FT_GlyphSlot glyphSlot = face->glyph;
-        glyphBitmap = unsafeCreateBitmap(bridge, &glyphSlot->bitmap);
 
-        if (glyphBitmap) {
-            left = glyphSlot->bitmap_left;
-            top = glyphSlot->bitmap_top;
+    const PaintGraph *paintGraph = m_typeface.unsafeGetPaintGraph(glyphID);
+    if (paintGraph) {
+        glyphBitmap = unsafeCreatePaintedBitmap(bridge, face, glyphID, *paintGraph,
+                                                foregroundColor, left, top);
+    }
+
+    if (!glyphBitmap) {
+        FT_Error error = FT_Load_Glyph(face, glyphID, FT_LOAD_COLOR | FT_LOAD_RENDER);
+        if (error == FT_Err_Ok) {
+            FT_GlyphSlot glyphSlot = face->glyph;
+            glyphBitmap = unsafeCreateBitmap(bridge, &glyphSlot->bitmap);
+
+            if (glyphBitmap) {
+                left = glyphSlot->bitmap_left;
+                top = glyphSlot->bitmap_top;
+            }
         }
     }
 
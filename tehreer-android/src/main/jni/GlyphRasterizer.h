@@ -30,6 +30,7 @@ extern "C" {
 #include "FreeType.h"
 #include "GlyphOutline.h"
 #include "JavaBridge.h"
+#include "PaintGraph.h"
 #include "Typeface.h"
 
 namespace Tehreer {
@@ -65,6 +66,8 @@ private:
     void unsafeActivate(FT_Face face, FT_Matrix *transform, const Typeface::Palette *palette);
 
     jobject unsafeCreateBitmap(const JavaBridge bridge, const FT_Bitmap *bitmap);
+    jobject unsafeCreatePaintedBitmap(const JavaBridge bridge, FT_Face face, FT_UInt glyphID,
+        const PaintGraph &paintGraph, FT_Color foregroundColor, jint &left, jint &top);
 };
 
 }
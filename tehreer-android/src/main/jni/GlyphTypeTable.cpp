@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include <ft2build.h>
+#include FT_COLOR_H
+#include FT_FREETYPE_H
+#include FT_TRUETYPE_TABLES_H
+#include FT_TRUETYPE_TAGS_H
+}
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "GlyphTypeTable.h"
+
+using namespace std;
+using namespace Tehreer;
+
+static inline uint16_t readUInt16(const vector<FT_Byte> &table, size_t offset)
+{
+    return static_cast<uint16_t>((table[offset] << 8) | table[offset + 1]);
+}
+
+static inline uint32_t readUInt32(const vector<FT_Byte> &table, size_t offset)
+{
+    return (static_cast<uint32_t>(readUInt16(table, offset)) << 16) | readUInt16(table, offset + 2);
+}
+
+GlyphTypeTable::GlyphTypeTable(FT_Face ftFace)
+    : m_words()
+{
+    FT_ULong paletteLength = 0;
+    FT_ULong length = 0;
+
+    /* FreeType ignores the color layers of a face without a palette. */
+    if (FT_Load_Sfnt_Table(ftFace, TTAG_CPAL, 0, nullptr, &paletteLength) != FT_Err_Ok
+        || FT_Load_Sfnt_Table(ftFace, TTAG_COLR, 0, nullptr, &length) != FT_Err_Ok || length < 14) {
+        return;
+    }
+
+    vector<FT_Byte> table(length);
+    FT_Load_Sfnt_Table(ftFace, TTAG_COLR, 0, table.data(), nullptr);
+
+    loadBaseGlyphs(ftFace, table);
+    loadPaintRecords(ftFace, table);
+
+    m_words.shrink_to_fit();
+}
+
+void GlyphTypeTable::set(uint32_t glyphID, Type type)
+{
+    uint32_t word = glyphID >> 4;
+    if (word >= m_words.size()) {
+        m_words.resize(word + 1, 0);
+    }
+
+    uint32_t shift = (glyphID & 15) << 1;
+    m_words[word] = (m_words[word] & ~(3U << shift)) | (static_cast<uint32_t>(type) << shift);
+}
+
+void GlyphTypeTable::loadBaseGlyphs(FT_Face ftFace, const vector<FT_Byte> &table)
+{
+    size_t length = table.size();
+    size_t baseCount = readUInt16(table, 2);
+    size_t baseOffset = readUInt32(table, 4);
+    size_t layerOffset = readUInt32(table, 8);
+    size_t layerCount = readUInt16(table, 12);
+
+    if (baseOffset + baseCount * 6 > length || layerOffset + layerCount * 4 > length) {
+        return;
+    }
+
+    FT_Palette_Data paletteData;
+    if (FT_Palette_Data_Get(ftFace, &paletteData) != FT_Err_Ok) {
+        return;
+    }
+
+    auto glyphCount = static_cast<uint32_t>(ftFace->num_glyphs);
+
+    for (size_t i = 0; i < baseCount; i++) {
+        size_t record = baseOffset + i * 6;
+        uint16_t glyphID = readUInt16(table, record);
+        size_t firstLayer = readUInt16(table, record + 2);
+        size_t numLayers = readUInt16(table, record + 4);
+
+        if (glyphID >= glyphCount || numLayers == 0 || firstLayer + numLayers > layerCount) {
+            continue;
+        }
+
+        bool isColored = false;
+        bool hasMask = false;
+
+        /* Mirror FreeType which stops at the first invalid layer. */
+        for (size_t j = 0; j < numLayers; j++) {
+            size_t layer = layerOffset + (firstLayer + j) * 4;
+            uint16_t layerGlyphID = readUInt16(table, layer);
+            uint16_t paletteIndex = readUInt16(table, layer + 2);
+
+            if (layerGlyphID >= glyphCount
+                || (paletteIndex != 0xFFFF && paletteIndex >= paletteData.num_palette_entries)) {
+                break;
+            }
+
+            isColored = true;
+
+            if (paletteIndex == 0xFFFF) {
+                hasMask = true;
+                break;
+            }
+        }
+
+        if (isColored) {
+            set(glyphID, hasMask ? MIXED : COLORED);
+        }
+    }
+}
+
+void GlyphTypeTable::loadPaintRecords(FT_Face ftFace, const vector<FT_Byte> &table)
+{
+    size_t length = table.size();
+    if (readUInt16(table, 0) < 1 || length < 34) {
+        return;
+    }
+
+    size_t listOffset = readUInt32(table, 14);
+    if (listOffset == 0 || listOffset + 4 > length) {
+        return;
+    }
+
+    size_t recordCount = readUInt32(table, listOffset);
+    if (recordCount > (length - listOffset - 4) / 6) {
+        return;
+    }
+
+    auto glyphCount = static_cast<uint32_t>(ftFace->num_glyphs);
+
+    /* The paint records take precedence over the layers just like the rasterizer. */
+    for (size_t i = 0; i < recordCount; i++) {
+        size_t record = listOffset + 4 + i * 6;
+        uint16_t glyphID = readUInt16(table, record);
+
+        if (glyphID < glyphCount) {
+            set(glyphID, PAINTED);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _TEHREER__GLYPH_TYPE_TABLE_H
+#define _TEHREER__GLYPH_TYPE_TABLE_H
+
+extern "C" {
+#include <ft2build.h>
+#include FT_FREETYPE_H
+}
+
+#include <cstdint>
+#include <vector>
+
+namespace Tehreer {
+
+/*
+ * A compact classification of all the glyphs of a face, built once from the base glyph records
+ * of COLR table. Each glyph takes two bits and the glyphs beyond the last colored one are not
+ * stored, so that the faces without a COLR table need no memory at all.
+ */
+class GlyphTypeTable {
+public:
+    enum Type : uint8_t {
+        PLAIN = 0,
+        COLORED = 1,
+        MIXED = 2,
+        PAINTED = 3,
+    };
+
+    /* The face must be locked while building the table. */
+    GlyphTypeTable(FT_Face ftFace);
+
+    inline Type get(uint32_t glyphID) const {
+        uint32_t word = glyphID >> 4;
+        if (word >= m_words.size()) {
+            return PLAIN;
+        }
+
+        return static_cast<Type>((m_words[word] >> ((glyphID & 15) << 1)) & 3);
+    }
+
+private:
+    std::vector<uint32_t> m_words;
+
+    void set(uint32_t glyphID, Type type);
+    void loadBaseGlyphs(FT_Face ftFace, const std::vector<FT_Byte> &table);
+    void loadPaintRecords(FT_Face ftFace, const std::vector<FT_Byte> &table);
+};
+
+}
+
+#endif
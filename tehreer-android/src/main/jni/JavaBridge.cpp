@@ -57,6 +57,7 @@ static jclass    STRING;
 
 static jclass    TYPEFACE;
 static jmethodID TYPEFACE__CONSTRUCTOR;
+static jmethodID TYPEFACE__LOAD_NATIVE_TYPEFACE;
 static jfieldID  TYPEFACE__NATIVE_TYPEFACE;
 
 void JavaBridge::load(JNIEnv* env)
@@ -116,6 +117,7 @@ void JavaBridge::load(JNIEnv* env)
     clazz = env->FindClass("com/mta/tehreer/graphics/Typeface");
     TYPEFACE = (jclass)env->NewGlobalRef(clazz);
     TYPEFACE__CONSTRUCTOR = env->GetMethodID(clazz, "<init>", "(J)V");
+    TYPEFACE__LOAD_NATIVE_TYPEFACE = env->GetMethodID(clazz, "loadNativeTypeface", "()J");
     TYPEFACE__NATIVE_TYPEFACE = env->GetFieldID(clazz, "nativeTypeface", "J");
 }
 
@@ -241,5 +243,11 @@ jobject JavaBridge::Typeface_construct(jlong typefaceHandle) const
 
 jlong JavaBridge::Typeface_getNativeTypeface(jobject typeface) const
 {
-    return m_env->GetLongField(typeface, TYPEFACE__NATIVE_TYPEFACE);
+    jlong typefaceHandle = m_env->GetLongField(typeface, TYPEFACE__NATIVE_TYPEFACE);
+    if (!typefaceHandle) {
+        /* The font file of the typeface has not been opened yet. */
+        typefaceHandle = m_env->CallLongMethod(typeface, TYPEFACE__LOAD_NATIVE_TYPEFACE);
+    }
+
+    return typefaceHandle;
 }
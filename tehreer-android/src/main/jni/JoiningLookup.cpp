@@ -0,0 +1,184 @@
+/*
+ * Automatically generated by SheenBidiGenerator tool from ArabicShaping.txt of
+ * Unicode 14.0.0.
+ * DO NOT EDIT!!
+ *
+ * REQUIRED MEMORY: 768 Bytes
+ */
+
+#include <cstdint>
+
+#include "JoiningLookup.h"
+
+using namespace Tehreer;
+using namespace Tehreer::Joining;
+
+#define U      NON_JOINING
+#define R      RIGHT_JOINING
+#define L      LEFT_JOINING
+#define D      DUAL_JOINING
+#define C      JOIN_CAUSING
+#define T      TRANSPARENT
+
+static const uint8_t JoiningData[768] = {
+/* 0x0600..0x060F */
+    U, U, U, U, U, U, U, U,
+    U, U, U, U, U, U, U, U,
+/* 0x0610..0x061F */
+    T, T, T, T, T, T, T, T,
+    T, T, T, U, T, U, U, U,
+/* 0x0620..0x062F */
+    D|YEH, U, R|ALEF, R|ALEF, R|WAW, R|ALEF, D|YEH, R|ALEF,
+    D|BEH, R|HEH, D|BEH, D|BEH, D, D, D, R|HEH,
+/* 0x0630..0x063F */
+    R|HEH, R|REH, R|REH, D|SEEN, D|SEEN, D|SEEN, D|SEEN, D|ALEF,
+    D|ALEF, D|WAW, D|WAW, D|ALEF, D|ALEF, D|YEH, D|YEH, D|YEH,
+/* 0x0640..0x064F */
+    C, D|WAW, D|WAW, D|ALEF, D|ALEF, D, D|BEH, D|HEH,
+    R|WAW, D|YEH, D|YEH, T, T, T, T, T,
+/* 0x0650..0x065F */
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+/* 0x0660..0x066F */
+    U, U, U, U, U, U, U, U,
+    U, U, U, U, U, U, D|BEH, D|WAW,
+/* 0x0670..0x067F */
+    T, R|ALEF, R|ALEF, R|ALEF, U, R|ALEF, R|WAW, R|WAW,
+    D|YEH, D|BEH, D|BEH, D|BEH, D|BEH, D|BEH, D|BEH, D|BEH,
+/* 0x0680..0x068F */
+    D|BEH, D, D, D, D, D, D, D,
+    R|HEH, R|HEH, R|HEH, R|HEH, R|HEH, R|HEH, R|HEH, R|HEH,
+/* 0x0690..0x069F */
+    R|HEH, R|REH, R|REH, R|REH, R|REH, R|REH, R|REH, R|REH,
+    R|REH, R|REH, D|SEEN, D|SEEN, D|SEEN, D|SEEN, D|SEEN, D|ALEF,
+/* 0x06A0..0x06AF */
+    D|WAW, D|WAW, D|WAW, D|WAW, D|WAW, D|WAW, D|WAW, D|WAW,
+    D|WAW, D|ALEF, D|ALEF, D|ALEF, D|ALEF, D|ALEF, D|ALEF, D|ALEF,
+/* 0x06B0..0x06BF */
+    D|ALEF, D|ALEF, D|ALEF, D|ALEF, D|ALEF, D|ALEF, D|ALEF, D|ALEF,
+    D|ALEF, D|BEH, D|BEH, D|BEH, D|BEH, D|BEH, D, D,
+/* 0x06C0..0x06CF */
+    R|HEH, D|HEH, D|HEH, R|HEH, R|WAW, R|WAW, R|WAW, R|WAW,
+    R|WAW, R|WAW, R|WAW, R|WAW, D|YEH, R|YEH, D|YEH, R|WAW,
+/* 0x06D0..0x06DF */
+    D|YEH, D|YEH, R|REH, R|REH, U, R|HEH, T, T,
+    T, T, T, T, T, U, U, T,
+/* 0x06E0..0x06EF */
+    T, T, T, T, T, U, U, T,
+    T, U, T, T, T, T, R|HEH, R|REH,
+/* 0x06F0..0x06FF */
+    U, U, U, U, U, U, U, U,
+    U, U, D|SEEN, D|SEEN, D|WAW, U, U, D,
+/* 0x0700..0x070F */
+    U, U, U, U, U, U, U, U,
+    U, U, U, U, U, U, U, T,
+/* 0x0710..0x071F */
+    R, T, D, D, D, R, R, R,
+    R, R, D, D, D, D, R, D,
+/* 0x0720..0x072F */
+    D, D, D, D, D, D, D, D,
+    R, D, R, D, R, D, D, R,
+/* 0x0730..0x073F */
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+/* 0x0740..0x074F */
+    T, T, T, T, T, T, T, T,
+    T, T, T, U, U, R, D, D,
+/* 0x0750..0x075F */
+    D|BEH, D|BEH, D|BEH, D|BEH, D|BEH, D|BEH, D|BEH, D,
+    D, R|HEH, R|HEH, R|REH, D|SEEN, D|WAW, D|WAW, D|WAW,
+/* 0x0760..0x076F */
+    D|WAW, D|WAW, D|ALEF, D|ALEF, D|ALEF, D, D, D|BEH,
+    D|BEH, D|BEH, D|ALEF, R|REH, R|REH, D|SEEN, D, D,
+/* 0x0770..0x077F */
+    D|SEEN, R|REH, D, R|ALEF, R|ALEF, D|YEH, D|YEH, D|YEH,
+    R|WAW, R|WAW, D|REH, D|REH, D, D|SEEN, D|SEEN, D|ALEF,
+/* 0x0780..0x078F */
+    U, U, U, U, U, U, U, U,
+    U, U, U, U, U, U, U, U,
+/* 0x0790..0x079F */
+    U, U, U, U, U, U, U, U,
+    U, U, U, U, U, U, U, U,
+/* 0x07A0..0x07AF */
+    U, U, U, U, U, U, T, T,
+    T, T, T, T, T, T, T, T,
+/* 0x07B0..0x07BF */
+    T, U, U, U, U, U, U, U,
+    U, U, U, U, U, U, U, U,
+/* 0x07C0..0x07CF */
+    U, U, U, U, U, U, U, U,
+    U, U, D, D, D, D, D, D,
+/* 0x07D0..0x07DF */
+    D, D, D, D, D, D, D, D,
+    D, D, D, D, D, D, D, D,
+/* 0x07E0..0x07EF */
+    D, D, D, D, D, D, D, D,
+    D, D, D, T, T, T, T, T,
+/* 0x07F0..0x07FF */
+    T, T, T, T, U, U, U, U,
+    U, U, C, U, U, T, U, U,
+/* 0x0800..0x080F */
+    U, U, U, U, U, U, U, U,
+    U, U, U, U, U, U, U, U,
+/* 0x0810..0x081F */
+    U, U, U, U, U, U, T, T,
+    T, T, U, T, T, T, T, T,
+/* 0x0820..0x082F */
+    T, T, T, T, U, T, T, T,
+    U, T, T, T, T, T, U, U,
+/* 0x0830..0x083F */
+    U, U, U, U, U, U, U, U,
+    U, U, U, U, U, U, U, U,
+/* 0x0840..0x084F */
+    R, D, D, D, D, D, R, R,
+    D, R, D, D, D, D, D, D,
+/* 0x0850..0x085F */
+    D, D, D, D, R, D, R, R,
+    R, T, T, T, U, U, U, U,
+/* 0x0860..0x086F */
+    D, U, D, D, D, D, U, R,
+    D, R, R, U, U, U, U, U,
+/* 0x0870..0x087F */
+    R, R, R, R, R, R, R, R,
+    R, R, R, R, R, R, R, R,
+/* 0x0880..0x088F */
+    R, R, R, C, C, C, D, U,
+    U, D, D, D, D, D, R, U,
+/* 0x0890..0x089F */
+    U, U, U, U, U, U, U, U,
+    T, T, T, T, T, T, T, T,
+/* 0x08A0..0x08AF */
+    D|BEH, D|BEH, D, D|ALEF, D|WAW, D|WAW, D|ALEF, D,
+    D|YEH, D|YEH, R|REH, R|WAW, R|YEH, U, R|HEH, D|SEEN,
+/* 0x08B0..0x08BF */
+    D|ALEF, R|WAW, R|REH, D|WAW, D|ALEF, D|WAW, D|BEH, D|BEH,
+    D|BEH, R|REH, D|YEH, D|WAW, D|WAW, D|BEH, D|BEH, D|BEH,
+/* 0x08C0..0x08CF */
+    D|BEH, D, D|ALEF, D|WAW, D|WAW, D, D, D|ALEF,
+    D|ALEF, U, T, T, T, T, T, T,
+/* 0x08D0..0x08DF */
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+/* 0x08E0..0x08EF */
+    T, T, U, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+/* 0x08F0..0x08FF */
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T
+};
+
+#undef U
+#undef R
+#undef L
+#undef D
+#undef C
+#undef T
+
+uint8_t Tehreer::lookupJoiningProperties(uint32_t codePoint)
+{
+    if (codePoint >= 0x0600 && codePoint <= 0x08FF) {
+        return JoiningData[codePoint - 0x0600];
+    }
+
+    return NON_JOINING;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _TEHREER__JOINING_LOOKUP_H
+#define _TEHREER__JOINING_LOOKUP_H
+
+#include <cstdint>
+
+namespace Tehreer {
+
+namespace Joining {
+
+enum Type : uint8_t {
+    NON_JOINING = 0,
+    RIGHT_JOINING = 1,
+    LEFT_JOINING = 2,
+    DUAL_JOINING = 3,
+    JOIN_CAUSING = 4,
+    TRANSPARENT = 5,
+};
+
+/* Groups of letters sharing the same kashida behaviour. */
+enum Group : uint8_t {
+    NONE = 0 << 3,
+    SEEN = 1 << 3,      /* Seen, Sad */
+    HEH = 2 << 3,       /* Teh Marbuta, Heh, Dal */
+    ALEF = 3 << 3,      /* Alef, Tah, Lam, Kaf, Gaf */
+    WAW = 4 << 3,       /* Waw, Ain, Qaf, Feh */
+    REH = 5 << 3,       /* Reh, Yeh Barree */
+    YEH = 6 << 3,       /* Yeh, Farsi Yeh */
+    BEH = 7 << 3,       /* Beh, Noon */
+};
+
+enum Mask : uint8_t {
+    TYPE_MASK = 0x07,
+    GROUP_MASK = 0x38,
+};
+
+}
+
+/*
+ * Returns the joining type of a code point in the low three bits and its kashida group in the next
+ * three bits. Code points outside the Arabic blocks are reported as non-joining.
+ */
+uint8_t lookupJoiningProperties(uint32_t codePoint);
+
+}
+
+#endif
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <jni.h>
+#include <vector>
+
+#include "BreakLookup.h"
+#include "JavaBridge.h"
+#include "JoiningLookup.h"
+#include "KashidaLocator.h"
+
+using namespace std;
+using namespace Tehreer;
+
+static const jchar Tatweel = 0x0640;
+static const jchar ZWNJ = 0x200C;
+static const jchar ZWJ = 0x200D;
+
+static inline bool isWordSeparator(jchar code)
+{
+    auto lineClass = lookupBreakProperties(code) & LineBreak::CLASS_MASK;
+
+    switch (lineClass) {
+    case LineBreak::SP:
+    case LineBreak::BK:
+    case LineBreak::CR:
+    case LineBreak::LF:
+    case LineBreak::NL:
+    case LineBreak::ZW:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+static inline bool joinsFollowing(uint8_t props)
+{
+    auto type = props & Joining::TYPE_MASK;
+    return type == Joining::DUAL_JOINING || type == Joining::LEFT_JOINING || type == Joining::JOIN_CAUSING;
+}
+
+static inline bool joinsPreceding(uint8_t props)
+{
+    auto type = props & Joining::TYPE_MASK;
+    return type == Joining::DUAL_JOINING || type == Joining::RIGHT_JOINING || type == Joining::JOIN_CAUSING;
+}
+
+KashidaLocator::KashidaLocator(const jchar *charArray, const jint *clusterMap)
+    : m_charArray(charArray)
+    , m_clusterMap(clusterMap)
+{
+}
+
+uint8_t KashidaLocator::getJoiningProperties(jint charIndex) const
+{
+    jchar code = m_charArray[charIndex];
+
+    if (code == ZWJ) {
+        return Joining::JOIN_CAUSING;
+    }
+    if (code == ZWNJ) {
+        return Joining::NON_JOINING;
+    }
+
+    uint8_t props = lookupJoiningProperties(code);
+
+    /* Treat the combining marks of other blocks as transparent. */
+    if (props == Joining::NON_JOINING) {
+        auto graphemeClass = (lookupBreakProperties(code) >> 8) & GraphemeBreak::CLASS_MASK;
+        if (graphemeClass == GraphemeBreak::EX) {
+            return Joining::TRANSPARENT;
+        }
+    }
+
+    return props;
+}
+
+jint KashidaLocator::getPriority(const Letter &prev, const Letter &curr, bool joinsNext) const
+{
+    if (prev.code == Tatweel) {
+        return PriorityTatweel;
+    }
+
+    auto prevGroup = prev.props & Joining::GROUP_MASK;
+    auto currGroup = curr.props & Joining::GROUP_MASK;
+
+    if (prevGroup == Joining::SEEN) {
+        return PrioritySeen;
+    }
+
+    if (!joinsNext) {
+        switch (currGroup) {
+        case Joining::HEH:
+            return PriorityFinalHeh;
+        case Joining::ALEF:
+            return PriorityFinalAlef;
+        case Joining::WAW:
+            return PriorityFinalWaw;
+        case Joining::REH:
+        case Joining::YEH:
+            return PriorityFinalReh;
+        }
+    } else if (currGroup == Joining::BEH || currGroup == Joining::YEH) {
+        return PriorityMedialBeh;
+    }
+
+    return PriorityNone;
+}
+
+void KashidaLocator::locate(jint charStart, jint charEnd, vector<KashidaPoint> &points) const
+{
+    KashidaPoint wordPoint = { -1, PriorityNone };
+
+    Letter prev = { -1, 0, Joining::NON_JOINING };
+    Letter pending = prev;
+    Letter pendingPrev = prev;
+    bool hasPending = false;
+
+    /* Evaluates the connection ending at pending letter once its successor is known. */
+    auto resolvePending = [&](bool joinsNext) {
+        if (hasPending) {
+            jint priority = getPriority(pendingPrev, pending, joinsNext);
+            /* Prefer the highest priority, and the last one among equals. */
+            if (priority != PriorityNone
+                && (wordPoint.priority == PriorityNone || priority <= wordPoint.priority)) {
+                wordPoint = { pending.index, priority };
+            }
+
+            hasPending = false;
+        }
+    };
+    auto finishWord = [&]() {
+        resolvePending(false);
+
+        if (wordPoint.priority != PriorityNone) {
+            points.push_back(wordPoint);
+            wordPoint = { -1, PriorityNone };
+        }
+
+        prev = { -1, 0, Joining::NON_JOINING };
+    };
+
+    for (jint i = charStart; i < charEnd; i++) {
+        jchar code = m_charArray[i];
+
+        if (isWordSeparator(code)) {
+            finishWord();
+            continue;
+        }
+
+        uint8_t props = getJoiningProperties(i);
+        if ((props & Joining::TYPE_MASK) == Joining::TRANSPARENT) {
+            continue;
+        }
+
+        Letter curr = { i, code, props };
+        bool isJoined = joinsFollowing(prev.props) && joinsPreceding(curr.props);
+
+        resolvePending(isJoined);
+
+        /* A kashida can not be placed inside a ligature. */
+        if (isJoined && m_clusterMap[curr.index] != m_clusterMap[prev.index]) {
+            pending = curr;
+            pendingPrev = prev;
+            hasPending = true;
+        }
+
+        prev = curr;
+    }
+
+    finishWord();
+}
+
+static jintArray locate(JNIEnv *env, jobject obj, jstring text, jint charStart, jint charEnd, jintArray clusterMap)
+{
+    jint charCount = charEnd - charStart;
+    vector<jchar> charArray(charCount);
+    vector<jint> clusterArray(charCount);
+
+    env->GetStringRegion(text, charStart, charCount, charArray.data());
+    env->GetIntArrayRegion(clusterMap, 0, charCount, clusterArray.data());
+
+    vector<KashidaPoint> points;
+    KashidaLocator kashidaLocator(charArray.data(), clusterArray.data());
+    kashidaLocator.locate(0, charCount, points);
+
+    vector<jint> values;
+    values.reserve(points.size() * 2);
+
+    for (const auto &point : points) {
+        values.push_back(point.charIndex + charStart);
+        values.push_back(point.priority);
+    }
+
+    auto length = static_cast<jsize>(values.size());
+    jintArray array = env->NewIntArray(length);
+    env->SetIntArrayRegion(array, 0, length, values.data());
+
+    return array;
+}
+
+static JNINativeMethod JNI_METHODS[] = {
+    { "locate", "(Ljava/lang/String;II[I)[I", (void *)locate },
+};
+
+jint register_com_mta_tehreer_internal_layout_KashidaLocator(JNIEnv *env)
+{
+    return JavaBridge::registerClass(env, "com/mta/tehreer/internal/layout/KashidaLocator", JNI_METHODS, sizeof(JNI_METHODS) / sizeof(JNI_METHODS[0]));
+}
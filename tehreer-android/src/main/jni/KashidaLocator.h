@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _TEHREER__KASHIDA_LOCATOR_H
+#define _TEHREER__KASHIDA_LOCATOR_H
+
+#include <cstdint>
+#include <jni.h>
+#include <vector>
+
+namespace Tehreer {
+
+struct KashidaPoint {
+    jint charIndex;
+    jint priority;
+};
+
+class KashidaLocator {
+public:
+    static const jint PriorityNone = 0;
+    static const jint PriorityTatweel = 1;
+    static const jint PrioritySeen = 2;
+    static const jint PriorityFinalHeh = 3;
+    static const jint PriorityFinalAlef = 4;
+    static const jint PriorityFinalWaw = 5;
+    static const jint PriorityFinalReh = 6;
+    static const jint PriorityMedialBeh = 7;
+
+    KashidaLocator(const jchar *charArray, const jint *clusterMap);
+
+    void locate(jint charStart, jint charEnd, std::vector<KashidaPoint> &points) const;
+
+private:
+    struct Letter {
+        jint index;
+        jchar code;
+        uint8_t props;
+    };
+
+    uint8_t getJoiningProperties(jint charIndex) const;
+    jint getPriority(const Letter &prev, const Letter &curr, bool joinsNext) const;
+
+    const jchar *m_charArray;
+    const jint *m_clusterMap;
+};
+
+}
+
+jint register_com_mta_tehreer_internal_layout_KashidaLocator(JNIEnv *env);
+
+#endif
@@ -0,0 +1,337 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include <SBCodepoint.h>
+#include <SBGeneralCategory.h>
+}
+
+#include <algorithm>
+#include <jni.h>
+#include <limits>
+#include <vector>
+
+#include "JavaBridge.h"
+#include "LineBreaker.h"
+
+using namespace std;
+using namespace Tehreer;
+
+static bool isWhitespace(jchar ch)
+{
+    /* Mirrors the behaviour of java.lang.Character.isWhitespace(char). */
+    switch (ch) {
+    case 0x0009: case 0x000A: case 0x000B: case 0x000C: case 0x000D:
+    case 0x001C: case 0x001D: case 0x001E: case 0x001F:
+        return true;
+
+    case 0x00A0: case 0x2007: case 0x202F:
+        return false;
+    }
+
+    SBGeneralCategory category = SBCodepointGetGeneralCategory(ch);
+    return SBGeneralCategoryIsSeparator(category);
+}
+
+LineBreaker::LineBreaker(const jchar *charArray, const jbyte *breakData, const jdouble *advanceSums)
+    : m_charArray(charArray)
+    , m_breakData(breakData)
+    , m_advanceSums(advanceSums)
+{
+}
+
+jint LineBreaker::getTrailingWhitespaceStart(jint charStart, jint charEnd) const
+{
+    for (jint i = charEnd - 1; i >= charStart; i--) {
+        if (!isWhitespace(m_charArray[i])) {
+            return i + 1;
+        }
+    }
+
+    return charStart;
+}
+
+jint LineBreaker::getNextBreak(jint charIndex, jint endIndex, jbyte breakType) const
+{
+    do {
+        charIndex += 1;
+    } while (charIndex < endIndex && (m_breakData[charIndex - 1] & breakType) != breakType);
+
+    return charIndex;
+}
+
+bool LineBreaker::isHyphenBreak(jint breakIndex) const
+{
+    switch (m_charArray[breakIndex - 1]) {
+    case 0x002D: case 0x00AD: case 0x2010:
+        return true;
+    }
+
+    return false;
+}
+
+jint LineBreaker::findForwardBreak(jint startIndex, jint endIndex, jfloat breakExtent, jbyte breakType) const
+{
+    jint forwardIndex = startIndex;
+    jint breakIndex = startIndex;
+
+    while (breakIndex < endIndex) {
+        breakIndex = getNextBreak(breakIndex, endIndex, breakType);
+
+        jfloat measurement = measureChars(startIndex, breakIndex);
+        if (measurement > breakExtent) {
+            jint wsStart = getTrailingWhitespaceStart(forwardIndex, breakIndex);
+            jfloat wsExtent = measureChars(wsStart, breakIndex);
+
+            /* Break if excluding whitespace extent helps. */
+            if ((measurement - wsExtent) <= breakExtent) {
+                forwardIndex = breakIndex;
+            }
+            break;
+        }
+
+        forwardIndex = breakIndex;
+    }
+
+    return forwardIndex;
+}
+
+jint LineBreaker::suggestForwardBreak(jint startIndex, jint endIndex, jfloat breakExtent) const
+{
+    jint breakIndex = findForwardBreak(startIndex, endIndex, breakExtent, BreakTypeLine);
+
+    /* Fallback to character break if no line break occurs in desired extent. */
+    if (breakIndex == startIndex) {
+        breakIndex = findForwardBreak(startIndex, endIndex, breakExtent, BreakTypeCharacter);
+
+        /* Take at least one character (grapheme) if extent is too small. */
+        if (breakIndex == startIndex) {
+            breakIndex = min(endIndex, breakIndex + 1);
+        }
+    }
+
+    return breakIndex;
+}
+
+void LineBreaker::breakOptimally(jint startIndex, jint endIndex, bool isParagraphEnd, jint lineOffset,
+    const OptimalBreakParams &params, vector<jint> &lineEnds) const
+{
+    struct Node {
+        double demerits;
+        jint previous;
+        jint lineCount;
+    };
+
+    const double ForcedDemerits = 1.0e6;
+    const double Infinity = numeric_limits<double>::infinity();
+
+    vector<Node> nodes(endIndex - startIndex + 1, { Infinity, -1, 0 });
+    nodes[0] = { 0.0, -1, lineOffset };
+
+    auto relax = [&](jint lineStart, jint lineEnd, jfloat lineWidth, jfloat lineExtent, double extra) {
+        const Node &origin = nodes[lineStart - startIndex];
+        bool isLastLine = (isParagraphEnd && lineEnd == endIndex);
+        double demerits = extra;
+
+        if (isLastLine) {
+            /* Last line of the paragraph is never stretched. Penalize it if it holds a single
+             * word while the paragraph consists of more lines. */
+            if (origin.lineCount > 0 && getNextBreak(lineStart, endIndex, BreakTypeLine) == lineEnd) {
+                demerits += params.widowPenalty;
+            }
+        } else {
+            double ratio = (lineExtent - lineWidth) / max(lineExtent, 1.0f);
+            demerits += 100.0 * ratio * ratio;
+
+            if (isHyphenBreak(lineEnd)) {
+                demerits += params.hyphenPenalty;
+            }
+        }
+
+        /* A line wider than its extent will be squeezed by justification. */
+        if (lineWidth > lineExtent) {
+            demerits += params.tightnessPenalty;
+        }
+
+        double total = origin.demerits + demerits;
+        Node &target = nodes[lineEnd - startIndex];
+
+        if (total < target.demerits) {
+            target = { total, lineStart, origin.lineCount + 1 };
+        }
+    };
+
+    for (jint lineStart = startIndex; lineStart < endIndex; lineStart++) {
+        const Node &origin = nodes[lineStart - startIndex];
+        if (origin.demerits == Infinity) {
+            continue;
+        }
+
+        bool isLeading = (origin.lineCount < params.leadingLines);
+        jfloat lineExtent = (isLeading ? params.leadingExtent : params.trailingExtent);
+        jfloat lineLimit = (isLeading ? params.leadingLimit : params.trailingLimit);
+        jint breakIndex = lineStart;
+        bool isFeasible = false;
+
+        /* Try every break opportunity that fits in the line while hanging its whitespace. */
+        while (breakIndex < endIndex) {
+            breakIndex = getNextBreak(breakIndex, endIndex, BreakTypeLine);
+
+            jint wsStart = getTrailingWhitespaceStart(lineStart, breakIndex);
+            jfloat lineWidth = measureChars(lineStart, wsStart);
+            if (lineWidth > lineLimit) {
+                break;
+            }
+
+            relax(lineStart, breakIndex, lineWidth, lineExtent, 0.0);
+            isFeasible = true;
+        }
+
+        /* Force a break just like greedy breaking if no opportunity fits in the line. */
+        if (!isFeasible) {
+            jint forcedEnd = suggestForwardBreak(lineStart, endIndex, lineLimit);
+            jint wsStart = getTrailingWhitespaceStart(lineStart, forcedEnd);
+            jfloat lineWidth = measureChars(lineStart, wsStart);
+
+            relax(lineStart, forcedEnd, lineWidth, lineExtent, ForcedDemerits);
+        }
+    }
+
+    size_t firstLine = lineEnds.size();
+
+    for (jint lineEnd = endIndex; lineEnd != startIndex; lineEnd = nodes[lineEnd - startIndex].previous) {
+        lineEnds.push_back(lineEnd);
+    }
+
+    reverse(lineEnds.begin() + firstLine, lineEnds.end());
+}
+
+static jintArray toJIntArray(JNIEnv *env, const vector<jint> &values)
+{
+    auto length = static_cast<jsize>(values.size());
+    jintArray array = env->NewIntArray(length);
+    env->SetIntArrayRegion(array, 0, length, values.data());
+
+    return array;
+}
+
+static jintArray breakLines(JNIEnv *env, jobject obj, jstring text, jbyteArray breakData,
+    jdoubleArray advanceSums, jint charStart, jint charEnd,
+    jfloat leadingExtent, jint leadingLines, jfloat trailingExtent, jint maxLines)
+{
+    vector<jint> lineEnds;
+
+    const jchar *charArray = env->GetStringCritical(text, nullptr);
+    void *breaksPtr = env->GetPrimitiveArrayCritical(breakData, nullptr);
+    void *sumsPtr = env->GetPrimitiveArrayCritical(advanceSums, nullptr);
+
+    LineBreaker lineBreaker(charArray, static_cast<jbyte *>(breaksPtr), static_cast<jdouble *>(sumsPtr));
+    jint lineStart = charStart;
+
+    while (lineStart < charEnd && static_cast<jint>(lineEnds.size()) < maxLines) {
+        jint lineIndex = static_cast<jint>(lineEnds.size());
+        jfloat breakExtent = (lineIndex < leadingLines ? leadingExtent : trailingExtent);
+        jint lineEnd = lineBreaker.suggestForwardBreak(lineStart, charEnd, breakExtent);
+
+        lineEnds.push_back(lineEnd);
+        lineStart = lineEnd;
+    }
+
+    env->ReleasePrimitiveArrayCritical(advanceSums, sumsPtr, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(breakData, breaksPtr, JNI_ABORT);
+    env->ReleaseStringCritical(text, charArray);
+
+    return toJIntArray(env, lineEnds);
+}
+
+static jintArray breakLinesOptimally(JNIEnv *env, jobject obj, jstring text, jbyteArray breakData,
+    jdoubleArray advanceSums, jint charStart, jint charEnd,
+    jfloat leadingExtent, jfloat leadingLimit, jint leadingLines,
+    jfloat trailingExtent, jfloat trailingLimit,
+    jfloat hyphenPenalty, jfloat widowPenalty, jfloat tightnessPenalty,
+    jint lookahead, jint maxLines)
+{
+    OptimalBreakParams params;
+    params.leadingExtent = leadingExtent;
+    params.leadingLimit = leadingLimit;
+    params.leadingLines = leadingLines;
+    params.trailingExtent = trailingExtent;
+    params.trailingLimit = trailingLimit;
+    params.hyphenPenalty = hyphenPenalty;
+    params.widowPenalty = widowPenalty;
+    params.tightnessPenalty = tightnessPenalty;
+
+    vector<jint> lineEnds;
+
+    const jchar *charArray = env->GetStringCritical(text, nullptr);
+    void *breaksPtr = env->GetPrimitiveArrayCritical(breakData, nullptr);
+    void *sumsPtr = env->GetPrimitiveArrayCritical(advanceSums, nullptr);
+
+    LineBreaker lineBreaker(charArray, static_cast<jbyte *>(breaksPtr), static_cast<jdouble *>(sumsPtr));
+
+    if (lookahead <= 0) {
+        lineBreaker.breakOptimally(charStart, charEnd, true, 0, params, lineEnds);
+    } else {
+        jint lineStart = charStart;
+
+        while (lineStart < charEnd && static_cast<jint>(lineEnds.size()) < maxLines) {
+            auto lineOffset = static_cast<jint>(lineEnds.size());
+            jint windowEnd = lineStart;
+
+            /* Greedy breaking yields the fewest lines, so the window holds at least as many lines
+             * as the lookahead. */
+            for (jint i = 0; i < lookahead && windowEnd < charEnd; i++) {
+                bool isLeading = (lineOffset + i < leadingLines);
+                jfloat lineLimit = (isLeading ? leadingLimit : trailingLimit);
+
+                windowEnd = lineBreaker.suggestForwardBreak(windowEnd, charEnd, lineLimit);
+            }
+
+            bool isParagraphEnd = (windowEnd == charEnd);
+            size_t firstLine = lineEnds.size();
+
+            lineBreaker.breakOptimally(lineStart, windowEnd, isParagraphEnd, lineOffset, params, lineEnds);
+
+            /* Last line of an intermediate window is constrained by the window end, so drop it
+             * and let it be reconsidered by the next window. */
+            if (!isParagraphEnd && lineEnds.size() - firstLine > 1) {
+                lineEnds.pop_back();
+            }
+
+            lineStart = lineEnds.back();
+        }
+    }
+
+    env->ReleasePrimitiveArrayCritical(advanceSums, sumsPtr, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(breakData, breaksPtr, JNI_ABORT);
+    env->ReleaseStringCritical(text, charArray);
+
+    if (static_cast<jint>(lineEnds.size()) > maxLines) {
+        lineEnds.resize(maxLines);
+    }
+
+    return toJIntArray(env, lineEnds);
+}
+
+static JNINativeMethod JNI_METHODS[] = {
+    { "breakLines", "(Ljava/lang/String;[B[DIIFIFI)[I", (void *)breakLines },
+    { "breakLinesOptimally", "(Ljava/lang/String;[B[DIIFFIFFFFFII)[I", (void *)breakLinesOptimally },
+};
+
+jint register_com_mta_tehreer_internal_layout_LineBreaker(JNIEnv *env)
+{
+    return JavaBridge::registerClass(env, "com/mta/tehreer/internal/layout/LineBreaker", JNI_METHODS, sizeof(JNI_METHODS) / sizeof(JNI_METHODS[0]));
+}
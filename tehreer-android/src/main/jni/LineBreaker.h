@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _TEHREER__LINE_BREAKER_H
+#define _TEHREER__LINE_BREAKER_H
+
+#include <jni.h>
+#include <vector>
+
+namespace Tehreer {
+
+struct OptimalBreakParams {
+    jfloat leadingExtent;
+    jfloat leadingLimit;
+    jint leadingLines;
+    jfloat trailingExtent;
+    jfloat trailingLimit;
+    jfloat hyphenPenalty;
+    jfloat widowPenalty;
+    jfloat tightnessPenalty;
+};
+
+class LineBreaker {
+public:
+    static const jbyte BreakTypeCharacter = 1 << 0;
+    static const jbyte BreakTypeLine = 1 << 2;
+
+    LineBreaker(const jchar *charArray, const jbyte *breakData, const jdouble *advanceSums);
+
+    jfloat measureChars(jint charStart, jint charEnd) const {
+        return static_cast<jfloat>(m_advanceSums[charEnd] - m_advanceSums[charStart]);
+    }
+
+    jint getTrailingWhitespaceStart(jint charStart, jint charEnd) const;
+
+    jint findForwardBreak(jint startIndex, jint endIndex, jfloat breakExtent, jbyte breakType) const;
+    jint suggestForwardBreak(jint startIndex, jint endIndex, jfloat breakExtent) const;
+
+    void breakOptimally(jint startIndex, jint endIndex, bool isParagraphEnd, jint lineOffset,
+                        const OptimalBreakParams &params, std::vector<jint> &lineEnds) const;
+
+private:
+    jint getNextBreak(jint charIndex, jint endIndex, jbyte breakType) const;
+    bool isHyphenBreak(jint breakIndex) const;
+
+    const jchar *m_charArray;
+    const jbyte *m_breakData;
+    const jdouble *m_advanceSums;
+};
+
+}
+
+jint register_com_mta_tehreer_internal_layout_LineBreaker(JNIEnv *env);
+
+#endif
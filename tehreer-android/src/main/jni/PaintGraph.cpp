@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+extern "C" {
+#include <ft2build.h>
+#include FT_COLOR_H
+#include FT_FREETYPE_H
+}
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "PaintGraph.h"
+
+using namespace std;
+using namespace Tehreer;
+
+static const int MaxDepth = 64;
+
+static inline float toFloat(FT_Fixed value)
+{
+    return static_cast<float>(value) / 65536.0f;
+}
+
+static inline float toRadians(FT_Fixed value)
+{
+    /* FreeType gives the angles in half turns. */
+    return static_cast<float>(value) / 65536.0f * static_cast<float>(M_PI);
+}
+
+static void setupCenteredTransform(PaintGraph::Node &node,
+    float xx, float xy, float yx, float yy, FT_Fixed centerX, FT_Fixed centerY)
+{
+    float cx = toFloat(centerX);
+    float cy = toFloat(centerY);
+
+    node.kind = PaintGraph::TRANSFORM;
+    node.values[0] = xx;
+    node.values[1] = xy;
+    node.values[2] = cx - (xx * cx + xy * cy);
+    node.values[3] = yx;
+    node.values[4] = yy;
+    node.values[5] = cy - (yx * cx + yy * cy);
+}
+
+struct PaintGraph::Context {
+    FT_Face ftFace;
+    int depth;
+
+    /* Paints are shared within a graph so they are decoded only once. */
+    unordered_map<const FT_Byte *, int32_t> decodedPaints;
+    unordered_set<const FT_Byte *> activePaints;
+    vector<FT_UInt> activeGlyphs;
+};
+
+PaintGraph *PaintGraph::decode(FT_Face ftFace, FT_UInt glyphID)
+{
+    FT_OpaquePaint rootPaint = { nullptr, 0 };
+    if (!FT_Get_Color_Glyph_Paint(ftFace, glyphID, FT_COLOR_NO_ROOT_TRANSFORM, &rootPaint)) {
+        return nullptr;
+    }
+
+    auto graph = new PaintGraph();
+
+    Context context;
+    context.ftFace = ftFace;
+    context.depth = 0;
+    context.activeGlyphs.push_back(glyphID);
+
+    graph->m_root = graph->decodePaint(context, rootPaint);
+    if (graph->m_root < 0) {
+        delete graph;
+        return nullptr;
+    }
+
+    return graph;
+}
+
+PaintGraph::PaintGraph()
+    : m_root(-1)
+    , m_usesForeground(false)
+{
+}
+
+int32_t PaintGraph::addNode(const Node &node)
+{
+    m_nodes.push_back(node);
+    return static_cast<int32_t>(m_nodes.size() - 1);
+}
+
+PaintGraph::Color PaintGraph::decodeColor(const FT_ColorIndex &colorIndex)
+{
+    Color color;
+    color.paletteIndex = colorIndex.palette_index;
+    color.alpha = static_cast<float>(colorIndex.alpha) / 16384.0f;
+
+    if (color.paletteIndex == ForegroundIndex) {
+        m_usesForeground = true;
+    }
+
+    return color;
+}
+
+void PaintGraph::decodeColorLine(Context &context, FT_ColorLine colorLine, Node &node)
+{
+    auto stopStart = static_cast<int32_t>(m_stops.size());
+    FT_ColorStop colorStop;
+
+    while (FT_Get_Colorline_Stops(context.ftFace, &colorStop, &colorLine.color_stop_iterator)) {
+        Stop stop;
+        stop.offset = toFloat(colorStop.stop_offset);
+        stop.color = decodeColor(colorStop.color);
+
+        m_stops.push_back(stop);
+    }
+
+    /* Stops with equal offsets must keep their order to produce hard transitions. */
+    stable_sort(m_stops.begin() + stopStart, m_stops.end(), [](const Stop &a, const Stop &b) {
+        return a.offset < b.offset;
+    });
+
+    node.extend = static_cast<uint8_t>(colorLine.extend);
+    node.first = stopStart;
+    node.second = static_cast<int32_t>(m_stops.size()) - stopStart;
+}
+
+int32_t PaintGraph::decodePaint(Context &context, FT_OpaquePaint opaquePaint)
+{
+    const FT_Byte *key = opaquePaint.p;
+
+    auto decoded = context.decodedPaints.find(key);
+    if (decoded != context.decodedPaints.end()) {
+        return decoded->second;
+    }
+
+    /* Reject cyclic or excessively deep graphs of malformed fonts. */
+    if (context.depth >= MaxDepth || context.activePaints.count(key)) {
+        return -1;
+    }
+
+    FT_COLR_Paint paint;
+    if (!FT_Get_Paint(context.ftFace, opaquePaint, &paint)) {
+        return -1;
+    }
+
+    context.depth++;
+    context.activePaints.insert(key);
+
+    int32_t index = decodeNode(context, paint);
+
+    context.activePaints.erase(key);
+    context.depth--;
+
+    context.decodedPaints[key] = index;
+
+    return index;
+}
+
+int32_t PaintGraph::decodeNode(Context &context, const FT_COLR_Paint &paint)
+{
+    Node node = { };
+    node.first = -1;
+    node.second = -1;
+
+    switch (paint.format) {
+    case FT_COLR_PAINTFORMAT_COLR_LAYERS: {
+        FT_LayerIterator iterator = paint.u.colr_layers.layer_iterator;
+        FT_OpaquePaint layerPaint = { nullptr, 0 };
+        vector<int32_t> layers;
+
+        while (FT_Get_Paint_Layers(context.ftFace, &iterator, &layerPaint)) {
+            int32_t layer = decodePaint(context, layerPaint);
+            if (layer >= 0) {
+                layers.push_back(layer);
+            }
+        }
+
+        node.kind = LAYERS;
+        node.first = static_cast<int32_t>(m_layers.size());
+        node.second = static_cast<int32_t>(layers.size());
+
+        m_layers.insert(m_layers.end(), layers.begin(), layers.end());
+        break;
+    }
+
+    case FT_COLR_PAINTFORMAT_SOLID:
+        node.kind = SOLID;
+        node.color = decodeColor(paint.u.solid.color);
+        break;
+
+    case FT_COLR_PAINTFORMAT_LINEAR_GRADIENT: {
+        const FT_PaintLinearGradient &gradient = paint.u.linear_gradient;
+
+        node.kind = LINEAR_GRADIENT;
+        node.values[0] = toFloat(gradient.p0.x);
+        node.values[1] = toFloat(gradient.p0.y);
+        node.values[2] = toFloat(gradient.p1.x);
+        node.values[3] = toFloat(gradient.p1.y);
+        node.values[4] = toFloat(gradient.p2.x);
+        node.values[5] = toFloat(gradient.p2.y);
+
+        decodeColorLine(context, gradient.colorline, node);
+        break;
+    }
+
+    case FT_COLR_PAINTFORMAT_RADIAL_GRADIENT: {
+        const FT_PaintRadialGradient &gradient = paint.u.radial_gradient;
+
+        node.kind = RADIAL_GRADIENT;
+        node.values[0] = toFloat(gradient.c0.x);
+        node.values[1] = toFloat(gradient.c0.y);
+        node.values[2] = toFloat(gradient.r0);
+        node.values[3] = toFloat(gradient.c1.x);
+        node.values[4] = toFloat(gradient.c1.y);
+        node.values[5] = toFloat(gradient.r1);
+
+        decodeColorLine(context, gradient.colorline, node);
+        break;
+    }
+
+    case FT_COLR_PAINTFORMAT_SWEEP_GRADIENT: {
+        const FT_PaintSweepGradient &gradient = paint.u.sweep_gradient;
+
+        node.kind = SWEEP_GRADIENT;
+        node.values[0] = toFloat(gradient.center.x);
+        node.values[1] = toFloat(gradient.center.y);
+        node.values[2] = toFloat(gradient.start_angle) * 180.0f;
+        node.values[3] = toFloat(gradient.end_angle) * 180.0f;
+
+        decodeColorLine(context, gradient.colorline, node);
+        break;
+    }
+
+    case FT_COLR_PAINTFORMAT_GLYPH:
+        node.kind = GLYPH;
+        node.glyphID = paint.u.glyph.glyphID;
+        node.first = decodePaint(context, paint.u.glyph.paint);
+        break;
+
+    case FT_COLR_PAINTFORMAT_COLR_GLYPH: {
+        FT_UInt glyphID = paint.u.colr_glyph.glyphID;
+        vector<FT_UInt> &activeGlyphs = context.activeGlyphs;
+
+        if (find(activeGlyphs.begin(), activeGlyphs.end(), glyphID) != activeGlyphs.end()) {
+            return -1;
+        }
+
+        FT_OpaquePaint glyphPaint = { nullptr, 0 };
+        if (!FT_Get_Color_Glyph_Paint(context.ftFace, glyphID, FT_COLOR_NO_ROOT_TRANSFORM, &glyphPaint)) {
+            return -1;
+        }
+
+        /* The referenced glyph is painted inline, so its root is returned as is. */
+        activeGlyphs.push_back(glyphID);
+        int32_t index = decodePaint(context, glyphPaint);
+        activeGlyphs.pop_back();
+
+        return index;
+    }
+
+    case FT_COLR_PAINTFORMAT_TRANSFORM: {
+        const FT_Affine23 &affine = paint.u.transform.affine;
+
+        node.kind = TRANSFORM;
+        node.values[0] = toFloat(affine.xx);
+        node.values[1] = toFloat(affine.xy);
+        node.values[2] = toFloat(affine.dx);
+        node.values[3] = toFloat(affine.yx);
+        node.values[4] = toFloat(affine.yy);
+        node.values[5] = toFloat(affine.dy);
+        node.first = decodePaint(context, paint.u.transform.paint);
+        break;
+    }
+
+    case FT_COLR_PAINTFORMAT_TRANSLATE:
+        setupCenteredTransform(node, 1.0f, 0.0f, 0.0f, 1.0f, 0, 0);
+        node.values[2] = toFloat(paint.u.translate.dx);
+        node.values[5] = toFloat(paint.u.translate.dy);
+        node.first = decodePaint(context, paint.u.translate.paint);
+        break;
+
+    case FT_COLR_PAINTFORMAT_SCALE: {
+        const FT_PaintScale &scale = paint.u.scale;
+
+        setupCenteredTransform(node, toFloat(scale.scale_x), 0.0f, 0.0f, toFloat(scale.scale_y),
+                               scale.center_x, scale.center_y);
+        node.first = decodePaint(context, scale.paint);
+        break;
+    }
+
+    case FT_COLR_PAINTFORMAT_ROTATE: {
+        const FT_PaintRotate &rotate = paint.u.rotate;
+        float angle = toRadians(rotate.angle);
+        float cosine = cosf(angle);
+        float sine = sinf(angle);
+
+        setupCenteredTransform(node, cosine, -sine, sine, cosine, rotate.center_x, rotate.center_y);
+        node.first = decodePaint(context, rotate.paint);
+        break;
+    }
+
+    case FT_COLR_PAINTFORMAT_SKEW: {
+        const FT_PaintSkew &skew = paint.u.skew;
+        float xSkew = tanf(toRadians(skew.x_skew_angle));
+        float ySkew = tanf(toRadians(skew.y_skew_angle));
+
+        /* Positive angles turn the axes counter-clockwise. */
+        setupCenteredTransform(node, 1.0f, -xSkew, ySkew, 1.0f, skew.center_x, skew.center_y);
+        node.first = decodePaint(context, skew.paint);
+        break;
+    }
+
+    case FT_COLR_PAINTFORMAT_COMPOSITE: {
+        const FT_PaintComposite &composite = paint.u.composite;
+
+        node.kind = COMPOSITE;
+        node.mode = static_cast<uint8_t>(composite.composite_mode);
+        node.first = decodePaint(context, composite.source_paint);
+        node.second = decodePaint(context, composite.backdrop_paint);
+        break;
+    }
+
+    default:
+        return -1;
+    }
+
+    return addNode(node);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _TEHREER__PAINT_GRAPH_H
+#define _TEHREER__PAINT_GRAPH_H
+
+extern "C" {
+#include <ft2build.h>
+#include FT_COLOR_H
+#include FT_FREETYPE_H
+}
+
+#include <cstdint>
+#include <vector>
+
+namespace Tehreer {
+
+/*
+ * A decoded COLRv1 paint graph of a color glyph. The nodes are kept in font units so that a
+ * single graph can be rendered at any size. Shared sub-graphs are decoded only once.
+ */
+class PaintGraph {
+public:
+    enum Kind : uint8_t {
+        LAYERS = 0,
+        SOLID = 1,
+        LINEAR_GRADIENT = 2,
+        RADIAL_GRADIENT = 3,
+        SWEEP_GRADIENT = 4,
+        GLYPH = 5,
+        TRANSFORM = 6,
+        COMPOSITE = 7,
+    };
+
+    static const uint16_t ForegroundIndex = 0xFFFF;
+
+    struct Color {
+        uint16_t paletteIndex;
+        float alpha;
+    };
+
+    struct Stop {
+        float offset;
+        Color color;
+    };
+
+    struct Node {
+        Kind kind;
+        uint8_t extend;
+        uint8_t mode;
+        FT_UInt glyphID;
+
+        /* Child nodes, or the range of layers and stops depending on the kind. */
+        int32_t first;
+        int32_t second;
+
+        Color color;
+
+        /*
+         * Geometry of the node:
+         *   - Linear gradient: x0, y0, x1, y1, x2, y2
+         *   - Radial gradient: x0, y0, r0, x1, y1, r1
+         *   - Sweep gradient: cx, cy, start angle, end angle in degrees
+         *   - Transform: xx, xy, dx, yx, yy, dy
+         */
+        float values[6];
+    };
+
+    /* Returns a decoded graph of the glyph, or nullptr if it is not a COLRv1 glyph. */
+    static PaintGraph *decode(FT_Face ftFace, FT_UInt glyphID);
+
+    inline int32_t root() const { return m_root; }
+    inline bool usesForeground() const { return m_usesForeground; }
+
+    inline const Node &nodeAt(int32_t index) const { return m_nodes[index]; }
+    inline int32_t layerAt(int32_t index) const { return m_layers[index]; }
+    inline const Stop &stopAt(int32_t index) const { return m_stops[index]; }
+
+private:
+    struct Context;
+
+    std::vector<Node> m_nodes;
+    std::vector<int32_t> m_layers;
+    std::vector<Stop> m_stops;
+    int32_t m_root;
+    bool m_usesForeground;
+
+    PaintGraph();
+
+    int32_t decodePaint(Context &context, FT_OpaquePaint opaquePaint);
+    int32_t decodeNode(Context &context, const FT_COLR_Paint &paint);
+    void decodeColorLine(Context &context, FT_ColorLine colorLine, Node &node);
+    Color decodeColor(const FT_ColorIndex &colorIndex);
+    int32_t addNode(const Node &node);
+};
+
+}
+
+#endif
@@ -0,0 +1,996 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+extern "C" {
+#include <ft2build.h>
+#include FT_BITMAP_H
+#include FT_COLOR_H
+#include FT_FREETYPE_H
+#include FT_IMAGE_H
+#include FT_OUTLINE_H
+}
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "PaintGraph.h"
+#include "PaintRenderer.h"
+
+using namespace std;
+using namespace Tehreer;
+
+static const int MaxDepth = 64;
+static const int RampSize = 256;
+static const float Coverage = 1.0f / 255.0f;
+
+using Node = PaintGraph::Node;
+
+/*
+ * The pixel loops below work on contiguous premultiplied floats without branches in their bodies,
+ * so that the compiler can turn them into vector instructions of the target.
+ */
+
+static void blendSpan(const float *source, float *destination, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        const float *s = source + (i * 4);
+        float *d = destination + (i * 4);
+        float inverse = 1.0f - s[3];
+
+        d[0] = s[0] + d[0] * inverse;
+        d[1] = s[1] + d[1] * inverse;
+        d[2] = s[2] + d[2] * inverse;
+        d[3] = s[3] + d[3] * inverse;
+    }
+}
+
+static void blendSpan(const float *source, const uint8_t *mask, float *destination, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        const float *s = source + (i * 4);
+        float *d = destination + (i * 4);
+        float weight = mask[i] * Coverage;
+        float inverse = 1.0f - s[3] * weight;
+
+        d[0] = s[0] * weight + d[0] * inverse;
+        d[1] = s[1] * weight + d[1] * inverse;
+        d[2] = s[2] * weight + d[2] * inverse;
+        d[3] = s[3] * weight + d[3] * inverse;
+    }
+}
+
+template <typename Operator>
+static void compositePixels(const float *source, float *backdrop, size_t count, Operator op)
+{
+    for (size_t i = 0; i < count; i++) {
+        const float *s = source + (i * 4);
+        float *d = backdrop + (i * 4);
+        float sa = s[3];
+        float da = d[3];
+
+        d[0] = op(s[0], sa, d[0], da);
+        d[1] = op(s[1], sa, d[1], da);
+        d[2] = op(s[2], sa, d[2], da);
+        d[3] = op(sa, sa, da, da);
+    }
+}
+
+template <typename Operator>
+static void blendPixels(const float *source, float *backdrop, size_t count, Operator op)
+{
+    for (size_t i = 0; i < count; i++) {
+        const float *s = source + (i * 4);
+        float *d = backdrop + (i * 4);
+        float sa = s[3];
+        float da = d[3];
+
+        d[0] = op(s[0], sa, d[0], da);
+        d[1] = op(s[1], sa, d[1], da);
+        d[2] = op(s[2], sa, d[2], da);
+        d[3] = sa + da - sa * da;
+    }
+}
+
+struct PorterDuff {
+    float sourceFactor;
+    float sourceAlpha;
+    float backdropFactor;
+    float backdropAlpha;
+
+    /*
+     * Porter-Duff operators are expressed as s * Fa + d * Fb where each factor is a constant plus
+     * a multiple of the alpha of the other layer.
+     */
+    inline float operator()(float s, float sa, float d, float da) const {
+        float fa = sourceFactor + sourceAlpha * da;
+        float fb = backdropFactor + backdropAlpha * sa;
+
+        return s * fa + d * fb;
+    }
+};
+
+struct Plus {
+    inline float operator()(float s, float, float d, float) const {
+        return min(s + d, 1.0f);
+    }
+};
+
+struct Multiply {
+    inline float operator()(float s, float sa, float d, float da) const {
+        return s * d + s * (1.0f - da) + d * (1.0f - sa);
+    }
+};
+
+struct Screen {
+    inline float operator()(float s, float, float d, float) const {
+        return s + d - s * d;
+    }
+};
+
+struct Darken {
+    inline float operator()(float s, float sa, float d, float da) const {
+        return s + d - max(s * da, d * sa);
+    }
+};
+
+struct Lighten {
+    inline float operator()(float s, float sa, float d, float da) const {
+        return s + d - min(s * da, d * sa);
+    }
+};
+
+struct Difference {
+    inline float operator()(float s, float sa, float d, float da) const {
+        return s + d - 2.0f * min(s * da, d * sa);
+    }
+};
+
+struct Exclusion {
+    inline float operator()(float s, float, float d, float) const {
+        return s + d - 2.0f * s * d;
+    }
+};
+
+struct HardLight {
+    inline float operator()(float s, float sa, float d, float da) const {
+        float outside = s * (1.0f - da) + d * (1.0f - sa);
+        float inside = (2.0f * s <= sa
+                        ? 2.0f * s * d
+                        : sa * da - 2.0f * (da - d) * (sa - s));
+
+        return inside + outside;
+    }
+};
+
+struct Overlay {
+    inline float operator()(float s, float sa, float d, float da) const {
+        return HardLight()(d, da, s, sa);
+    }
+};
+
+/*
+ * The remaining separable modes are defined on unpremultiplied colors. They are applied as
+ * s * (1 - da) + d * (1 - sa) + sa * da * B(Cs, Cb) where B is the blend function of the mode.
+ */
+template <typename Function>
+struct Separable {
+    inline float operator()(float s, float sa, float d, float da) const {
+        float cs = (sa > 0.0f ? min(s / sa, 1.0f) : 0.0f);
+        float cb = (da > 0.0f ? min(d / da, 1.0f) : 0.0f);
+
+        return s * (1.0f - da) + d * (1.0f - sa) + sa * da * Function::blend(cs, cb);
+    }
+};
+
+struct ColorDodge {
+    static inline float blend(float cs, float cb) {
+        if (cb <= 0.0f) {
+            return 0.0f;
+        }
+        if (cs >= 1.0f) {
+            return 1.0f;
+        }
+
+        return min(1.0f, cb / (1.0f - cs));
+    }
+};
+
+struct ColorBurn {
+    static inline float blend(float cs, float cb) {
+        if (cb >= 1.0f) {
+            return 1.0f;
+        }
+        if (cs <= 0.0f) {
+            return 0.0f;
+        }
+
+        return 1.0f - min(1.0f, (1.0f - cb) / cs);
+    }
+};
+
+struct SoftLight {
+    static inline float blend(float cs, float cb) {
+        if (cs <= 0.5f) {
+            return cb - (1.0f - 2.0f * cs) * cb * (1.0f - cb);
+        }
+
+        float dark = (cb <= 0.25f ? ((16.0f * cb - 12.0f) * cb + 4.0f) * cb : sqrtf(cb));
+        return cb + (2.0f * cs - 1.0f) * (dark - cb);
+    }
+};
+
+/*
+ * Non-separable modes mix the hue, saturation and luminosity of unpremultiplied colors as defined
+ * by the compositing specification of W3C, which COLRv1 refers to.
+ */
+struct Color {
+    float r;
+    float g;
+    float b;
+};
+
+static inline float luminosity(const Color &c)
+{
+    return 0.3f * c.r + 0.59f * c.g + 0.11f * c.b;
+}
+
+static inline float saturation(const Color &c)
+{
+    return max(c.r, max(c.g, c.b)) - min(c.r, min(c.g, c.b));
+}
+
+static inline Color clipColor(Color c)
+{
+    float l = luminosity(c);
+    float n = min(c.r, min(c.g, c.b));
+    float x = max(c.r, max(c.g, c.b));
+
+    if (n < 0.0f) {
+        float scale = l / (l - n);
+        c = { l + (c.r - l) * scale, l + (c.g - l) * scale, l + (c.b - l) * scale };
+    }
+    if (x > 1.0f) {
+        float scale = (1.0f - l) / (x - l);
+        c = { l + (c.r - l) * scale, l + (c.g - l) * scale, l + (c.b - l) * scale };
+    }
+
+    return c;
+}
+
+static inline Color setLuminosity(const Color &c, float l)
+{
+    float delta = l - luminosity(c);
+    return clipColor({ c.r + delta, c.g + delta, c.b + delta });
+}
+
+static inline Color setSaturation(const Color &c, float s)
+{
+    float n = min(c.r, min(c.g, c.b));
+    float x = max(c.r, max(c.g, c.b));
+
+    /* Stretch the channels so that the minimum becomes zero and the maximum becomes s. */
+    if (x <= n) {
+        return { 0.0f, 0.0f, 0.0f };
+    }
+
+    float scale = s / (x - n);
+    return { (c.r - n) * scale, (c.g - n) * scale, (c.b - n) * scale };
+}
+
+struct Hue {
+    static inline Color blend(const Color &cs, const Color &cb) {
+        return setLuminosity(setSaturation(cs, saturation(cb)), luminosity(cb));
+    }
+};
+
+struct Saturation {
+    static inline Color blend(const Color &cs, const Color &cb) {
+        return setLuminosity(setSaturation(cb, saturation(cs)), luminosity(cb));
+    }
+};
+
+struct ColorMode {
+    static inline Color blend(const Color &cs, const Color &cb) {
+        return setLuminosity(cs, luminosity(cb));
+    }
+};
+
+struct Luminosity {
+    static inline Color blend(const Color &cs, const Color &cb) {
+        return setLuminosity(cb, luminosity(cs));
+    }
+};
+
+template <typename Function>
+static void blendNonSeparable(const float *source, float *backdrop, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        const float *s = source + (i * 4);
+        float *d = backdrop + (i * 4);
+        float sa = s[3];
+        float da = d[3];
+        float si = (sa > 0.0f ? 1.0f / sa : 0.0f);
+        float di = (da > 0.0f ? 1.0f / da : 0.0f);
+
+        Color cs = { s[0] * si, s[1] * si, s[2] * si };
+        Color cb = { d[0] * di, d[1] * di, d[2] * di };
+        Color blended = Function::blend(cs, cb);
+        float both = sa * da;
+
+        d[0] = s[0] * (1.0f - da) + d[0] * (1.0f - sa) + both * blended.r;
+        d[1] = s[1] * (1.0f - da) + d[1] * (1.0f - sa) + both * blended.g;
+        d[2] = s[2] * (1.0f - da) + d[2] * (1.0f - sa) + both * blended.b;
+        d[3] = sa + da - both;
+    }
+}
+
+static inline float applyExtend(float value, uint8_t extend)
+{
+    switch (extend) {
+    case FT_COLR_PAINT_EXTEND_REPEAT:
+        return value - floorf(value);
+
+    case FT_COLR_PAINT_EXTEND_REFLECT: {
+        float period = value - 2.0f * floorf(value * 0.5f);
+        return period > 1.0f ? 2.0f - period : period;
+    }
+
+    default:
+        return min(max(value, 0.0f), 1.0f);
+    }
+}
+
+struct PaintRenderer::GradientRamp {
+    const float *colors;
+    float start;
+    float span;
+    uint8_t extend;
+
+    inline void shade(float offset, float *pixel) const {
+        float position = (span != 0.0f
+                          ? applyExtend((offset - start) / span, extend)
+                          : (offset < start ? 0.0f : 1.0f));
+        auto entry = static_cast<int>(position * (RampSize - 1) + 0.5f);
+        const float *color = colors + (entry * 4);
+
+        copy(color, color + 4, pixel);
+    }
+};
+
+/*
+ * Each gradient maps a point of the glyph space to an offset along its color line, answering
+ * whether the point is painted at all.
+ */
+
+struct LinearGradient {
+    float x0, y0;
+    float ax, ay;
+
+    inline bool operator()(float px, float py, float &offset) const {
+        offset = (px - x0) * ax + (py - y0) * ay;
+        return true;
+    }
+};
+
+struct RadialGradient {
+    float x0, y0, r0;
+    float ax, ay, az;
+    float a;
+
+    inline bool operator()(float px, float py, float &offset) const {
+        /* Find the largest t for which the point lies on a circle of nonnegative radius. */
+        float qx = px - x0;
+        float qy = py - y0;
+        float b = qx * ax + qy * ay + r0 * az;
+        float c = qx * qx + qy * qy - r0 * r0;
+
+        if (fabsf(a) < 1e-6f) {
+            if (b == 0.0f) {
+                return false;
+            }
+
+            offset = c / (2.0f * b);
+            return r0 + offset * az >= 0.0f;
+        }
+
+        float discriminant = b * b - a * c;
+        if (discriminant < 0.0f) {
+            return false;
+        }
+
+        float root = sqrtf(discriminant);
+        float larger = (b + root) / a;
+        float smaller = (b - root) / a;
+
+        if (larger < smaller) {
+            swap(larger, smaller);
+        }
+
+        if (r0 + larger * az >= 0.0f) {
+            offset = larger;
+        } else if (r0 + smaller * az >= 0.0f) {
+            offset = smaller;
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+};
+
+struct SweepGradient {
+    float cx, cy;
+    float startAngle;
+    float angleSpan;
+
+    inline bool operator()(float px, float py, float &offset) const {
+        float angle = atan2f(py - cy, px - cx) * (180.0f / static_cast<float>(M_PI));
+        if (angle < 0.0f) {
+            angle += 360.0f;
+        }
+
+        offset = (angle - startAngle) / angleSpan;
+        return true;
+    }
+};
+
+PaintRenderer::Affine PaintRenderer::Affine::multiply(const Affine &other) const
+{
+    /* The other transform is applied first. */
+    Affine result;
+    result.xx = xx * other.xx + xy * other.yx;
+    result.xy = xx * other.xy + xy * other.yy;
+    result.dx = xx * other.dx + xy * other.dy + dx;
+    result.yx = yx * other.xx + yy * other.yx;
+    result.yy = yx * other.xy + yy * other.yy;
+    result.dy = yx * other.dx + yy * other.dy + dy;
+
+    return result;
+}
+
+bool PaintRenderer::Affine::invert(Affine &inverse) const
+{
+    float determinant = xx * yy - xy * yx;
+    if (fabsf(determinant) < 1e-12f) {
+        return false;
+    }
+
+    float reciprocal = 1.0f / determinant;
+    inverse.xx = yy * reciprocal;
+    inverse.xy = -xy * reciprocal;
+    inverse.yx = -yx * reciprocal;
+    inverse.yy = xx * reciprocal;
+    inverse.dx = -(inverse.xx * dx + inverse.xy * dy);
+    inverse.dy = -(inverse.yx * dx + inverse.yy * dy);
+
+    return true;
+}
+
+static inline PaintRenderer::Affine toAffine(const Node &node)
+{
+    PaintRenderer::Affine affine;
+    affine.xx = node.values[0];
+    affine.xy = node.values[1];
+    affine.dx = node.values[2];
+    affine.yx = node.values[3];
+    affine.yy = node.values[4];
+    affine.dy = node.values[5];
+
+    return affine;
+}
+
+PaintRenderer::Surface::Surface(int width, int height, FT_Pos left, FT_Pos top)
+    : width(width)
+    , height(height)
+    , left(left)
+    , top(top)
+    , pixels(static_cast<size_t>(width) * height * 4, 0.0f)
+{
+}
+
+PaintRenderer::PaintRenderer(FT_Face ftFace, const PaintGraph &graph,
+        const FT_Color *palette, size_t paletteSize, FT_Color foregroundColor)
+    : m_ftFace(ftFace)
+    , m_graph(graph)
+    , m_palette(palette)
+    , m_paletteSize(palette ? paletteSize : 0)
+    , m_foregroundColor(foregroundColor)
+{
+}
+
+bool PaintRenderer::loadOutline(FT_UInt glyphID)
+{
+    /* Outlines are loaded in font units as the graph transform takes care of the scaling. */
+    FT_Int32 loadFlags = FT_LOAD_NO_SCALE | FT_LOAD_NO_BITMAP | FT_LOAD_IGNORE_TRANSFORM;
+    FT_Error error = FT_Load_Glyph(m_ftFace, glyphID, loadFlags);
+
+    return error == FT_Err_Ok && m_ftFace->glyph->format == FT_GLYPH_FORMAT_OUTLINE;
+}
+
+void PaintRenderer::accumulateBounds(int32_t index, const Affine &transform, int depth, FT_BBox &bounds)
+{
+    if (index < 0 || depth >= MaxDepth) {
+        return;
+    }
+
+    const Node &node = m_graph.nodeAt(index);
+
+    switch (node.kind) {
+    case PaintGraph::LAYERS:
+        for (int32_t i = 0; i < node.second; i++) {
+            accumulateBounds(m_graph.layerAt(node.first + i), transform, depth + 1, bounds);
+        }
+        break;
+
+    case PaintGraph::GLYPH:
+        if (loadOutline(node.glyphID)) {
+            const FT_Outline &outline = m_ftFace->glyph->outline;
+
+            for (int i = 0; i < outline.n_points; i++) {
+                auto x = static_cast<float>(outline.points[i].x);
+                auto y = static_cast<float>(outline.points[i].y);
+                auto px = static_cast<FT_Pos>(floorf(x * transform.xx + y * transform.xy + transform.dx));
+                auto py = static_cast<FT_Pos>(floorf(x * transform.yx + y * transform.yy + transform.dy));
+
+                bounds.xMin = min(bounds.xMin, px);
+                bounds.yMin = min(bounds.yMin, py);
+                bounds.xMax = max(bounds.xMax, px + 1);
+                bounds.yMax = max(bounds.yMax, py + 1);
+            }
+        }
+        break;
+
+    case PaintGraph::TRANSFORM:
+        accumulateBounds(node.first, transform.multiply(toAffine(node)), depth + 1, bounds);
+        break;
+
+    case PaintGraph::COMPOSITE:
+        accumulateBounds(node.first, transform, depth + 1, bounds);
+        accumulateBounds(node.second, transform, depth + 1, bounds);
+        break;
+
+    default:
+        /* Unclipped fills take the bounds of their siblings. */
+        break;
+    }
+}
+
+bool PaintRenderer::computeBounds(const Affine &transform, FT_BBox &bounds)
+{
+    bounds.xMin = LONG_MAX;
+    bounds.yMin = LONG_MAX;
+    bounds.xMax = LONG_MIN;
+    bounds.yMax = LONG_MIN;
+
+    accumulateBounds(m_graph.root(), transform, 0, bounds);
+
+    return bounds.xMin < bounds.xMax && bounds.yMin < bounds.yMax;
+}
+
+void PaintRenderer::resolveColor(const PaintGraph::Color &color, float *components) const
+{
+    FT_Color source = { 0, 0, 0, 0 };
+
+    if (color.paletteIndex == PaintGraph::ForegroundIndex) {
+        source = m_foregroundColor;
+    } else if (color.paletteIndex < m_paletteSize) {
+        source = m_palette[color.paletteIndex];
+    }
+
+    float alpha = min(max(source.alpha * Coverage * color.alpha, 0.0f), 1.0f);
+
+    components[0] = source.red * Coverage * alpha;
+    components[1] = source.green * Coverage * alpha;
+    components[2] = source.blue * Coverage * alpha;
+    components[3] = alpha;
+}
+
+void PaintRenderer::buildRamp(const Node &node, float *ramp) const
+{
+    int32_t count = node.second;
+    vector<float> colors(static_cast<size_t>(count) * 4);
+
+    for (int32_t i = 0; i < count; i++) {
+        resolveColor(m_graph.stopAt(node.first + i).color, &colors[i * 4]);
+    }
+
+    float start = m_graph.stopAt(node.first).offset;
+    float span = m_graph.stopAt(node.first + count - 1).offset - start;
+    int32_t upper = 0;
+
+    /* Colors are interpolated in premultiplied space as required by COLRv1. */
+    for (int i = 0; i < RampSize; i++) {
+        float offset = start + span * i / (RampSize - 1);
+        float *entry = ramp + (i * 4);
+
+        while (upper < count && m_graph.stopAt(node.first + upper).offset < offset) {
+            upper++;
+        }
+
+        if (upper == 0 || upper == count) {
+            const float *color = &colors[(upper == 0 ? 0 : count - 1) * 4];
+            copy(color, color + 4, entry);
+        } else {
+            float lowerOffset = m_graph.stopAt(node.first + upper - 1).offset;
+            float upperOffset = m_graph.stopAt(node.first + upper).offset;
+            float weight = (offset - lowerOffset) / (upperOffset - lowerOffset);
+            const float *lowerColor = &colors[(upper - 1) * 4];
+            const float *upperColor = &colors[upper * 4];
+
+            for (int c = 0; c < 4; c++) {
+                entry[c] = lowerColor[c] + (upperColor[c] - lowerColor[c]) * weight;
+            }
+        }
+    }
+}
+
+void PaintRenderer::rasterizeGlyph(FT_UInt glyphID, const Affine &transform, const Surface &surface,
+    vector<uint8_t> &mask)
+{
+    mask.assign(static_cast<size_t>(surface.width) * surface.height, 0);
+
+    if (!loadOutline(glyphID)) {
+        return;
+    }
+
+    FT_Outline &outline = m_ftFace->glyph->outline;
+    auto bottom = static_cast<float>(surface.top - surface.height);
+    auto left = static_cast<float>(surface.left);
+
+    /* Move the outline into the pixel grid of the surface in 26.6 format. */
+    for (int i = 0; i < outline.n_points; i++) {
+        FT_Vector &point = outline.points[i];
+        auto x = static_cast<float>(point.x);
+        auto y = static_cast<float>(point.y);
+
+        point.x = lroundf((x * transform.xx + y * transform.xy + transform.dx - left) * 64.0f);
+        point.y = lroundf((x * transform.yx + y * transform.yy + transform.dy - bottom) * 64.0f);
+    }
+
+    FT_Bitmap bitmap;
+    FT_Bitmap_Init(&bitmap);
+    bitmap.width = static_cast<unsigned int>(surface.width);
+    bitmap.rows = static_cast<unsigned int>(surface.height);
+    bitmap.pitch = surface.width;
+    bitmap.buffer = mask.data();
+    bitmap.num_grays = 256;
+    bitmap.pixel_mode = FT_PIXEL_MODE_GRAY;
+
+    FT_Outline_Get_Bitmap(m_ftFace->glyph->library, &outline, &bitmap);
+}
+
+void PaintRenderer::render(const Affine &transform, const FT_BBox &bounds, vector<uint8_t> &pixels)
+{
+    auto width = static_cast<int>(bounds.xMax - bounds.xMin);
+    auto height = static_cast<int>(bounds.yMax - bounds.yMin);
+
+    Surface surface(width, height, bounds.xMin, bounds.yMax);
+    drawNode(m_graph.root(), transform, surface);
+
+    size_t length = surface.pixels.size();
+    pixels.resize(length);
+
+    for (size_t i = 0; i < length; i++) {
+        float value = min(max(surface.pixels[i], 0.0f), 1.0f);
+        pixels[i] = static_cast<uint8_t>(value * 255.0f + 0.5f);
+    }
+}
+
+void PaintRenderer::drawNode(int32_t index, const Affine &transform, Surface &surface)
+{
+    if (index < 0) {
+        return;
+    }
+
+    const Node &node = m_graph.nodeAt(index);
+
+    switch (node.kind) {
+    case PaintGraph::LAYERS:
+        for (int32_t i = 0; i < node.second; i++) {
+            drawNode(m_graph.layerAt(node.first + i), transform, surface);
+        }
+        break;
+
+    case PaintGraph::GLYPH: {
+        vector<uint8_t> mask;
+        rasterizeGlyph(node.glyphID, transform, surface, mask);
+        fillNode(node.first, transform, mask.data(), surface);
+        break;
+    }
+
+    case PaintGraph::TRANSFORM:
+        drawNode(node.first, transform.multiply(toAffine(node)), surface);
+        break;
+
+    case PaintGraph::COMPOSITE:
+        compositeNode(node, transform, surface);
+        break;
+
+    default:
+        shadeNode(node, transform, nullptr, surface);
+        break;
+    }
+}
+
+void PaintRenderer::fillNode(int32_t index, const Affine &transform, const uint8_t *mask, Surface &surface)
+{
+    if (index < 0) {
+        return;
+    }
+
+    const Node &node = m_graph.nodeAt(index);
+
+    switch (node.kind) {
+    case PaintGraph::SOLID:
+    case PaintGraph::LINEAR_GRADIENT:
+    case PaintGraph::RADIAL_GRADIENT:
+    case PaintGraph::SWEEP_GRADIENT:
+        /* Fills are shaded straight through the mask without an intermediate layer. */
+        shadeNode(node, transform, mask, surface);
+        break;
+
+    case PaintGraph::TRANSFORM:
+        fillNode(node.first, transform.multiply(toAffine(node)), mask, surface);
+        break;
+
+    default: {
+        Surface layer(surface.width, surface.height, surface.left, surface.top);
+        drawNode(index, transform, layer);
+
+        size_t stride = static_cast<size_t>(surface.width) * 4;
+
+        for (int y = 0; y < surface.height; y++) {
+            blendSpan(&layer.pixels[y * stride], mask + (y * surface.width),
+                      &surface.pixels[y * stride], surface.width);
+        }
+        break;
+    }
+    }
+}
+
+void PaintRenderer::shadeNode(const Node &node, const Affine &transform, const uint8_t *mask, Surface &surface)
+{
+    if (node.kind == PaintGraph::SOLID) {
+        size_t width = static_cast<size_t>(surface.width);
+        size_t stride = width * 4;
+        vector<float> row(stride);
+        float color[4];
+        resolveColor(node.color, color);
+
+        for (size_t x = 0; x < width; x++) {
+            copy(color, color + 4, &row[x * 4]);
+        }
+
+        for (int y = 0; y < surface.height; y++) {
+            float *destination = &surface.pixels[y * stride];
+
+            if (mask) {
+                blendSpan(row.data(), mask + (y * width), destination, width);
+            } else {
+                blendSpan(row.data(), destination, width);
+            }
+        }
+        return;
+    }
+
+    Affine inverse;
+    if (node.second <= 0 || !transform.invert(inverse)) {
+        return;
+    }
+
+    float ramp[RampSize * 4];
+    buildRamp(node, ramp);
+
+    GradientRamp gradientRamp;
+    gradientRamp.colors = ramp;
+    gradientRamp.start = m_graph.stopAt(node.first).offset;
+    gradientRamp.span = m_graph.stopAt(node.first + node.second - 1).offset - gradientRamp.start;
+    gradientRamp.extend = node.extend;
+
+    const float *values = node.values;
+
+    switch (node.kind) {
+    case PaintGraph::LINEAR_GRADIENT: {
+        /* Project p0p1 onto the line perpendicular to p0p2 to find the effective direction. */
+        float dx = values[2] - values[0];
+        float dy = values[3] - values[1];
+        float nx = values[5] - values[1];
+        float ny = -(values[4] - values[0]);
+        float normal = nx * nx + ny * ny;
+
+        if (normal > 0.0f) {
+            float projection = (dx * nx + dy * ny) / normal;
+            dx = nx * projection;
+            dy = ny * projection;
+        }
+
+        float length = dx * dx + dy * dy;
+        if (length <= 0.0f) {
+            return;
+        }
+
+        LinearGradient gradient = { values[0], values[1], dx / length, dy / length };
+        shadeGradient(gradient, gradientRamp, inverse, mask, surface);
+        break;
+    }
+
+    case PaintGraph::RADIAL_GRADIENT: {
+        float ax = values[3] - values[0];
+        float ay = values[4] - values[1];
+        float az = values[5] - values[2];
+
+        RadialGradient gradient = { values[0], values[1], values[2],
+                                    ax, ay, az, ax * ax + ay * ay - az * az };
+        shadeGradient(gradient, gradientRamp, inverse, mask, surface);
+        break;
+    }
+
+    case PaintGraph::SWEEP_GRADIENT: {
+        float angleSpan = values[3] - values[2];
+        if (angleSpan == 0.0f) {
+            return;
+        }
+
+        SweepGradient gradient = { values[0], values[1], values[2], angleSpan };
+        shadeGradient(gradient, gradientRamp, inverse, mask, surface);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+template <typename Gradient>
+void PaintRenderer::shadeGradient(const Gradient &gradient, const GradientRamp &ramp,
+    const Affine &inverse, const uint8_t *mask, Surface &surface)
+{
+    size_t width = static_cast<size_t>(surface.width);
+    size_t stride = width * 4;
+    vector<float> row(stride);
+
+    for (int y = 0; y < surface.height; y++) {
+        float deviceX = surface.left + 0.5f;
+        float deviceY = surface.top - y - 0.5f;
+        float px = inverse.xx * deviceX + inverse.xy * deviceY + inverse.dx;
+        float py = inverse.yx * deviceX + inverse.yy * deviceY + inverse.dy;
+
+        for (size_t x = 0; x < width; x++, px += inverse.xx, py += inverse.yx) {
+            float *pixel = &row[x * 4];
+            float offset;
+
+            if (gradient(px, py, offset)) {
+                ramp.shade(offset, pixel);
+            } else {
+                fill(pixel, pixel + 4, 0.0f);
+            }
+        }
+
+        float *destination = &surface.pixels[y * stride];
+
+        if (mask) {
+            blendSpan(row.data(), mask + (y * width), destination, width);
+        } else {
+            blendSpan(row.data(), destination, width);
+        }
+    }
+}
+
+void PaintRenderer::compositeNode(const Node &node, const Affine &transform, Surface &surface)
+{
+    Surface source(surface.width, surface.height, surface.left, surface.top);
+    Surface backdrop(surface.width, surface.height, surface.left, surface.top);
+
+    drawNode(node.first, transform, source);
+    drawNode(node.second, transform, backdrop);
+
+    const float *s = source.pixels.data();
+    float *d = backdrop.pixels.data();
+    size_t count = static_cast<size_t>(surface.width) * surface.height;
+
+    switch (node.mode) {
+    case FT_COLR_COMPOSITE_CLEAR:
+        compositePixels(s, d, count, PorterDuff { 0, 0, 0, 0 });
+        break;
+    case FT_COLR_COMPOSITE_SRC:
+        compositePixels(s, d, count, PorterDuff { 1, 0, 0, 0 });
+        break;
+    case FT_COLR_COMPOSITE_DEST:
+        break;
+    case FT_COLR_COMPOSITE_DEST_OVER:
+        compositePixels(s, d, count, PorterDuff { 1, -1, 1, 0 });
+        break;
+    case FT_COLR_COMPOSITE_SRC_IN:
+        compositePixels(s, d, count, PorterDuff { 0, 1, 0, 0 });
+        break;
+    case FT_COLR_COMPOSITE_DEST_IN:
+        compositePixels(s, d, count, PorterDuff { 0, 0, 0, 1 });
+        break;
+    case FT_COLR_COMPOSITE_SRC_OUT:
+        compositePixels(s, d, count, PorterDuff { 1, -1, 0, 0 });
+        break;
+    case FT_COLR_COMPOSITE_DEST_OUT:
+        compositePixels(s, d, count, PorterDuff { 0, 0, 1, -1 });
+        break;
+    case FT_COLR_COMPOSITE_SRC_ATOP:
+        compositePixels(s, d, count, PorterDuff { 0, 1, 1, -1 });
+        break;
+    case FT_COLR_COMPOSITE_DEST_ATOP:
+        compositePixels(s, d, count, PorterDuff { 1, -1, 0, 1 });
+        break;
+    case FT_COLR_COMPOSITE_XOR:
+        compositePixels(s, d, count, PorterDuff { 1, -1, 1, -1 });
+        break;
+    case FT_COLR_COMPOSITE_PLUS:
+        compositePixels(s, d, count, Plus());
+        break;
+    case FT_COLR_COMPOSITE_SCREEN:
+        blendPixels(s, d, count, Screen());
+        break;
+    case FT_COLR_COMPOSITE_OVERLAY:
+        blendPixels(s, d, count, Overlay());
+        break;
+    case FT_COLR_COMPOSITE_DARKEN:
+        blendPixels(s, d, count, Darken());
+        break;
+    case FT_COLR_COMPOSITE_LIGHTEN:
+        blendPixels(s, d, count, Lighten());
+        break;
+    case FT_COLR_COMPOSITE_HARD_LIGHT:
+        blendPixels(s, d, count, HardLight());
+        break;
+    case FT_COLR_COMPOSITE_DIFFERENCE:
+        blendPixels(s, d, count, Difference());
+        break;
+    case FT_COLR_COMPOSITE_EXCLUSION:
+        blendPixels(s, d, count, Exclusion());
+        break;
+    case FT_COLR_COMPOSITE_MULTIPLY:
+        blendPixels(s, d, count, Multiply());
+        break;
+    case FT_COLR_COMPOSITE_COLOR_DODGE:
+        blendPixels(s, d, count, Separable<ColorDodge>());
+        break;
+    case FT_COLR_COMPOSITE_COLOR_BURN:
+        blendPixels(s, d, count, Separable<ColorBurn>());
+        break;
+    case FT_COLR_COMPOSITE_SOFT_LIGHT:
+        blendPixels(s, d, count, Separable<SoftLight>());
+        break;
+    case FT_COLR_COMPOSITE_HSL_HUE:
+        blendNonSeparable<Hue>(s, d, count);
+        break;
+    case FT_COLR_COMPOSITE_HSL_SATURATION:
+        blendNonSeparable<Saturation>(s, d, count);
+        break;
+    case FT_COLR_COMPOSITE_HSL_COLOR:
+        blendNonSeparable<ColorMode>(s, d, count);
+        break;
+    case FT_COLR_COMPOSITE_HSL_LUMINOSITY:
+        blendNonSeparable<Luminosity>(s, d, count);
+        break;
+    default:
+        /* Source over, the only remaining mode, as FreeType rejects unknown ones. */
+        compositePixels(s, d, count, PorterDuff { 1, 0, 1, -1 });
+        break;
+    }
+
+    blendSpan(d, surface.pixels.data(), count);
+}
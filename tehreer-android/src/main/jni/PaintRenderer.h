@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2023 Muhammad Tayyab Akram
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _TEHREER__PAINT_RENDERER_H
+#define _TEHREER__PAINT_RENDERER_H
+
+extern "C" {
+#include <ft2build.h>
+#include FT_COLOR_H
+#include FT_FREETYPE_H
+#include FT_IMAGE_H
+}
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "PaintGraph.h"
+
+namespace Tehreer {
+
+/*
+ * Composites a COLRv1 paint graph into premultiplied RGBA pixels. All the methods expect the face
+ * to be locked by the caller.
+ */
+class PaintRenderer {
+public:
+    /* An affine transform computed as x' = x*xx + y*xy + dx, y' = x*yx + y*yy + dy. */
+    struct Affine {
+        float xx, xy, dx;
+        float yx, yy, dy;
+
+        Affine multiply(const Affine &other) const;
+        bool invert(Affine &inverse) const;
+    };
+
+    PaintRenderer(FT_Face ftFace, const PaintGraph &graph,
+                  const FT_Color *palette, size_t paletteSize, FT_Color foregroundColor);
+
+    /* Computes the pixel bounds enclosing the glyph outlines of the graph. */
+    bool computeBounds(const Affine &transform, FT_BBox &bounds);
+    /* Renders the graph within the pixel bounds, the first row being the top one. */
+    void render(const Affine &transform, const FT_BBox &bounds, std::vector<uint8_t> &pixels);
+
+private:
+    struct Surface {
+        int width;
+        int height;
+        FT_Pos left;
+        FT_Pos top;
+        std::vector<float> pixels;
+
+        Surface(int width, int height, FT_Pos left, FT_Pos top);
+    };
+
+    struct GradientRamp;
+
+    FT_Face m_ftFace;
+    const PaintGraph &m_graph;
+    const FT_Color *m_palette;
+    size_t m_paletteSize;
+    FT_Color m_foregroundColor;
+
+    bool loadOutline(FT_UInt glyphID);
+    void accumulateBounds(int32_t index, const Affine &transform, int depth, FT_BBox &bounds);
+
+    void resolveColor(const PaintGraph::Color &color, float *components) const;
+    void buildRamp(const PaintGraph::Node &node, float *ramp) const;
+
+    void rasterizeGlyph(FT_UInt glyphID, const Affine &transform, const Surface &surface,
+                        std::vector<uint8_t> &mask);
+
+    void drawNode(int32_t index, const Affine &transform, Surface &surface);
+    void fillNode(int32_t index, const Affine &transform, const uint8_t *mask, Surface &surface);
+    void shadeNode(const PaintGraph::Node &node, const Affine &transform,
+                   const uint8_t *mask, Surface &surface);
+    template <typename Gradient>
+    void shadeGradient(const Gradient &gradient, const GradientRamp &ramp,
+                       const Affine &inverse, const uint8_t *mask, Surface &surface);
+    void compositeNode(const PaintGraph::Node &node, const Affine &transform, Surface &surface);
+};
+
+}
+
+#endif
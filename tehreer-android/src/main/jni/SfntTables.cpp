@@ -565,6 +565,10 @@ jstring getNameCharset(JNIEnv *env, jobject obj, jint platformId, jint encodingI
 jint getNameCount(JNIEnv *env, jobject obj, jobject jtypeface)
 {
     jlong typefaceHandle = JavaBridge(env).Typeface_getNativeTypeface(jtypeface);
+    if (!typefaceHandle) {
+        return 0;
+    }
+
     auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
     FT_Face baseFace = typeface->ftFace();
     FT_UInt nameCount = FT_Get_Sfnt_Name_Count(baseFace);
@@ -575,6 +579,10 @@ jint getNameCount(JNIEnv *env, jobject obj, jobject jtypeface)
 jobject getNameRecord(JNIEnv *env, jobject obj, jobject jtypeface, jint index)
 {
     jlong typefaceHandle = JavaBridge(env).Typeface_getNativeTypeface(jtypeface);
+    if (!typefaceHandle) {
+        return nullptr;
+    }
+
     auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
     auto inputIndex = static_cast<int32_t>(index);
 
@@ -584,6 +592,10 @@ jobject getNameRecord(JNIEnv *env, jobject obj, jobject jtypeface, jint index)
 jstring getGlyphName(JNIEnv *env, jobject obj, jobject jtypeface, jint index)
 {
     jlong typefaceHandle = JavaBridge(env).Typeface_getNativeTypeface(jtypeface);
+    if (!typefaceHandle) {
+        return nullptr;
+    }
+
     auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
     FT_Face baseFace = typeface->ftFace();
 
@@ -596,6 +608,10 @@ jstring getGlyphName(JNIEnv *env, jobject obj, jobject jtypeface, jint index)
 jlong getTablePointer(JNIEnv *env, jobject obj, jobject jtypeface, jint table)
 {
     jlong typefaceHandle = JavaBridge(env).Typeface_getNativeTypeface(jtypeface);
+    if (!typefaceHandle) {
+        return 0;
+    }
+
     auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
     FT_Face baseFace = typeface->ftFace();
     auto tableTag = static_cast<FT_Sfnt_Tag>(table);
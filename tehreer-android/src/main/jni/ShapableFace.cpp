@@ -22,7 +22,9 @@ extern "C" {
 #include FT_TRUETYPE_TABLES_H
 }
 
+#include <algorithm>
 #include <mutex>
+#include <vector>
 
 #include "FreeType.h"
 #include "ShapableFace.h"
@@ -32,6 +34,8 @@ using namespace Tehreer;
 
 using FaceLock = lock_guard<RenderableFace>;
 
+static const FT_ULong TTAG_VORG = FT_MAKE_TAG('V', 'O', 'R', 'G');
+
 hb_font_funcs_t *ShapableFace::createFontFuncs()
 {
     hb_font_funcs_t *funcs = hb_font_funcs_create();
@@ -123,25 +127,51 @@ hb_font_funcs_t *ShapableFace::createFontFuncs()
 
         RenderableFace &renderableFace = instance->renderableFace();
         FaceLock lock(renderableFace);
-        FT_Face ftFace = renderableFace.ftFace();
 
-        AdvanceCache &cache = instance->m_advanceCache;
-        auto glyphID = static_cast<uint16_t>(glyph);
-        int32_t glyphAdvance = 0;
+        return instance->unsafeGetAdvance(static_cast<uint16_t>(glyph));
+    }, nullptr, nullptr);
+
+    hb_font_funcs_set_glyph_h_advances_func(funcs, [](hb_font_t *font, void *object,
+                                                      unsigned int count,
+                                                      const hb_codepoint_t *firstGlyph,
+                                                      unsigned glyphStride,
+                                                      hb_position_t *firstAdvance,
+                                                      unsigned advanceStride,
+                                                      void *user_data) -> void
+    {
+        auto instance = reinterpret_cast<ShapableFace *>(object);
 
-        if (cache.get(glyphID, &glyphAdvance)) {
-            return glyphAdvance;
+        RenderableFace &renderableFace = instance->renderableFace();
+        FaceLock lock(renderableFace);
+
+        auto glyphPtr = reinterpret_cast<const uint8_t *>(firstGlyph);
+        auto advancePtr = reinterpret_cast<uint8_t *>(firstAdvance);
+
+        for (unsigned int i = 0; i < count; i++) {
+            auto glyphRef = reinterpret_cast<const hb_codepoint_t *>(glyphPtr);
+            auto advanceRef = reinterpret_cast<hb_position_t *>(advancePtr);
+
+            *advanceRef = instance->unsafeGetAdvance(static_cast<uint16_t>(*glyphRef));
+
+            glyphPtr += glyphStride;
+            advancePtr += advanceStride;
         }
+    }, nullptr, nullptr);
 
-        FT_Fixed ftAdvance = 0;
-        FT_Get_Advance(ftFace, glyphID, FT_LOAD_NO_SCALE, &ftAdvance);
+    hb_font_funcs_set_glyph_v_advance_func(funcs, [](hb_font_t *font, void *object,
+                                                     hb_codepoint_t glyph,
+                                                     void *userData) -> hb_position_t
+    {
+        auto instance = reinterpret_cast<ShapableFace *>(object);
 
-        cache.put(glyphID, ftAdvance);
+        RenderableFace &renderableFace = instance->renderableFace();
+        FaceLock lock(renderableFace);
 
-        return ftAdvance;
+        /* HarfBuzz expects vertical advances to grow downwards. */
+        return -instance->unsafeGetVerticalAdvance(static_cast<uint16_t>(glyph));
     }, nullptr, nullptr);
 
-    hb_font_funcs_set_glyph_h_advances_func(funcs, [](hb_font_t *font, void *object,
+    hb_font_funcs_set_glyph_v_advances_func(funcs, [](hb_font_t *font, void *object,
                                                       unsigned int count,
                                                       const hb_codepoint_t *firstGlyph,
                                                       unsigned glyphStride,
@@ -150,11 +180,9 @@ hb_font_funcs_t *ShapableFace::createFontFuncs()
                                                       void *user_data) -> void
     {
         auto instance = reinterpret_cast<ShapableFace *>(object);
-        AdvanceCache &cache = instance->m_advanceCache;
 
         RenderableFace &renderableFace = instance->renderableFace();
         FaceLock lock(renderableFace);
-        FT_Face ftFace = renderableFace.ftFace();
 
         auto glyphPtr = reinterpret_cast<const uint8_t *>(firstGlyph);
         auto advancePtr = reinterpret_cast<uint8_t *>(firstAdvance);
@@ -163,24 +191,32 @@ hb_font_funcs_t *ShapableFace::createFontFuncs()
             auto glyphRef = reinterpret_cast<const hb_codepoint_t *>(glyphPtr);
             auto advanceRef = reinterpret_cast<hb_position_t *>(advancePtr);
 
-            auto glyphID = static_cast<uint16_t>(*glyphRef);
-            int32_t glyphAdvance = 0;
-
-            if (cache.get(glyphID, &glyphAdvance)) {
-                *advanceRef = glyphAdvance;
-            } else {
-                FT_Fixed ftAdvance = 0;
-                FT_Get_Advance(ftFace, glyphID, FT_LOAD_NO_SCALE, &ftAdvance);
-
-                *advanceRef = ftAdvance;
-                cache.put(glyphID, ftAdvance);
-            }
+            *advanceRef = -instance->unsafeGetVerticalAdvance(static_cast<uint16_t>(*glyphRef));
 
             glyphPtr += glyphStride;
             advancePtr += advanceStride;
         }
     }, nullptr, nullptr);
 
+    hb_font_funcs_set_glyph_v_origin_func(funcs, [](hb_font_t *font, void *object,
+                                                    hb_codepoint_t glyph,
+                                                    hb_position_t *x, hb_position_t *y,
+                                                    void *userData) -> hb_bool_t
+    {
+        auto instance = reinterpret_cast<ShapableFace *>(object);
+
+        RenderableFace &renderableFace = instance->renderableFace();
+        FaceLock lock(renderableFace);
+
+        int32_t originX = 0;
+        int32_t originY = 0;
+        instance->unsafeGetVerticalOrigin(static_cast<uint16_t>(glyph), &originX, &originY);
+
+        *x = originX;
+        *y = originY;
+        return true;
+    }, nullptr, nullptr);
+
     hb_font_funcs_make_immutable(funcs);
 
     return funcs;
@@ -191,6 +227,116 @@ hb_font_funcs_t *ShapableFace::defaultFontFuncs() {
     return defaultFontFuncs;
 }
 
+int32_t ShapableFace::unsafeGetAdvance(uint16_t glyphID)
+{
+    int32_t glyphAdvance = 0;
+
+    if (!m_advanceCache.get(glyphID, &glyphAdvance)) {
+        FT_Fixed ftAdvance = 0;
+        FT_Get_Advance(m_renderableFace.ftFace(), glyphID, FT_LOAD_NO_SCALE, &ftAdvance);
+
+        glyphAdvance = static_cast<int32_t>(ftAdvance);
+        m_advanceCache.put(glyphID, glyphAdvance);
+    }
+
+    return glyphAdvance;
+}
+
+int32_t ShapableFace::unsafeGetVerticalAdvance(uint16_t glyphID)
+{
+    int32_t glyphAdvance = 0;
+
+    if (!m_verticalAdvanceCache.get(glyphID, &glyphAdvance)) {
+        FT_Fixed ftAdvance = 0;
+        FT_Get_Advance(m_renderableFace.ftFace(), glyphID,
+                       FT_LOAD_NO_SCALE | FT_LOAD_VERTICAL_LAYOUT, &ftAdvance);
+
+        glyphAdvance = static_cast<int32_t>(ftAdvance);
+        m_verticalAdvanceCache.put(glyphID, glyphAdvance);
+    }
+
+    return glyphAdvance;
+}
+
+void ShapableFace::unsafeGetVerticalOrigin(uint16_t glyphID, int32_t *x, int32_t *y)
+{
+    int32_t originY = 0;
+
+    if (!m_verticalOriginCache.get(glyphID, &originY)) {
+        originY = unsafeLoadVerticalOriginY(glyphID);
+        m_verticalOriginCache.put(glyphID, originY);
+    }
+
+    /* Glyphs are centered horizontally on the vertical line. */
+    *x = unsafeGetAdvance(glyphID) / 2;
+    *y = originY;
+}
+
+void ShapableFace::unsafeSetupVerticalOrigins()
+{
+    FT_Face ftFace = m_renderableFace.ftFace();
+    FT_ULong length = 0;
+
+    m_hasVerticalOrigins = true;
+
+    if (FT_Load_Sfnt_Table(ftFace, TTAG_VORG, 0, nullptr, &length) != FT_Err_Ok || length < 8) {
+        return;
+    }
+
+    vector<FT_Byte> table(length);
+    FT_Load_Sfnt_Table(ftFace, TTAG_VORG, 0, table.data(), nullptr);
+
+    auto readUInt16 = [&](size_t offset) -> uint16_t {
+        return static_cast<uint16_t>((table[offset] << 8) | table[offset + 1]);
+    };
+
+    size_t count = readUInt16(6);
+    if (8 + count * 4 > length) {
+        return;
+    }
+
+    m_hasOriginTable = true;
+    m_defaultOriginY = static_cast<int16_t>(readUInt16(4));
+    m_originRecords.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        size_t offset = 8 + i * 4;
+        auto glyphID = readUInt16(offset);
+        auto originY = static_cast<int16_t>(readUInt16(offset + 2));
+
+        m_originRecords.emplace_back(glyphID, originY);
+    }
+}
+
+int32_t ShapableFace::unsafeLoadVerticalOriginY(uint16_t glyphID)
+{
+    if (!m_hasVerticalOrigins) {
+        unsafeSetupVerticalOrigins();
+    }
+
+    if (m_hasOriginTable) {
+        /* VORG records are sorted by glyph ID. */
+        auto record = lower_bound(m_originRecords.begin(), m_originRecords.end(), glyphID,
+                                  [](const pair<uint16_t, int16_t> &element, uint16_t value) {
+                                      return element.first < value;
+                                  });
+        if (record != m_originRecords.end() && record->first == glyphID) {
+            return record->second;
+        }
+
+        return m_defaultOriginY;
+    }
+
+    /* Derive the origin from the top side bearing of vmtx, synthesized by FreeType if absent. */
+    FT_Face ftFace = m_renderableFace.ftFace();
+    if (FT_Load_Glyph(ftFace, glyphID, FT_LOAD_NO_SCALE) != FT_Err_Ok) {
+        return static_cast<int32_t>(ftFace->ascender);
+    }
+
+    FT_Glyph_Metrics &metrics = ftFace->glyph->metrics;
+    return static_cast<int32_t>(metrics.horiBearingY + metrics.vertBearingY);
+}
+
 ShapableFace &ShapableFace::create(RenderableFace &renderableFace)
 {
     auto instance = new ShapableFace(renderableFace);
@@ -200,6 +346,9 @@ ShapableFace &ShapableFace::create(RenderableFace &renderableFace)
 ShapableFace::ShapableFace(RenderableFace &renderableFace)
     : m_rootFace(nullptr)
     , m_renderableFace(renderableFace.retain())
+    , m_hasVerticalOrigins(false)
+    , m_hasOriginTable(false)
+    , m_defaultOriginY(0)
     , m_retainCount(1)
 {
     FT_Face ftFace = renderableFace.ftFace();
@@ -245,6 +394,9 @@ ShapableFace::ShapableFace(RenderableFace &renderableFace)
 ShapableFace::ShapableFace(ShapableFace &parent, RenderableFace &renderableFace)
     : m_rootFace(nullptr)
     , m_renderableFace(renderableFace.retain())
+    , m_hasVerticalOrigins(false)
+    , m_hasOriginTable(false)
+    , m_defaultOriginY(0)
     , m_retainCount(1)
 {
     ShapableFace *rootFace = parent.m_rootFace ?: &parent;
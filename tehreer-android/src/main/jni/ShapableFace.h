@@ -18,8 +18,11 @@
 #define _TEHREER__SHAPABLE_FACE_H
 
 #include <atomic>
+#include <cstdint>
 #include <hb.h>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "AdvanceCache.h"
 #include "RenderableFace.h"
@@ -38,6 +41,13 @@ public:
 
     inline hb_font_t *hbFont() const { return m_hbFont; }
 
+    /* Returns the advance of a glyph in font units. The renderable face must be locked. */
+    int32_t unsafeGetAdvance(uint16_t glyphID);
+    /* Returns the vertical advance of a glyph in font units. The renderable face must be locked. */
+    int32_t unsafeGetVerticalAdvance(uint16_t glyphID);
+    /* Returns the vertical origin of a glyph in font units. The renderable face must be locked. */
+    void unsafeGetVerticalOrigin(uint16_t glyphID, int32_t *x, int32_t *y);
+
 private:
     static hb_font_funcs_t *createFontFuncs();
     static hb_font_funcs_t *defaultFontFuncs();
@@ -48,6 +58,13 @@ private:
     hb_font_t *m_hbFont;
 
     AdvanceCache m_advanceCache;
+    AdvanceCache m_verticalAdvanceCache;
+    AdvanceCache m_verticalOriginCache;
+
+    bool m_hasVerticalOrigins;
+    bool m_hasOriginTable;
+    int32_t m_defaultOriginY;
+    std::vector<std::pair<uint16_t, int16_t>> m_originRecords;
 
     std::atomic_int m_retainCount;
 
@@ -55,6 +72,8 @@ private:
     ShapableFace(ShapableFace &parent, RenderableFace &renderableFace);
 
     void setupCoordinates();
+    void unsafeSetupVerticalOrigins();
+    int32_t unsafeLoadVerticalOriginY(uint16_t glyphID);
 
     inline RenderableFace &renderableFace() const { return m_renderableFace; }
 };
@@ -90,10 +90,18 @@ void ShapingEngine::shapeText(ShapingResult &shapingResult, const jchar *charArr
     hb_language_t language = hb_ot_tag_to_language(m_languageTag);
     hb_direction_t direction;
 
-    if (m_writingDirection == WritingDirection::RIGHT_TO_LEFT) {
+    switch (m_writingDirection) {
+    case WritingDirection::RIGHT_TO_LEFT:
         direction = HB_DIRECTION_RTL;
-    } else {
+        break;
+
+    case WritingDirection::TOP_TO_BOTTOM:
+        direction = HB_DIRECTION_TTB;
+        break;
+
+    default:
         direction = HB_DIRECTION_LTR;
+        break;
     }
 
     hb_buffer_t *buffer = shapingResult.hbBuffer();
@@ -128,7 +136,9 @@ void ShapingEngine::shapeText(ShapingResult &shapingResult, const jchar *charArr
     jfloat sizeByEm = m_typeSize / m_typeface->unitsPerEM();
     bool isBackward = m_shapingOrder == ShapingOrder::BACKWARD;
 
-    shapingResult.setup(sizeByEm, isBackward, isRTL(), charStart, charEnd);
+    bool isVertical = m_writingDirection == WritingDirection::TOP_TO_BOTTOM;
+
+    shapingResult.setup(sizeByEm, isBackward, isRTL(), isVertical, charStart, charEnd);
 }
 
 static jint getScriptDefaultDirection(JNIEnv *env, jobject obj, jint scriptTag)
@@ -35,6 +35,7 @@ enum ShapingOrder : uint32_t {
 enum WritingDirection : uint32_t {
     LEFT_TO_RIGHT = 0,
     RIGHT_TO_LEFT = 1,
+    TOP_TO_BOTTOM = 2,
 };
 
 class ShapingEngine {
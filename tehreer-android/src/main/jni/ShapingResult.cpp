@@ -32,6 +32,7 @@ ShapingResult::ShapingResult()
     , m_sizeByEm(0.0)
     , m_isBackward(false)
     , m_isRTL(false)
+    , m_isVertical(false)
     , m_charStart(0)
     , m_charEnd(0)
 {
@@ -42,7 +43,8 @@ ShapingResult::~ShapingResult()
     hb_buffer_destroy(m_hbBuffer);
 }
 
-void ShapingResult::setup(jfloat sizeByEm, bool isBackward, bool isRTL, jint charStart, jint charEnd)
+void ShapingResult::setup(jfloat sizeByEm, bool isBackward, bool isRTL, bool isVertical,
+    jint charStart, jint charEnd)
 {
     m_glyphInfos = hb_buffer_get_glyph_infos(m_hbBuffer, &m_glyphCount);
     m_glyphPositions = hb_buffer_get_glyph_positions(m_hbBuffer, nullptr);
@@ -50,6 +52,7 @@ void ShapingResult::setup(jfloat sizeByEm, bool isBackward, bool isRTL, jint cha
     m_sizeByEm = sizeByEm;
     m_isBackward = isBackward;
     m_isRTL = isRTL;
+    m_isVertical = isVertical;
     m_charStart = charStart;
     m_charEnd = charEnd;
 
@@ -133,11 +136,11 @@ void ShapingResult::copyGlyphAdvances(jint offset, jint length, jfloat *destinat
         jint last = m_glyphCount - offset - 1;
 
         for (int i = 0; i < length; i++) {
-            destination[i] = m_glyphPositions[last - i].x_advance * m_sizeByEm;
+            destination[i] = advanceOf(m_glyphPositions[last - i]) * m_sizeByEm;
         }
     } else {
         for (jint i = 0; i < length; i++) {
-            destination[i] = m_glyphPositions[offset + i].x_advance * m_sizeByEm;
+            destination[i] = advanceOf(m_glyphPositions[offset + i]) * m_sizeByEm;
         }
     }
 }
@@ -166,6 +169,12 @@ static jboolean isRTL(JNIEnv *env, jobject obj, jlong resultHandle)
     return shapingResult->isRTL();
 }
 
+static jboolean isVertical(JNIEnv *env, jobject obj, jlong resultHandle)
+{
+    auto shapingResult = reinterpret_cast<ShapingResult *>(resultHandle);
+    return shapingResult->isVertical();
+}
+
 static jfloat getSizeByEm(JNIEnv *env, jobject obj, jlong resultHandle)
 {
     auto shapingResult = reinterpret_cast<ShapingResult *>(resultHandle);
@@ -281,6 +290,7 @@ static JNINativeMethod JNI_METHODS[] = {
     { "nDispose", "(J)V", (void *)dispose },
     { "nIsBackward", "(J)Z", (void *)isBackward },
     { "nIsRTL", "(J)Z", (void *)isRTL },
+    { "nIsVertical", "(J)Z", (void *)isVertical },
     { "nGetSizeByEm", "(J)F", (void *)getSizeByEm },
     { "nGetCharStart", "(J)I", (void *)getCharStart },
     { "nGetCharEnd", "(J)I", (void *)getCharEnd },
@@ -31,11 +31,12 @@ public:
 
     hb_buffer_t *hbBuffer() const { return m_hbBuffer; }
 
-    void setup(jfloat sizeByEm, bool isBackward, bool isRTL, jint charStart, jint charEnd);
+    void setup(jfloat sizeByEm, bool isBackward, bool isRTL, bool isVertical, jint charStart, jint charEnd);
 
     jfloat sizeByEm() const { return m_sizeByEm; }
     bool isBackward() const { return m_isBackward; }
     bool isRTL() const { return m_isRTL; }
+    bool isVertical() const { return m_isVertical; }
     jint charStart() const { return m_charStart; }
     jint charEnd() const { return m_charEnd; }
     unsigned int glyphCount() const { return m_glyphCount; }
@@ -45,7 +46,7 @@ public:
 
     jfloat glyphXOffsetAt(jint index) const { return m_glyphPositions[at(index)].x_offset * m_sizeByEm; }
     jfloat glyphYOffsetAt(jint index) const { return m_glyphPositions[at(index)].y_offset * m_sizeByEm; }
-    jfloat glyphAdvanceAt(jint index) const { return m_glyphPositions[at(index)].x_advance * m_sizeByEm; }
+    jfloat glyphAdvanceAt(jint index) const { return advanceOf(m_glyphPositions[at(index)]) * m_sizeByEm; }
 
     const jint *clusterMapPtr() const { return m_clusterMap.data(); }
 
@@ -63,6 +64,7 @@ private:
     jfloat m_sizeByEm;
     bool m_isBackward;
     bool m_isRTL;
+    bool m_isVertical;
     jint m_charStart;
     jint m_charEnd;
 
@@ -70,6 +72,11 @@ private:
         return m_isRTL ? m_glyphCount - index - 1 : index;
     }
 
+    /* Vertical advances grow downwards, so they are negated to be measured along the line. */
+    inline hb_position_t advanceOf(const hb_glyph_position_t &position) const {
+        return m_isVertical ? -position.y_advance : position.x_advance;
+    }
+
     std::vector<jint> buildClusterMap() const;
 };
 
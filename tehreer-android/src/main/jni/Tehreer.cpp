@@ -38,6 +38,10 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *jvm, void *reserved) {
           && register_com_mta_tehreer_graphics_GlyphRasterizer(env) == JNI_OK
           && register_com_mta_tehreer_graphics_Typeface(env) == JNI_OK
           && register_com_mta_tehreer_internal_Raw(env) == JNI_OK
+          && register_com_mta_tehreer_internal_layout_FontFallback(env) == JNI_OK
+          && register_com_mta_tehreer_internal_layout_KashidaLocator(env) == JNI_OK
+          && register_com_mta_tehreer_internal_layout_LineBreaker(env) == JNI_OK
+          && register_com_mta_tehreer_internal_sfnt_BufferTable(env) == JNI_OK
           && register_com_mta_tehreer_sfnt_tables_SfntTables(env) == JNI_OK
           && register_com_mta_tehreer_sfnt_ShapingEngine(env) == JNI_OK
           && register_com_mta_tehreer_sfnt_ShapingResult(env) == JNI_OK
@@ -46,6 +50,7 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *jvm, void *reserved) {
           && register_com_mta_tehreer_unicode_BidiLine(env) == JNI_OK
           && register_com_mta_tehreer_unicode_BidiMirrorLocator(env) == JNI_OK
           && register_com_mta_tehreer_unicode_BidiParagraph(env) == JNI_OK
+          && register_com_mta_tehreer_unicode_BreakClassifier(env) == JNI_OK
           && register_com_mta_tehreer_unicode_ScriptClassifier(env) == JNI_OK
           && register_com_mta_tehreer_unicode_Unicode(env) == JNI_OK;
 
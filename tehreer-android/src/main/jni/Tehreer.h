@@ -22,10 +22,15 @@
 #include "BidiLine.h"
 #include "BidiMirrorLocator.h"
 #include "BidiParagraph.h"
+#include "BreakClassifier.h"
+#include "BufferTable.h"
+#include "FontFallback.h"
 #include "FontFile.h"
 #include "FreeType.h"
 #include "GlyphOutline.h"
 #include "GlyphRasterizer.h"
+#include "KashidaLocator.h"
+#include "LineBreaker.h"
 #include "Miscellaneous.h"
 #include "Raw.h"
 #include "ScriptClassifier.h"
@@ -29,11 +29,14 @@ extern "C" {
 
 #include <android/asset_manager.h>
 #include <android/asset_manager_jni.h>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <jni.h>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "Convert.h"
 #include "FontFile.h"
@@ -144,38 +147,49 @@ Typeface *Typeface::createFromFile(FontFile *fontFile, FT_Long faceIndex)
 Typeface::Typeface(RenderableFace &renderableFace)
     : m_renderableFace(renderableFace.retain())
     , m_ftSize(nullptr)
+    , m_charSize(0)
     , m_ftStroker(nullptr)
     , m_shapableFace(nullptr)
+    , m_coverage(nullptr)
+    , m_glyphTypes(nullptr)
     , m_defaults(DefaultProperties())
+    , m_namesReady(false)
     , m_strikeoutPosition(0)
     , m_strikeoutThickness(0)
     , m_palette({})
 {
     setupSize();
-    setupHarfBuzz();
     setupDefaultDescription();
 }
 
 Typeface::Typeface(const Typeface &parent, RenderableFace &renderableFace)
     : m_renderableFace(renderableFace.retain())
     , m_ftSize(nullptr)
+    , m_charSize(0)
     , m_ftStroker(nullptr)
     , m_shapableFace(nullptr)
-    , m_defaults(parent.m_defaults)
+    , m_coverage(nullptr)
+    , m_glyphTypes(nullptr)
+    , m_defaults(parent.copyDefaults())
+    , m_namesReady(false)
     , m_strikeoutPosition(0)
     , m_strikeoutThickness(0)
     , m_palette(parent.m_palette)
 {
     setupSize();
-    setupHarfBuzz(parent.m_shapableFace);
+    setupHarfBuzz(&parent.shapableFace());
 }
 
 Typeface::Typeface(const Typeface &parent, const FT_Color *colorArray, size_t colorCount)
     : m_renderableFace(parent.renderableFace().retain())
     , m_ftSize(nullptr)
+    , m_charSize(0)
     , m_ftStroker(nullptr)
-    , m_shapableFace(&parent.m_shapableFace->retain())
-    , m_defaults(parent.m_defaults)
+    , m_shapableFace(&parent.shapableFace().retain())
+    , m_coverage(nullptr)
+    , m_glyphTypes(nullptr)
+    , m_defaults(parent.copyDefaults())
+    , m_namesReady(false)
     , m_strikeoutPosition(parent.m_strikeoutPosition)
     , m_strikeoutThickness(parent.m_strikeoutThickness)
     , m_palette({})
@@ -194,6 +208,18 @@ void Typeface::setupSize()
     FT_New_Size(m_renderableFace.ftFace(), &m_ftSize);
 }
 
+void Typeface::unsafeActivateSize(float typeSize)
+{
+    FT_Activate_Size(m_ftSize);
+
+    /* The scaling of a size object is retained, so set it only if the size has changed. */
+    FT_F26Dot6 charSize = toF26Dot6(typeSize);
+    if (charSize != m_charSize) {
+        FT_Set_Char_Size(m_renderableFace.ftFace(), 0, charSize, 0, 0);
+        m_charSize = charSize;
+    }
+}
+
 void Typeface::setupDefaultDescription()
 {
     FT_Face ftFace = m_renderableFace.ftFace();
@@ -201,9 +227,6 @@ void Typeface::setupDefaultDescription()
     auto headTable = static_cast<TT_Header *>(FT_Get_Sfnt_Table(ftFace, FT_SFNT_HEAD));
 
     Description description;
-    description.familyName = searchFamilyName(ftFace, os2Table);
-    description.styleName = searchStyleName(ftFace, os2Table);
-    description.fullName = searchFullName(ftFace);
 
     if (os2Table) {
         description.weight = os2Table->usWeightClass;
@@ -233,6 +256,29 @@ void Typeface::setupDefaultDescription()
     m_defaults.description = description;
 }
 
+void Typeface::setupDefaultNames() const
+{
+    if (m_namesReady.load(memory_order_acquire)) {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+
+    if (!m_defaults.hasNames) {
+        FaceLock faceLock(m_renderableFace);
+
+        FT_Face ftFace = m_renderableFace.ftFace();
+        auto os2Table = static_cast<TT_OS2 *>(FT_Get_Sfnt_Table(ftFace, FT_SFNT_OS2));
+
+        m_defaults.description.familyName = searchFamilyName(ftFace, os2Table);
+        m_defaults.description.styleName = searchStyleName(ftFace, os2Table);
+        m_defaults.description.fullName = searchFullName(ftFace);
+        m_defaults.hasNames = true;
+    }
+
+    m_namesReady.store(true, memory_order_release);
+}
+
 void Typeface::setupStrikeout()
 {
     FT_Face ftFace = m_renderableFace.ftFace();
@@ -247,9 +293,9 @@ void Typeface::setupStrikeout()
 void Typeface::setupHarfBuzz(ShapableFace *parent)
 {
     if (parent) {
-        m_shapableFace = &parent->deriveVariation(m_renderableFace);
+        m_shapableFace.store(&parent->deriveVariation(m_renderableFace), memory_order_release);
     } else {
-        m_shapableFace = &ShapableFace::create(m_renderableFace);
+        m_shapableFace.store(&ShapableFace::create(m_renderableFace), memory_order_release);
     }
 }
 
@@ -260,7 +306,16 @@ void Typeface::setupColors(const FT_Color *colorArray, size_t colorCount)
 
 Typeface::~Typeface()
 {
-    m_shapableFace->release();
+    ShapableFace *shapableFace = m_shapableFace.load(memory_order_acquire);
+    if (shapableFace) {
+        shapableFace->release();
+    }
+    delete m_coverage.load(memory_order_acquire);
+    delete m_glyphTypes.load(memory_order_acquire);
+
+    for (auto &entry : m_paintGraphs) {
+        delete entry.second;
+    }
 
     if (m_ftStroker) {
         FT_Stroker_Done(m_ftStroker);
@@ -273,6 +328,83 @@ Typeface::~Typeface()
     m_renderableFace.release();
 }
 
+ShapableFace &Typeface::shapableFace() const
+{
+    ShapableFace *shapableFace = m_shapableFace.load(memory_order_acquire);
+
+    if (!shapableFace) {
+        lock_guard<mutex> lock(m_mutex);
+
+        shapableFace = m_shapableFace.load(memory_order_relaxed);
+        if (!shapableFace) {
+            shapableFace = &ShapableFace::create(m_renderableFace);
+            m_shapableFace.store(shapableFace, memory_order_release);
+        }
+    }
+
+    return *shapableFace;
+}
+
+const CoverageSet &Typeface::coverage() const
+{
+    CoverageSet *coverage = m_coverage.load(memory_order_acquire);
+
+    if (!coverage) {
+        lock_guard<mutex> lock(m_mutex);
+
+        coverage = m_coverage.load(memory_order_relaxed);
+        if (!coverage) {
+            FaceLock faceLock(m_renderableFace);
+            coverage = new CoverageSet(m_renderableFace.ftFace());
+            m_coverage.store(coverage, memory_order_release);
+        }
+    }
+
+    return *coverage;
+}
+
+const GlyphTypeTable &Typeface::glyphTypes() const
+{
+    GlyphTypeTable *glyphTypes = m_glyphTypes.load(memory_order_acquire);
+
+    if (!glyphTypes) {
+        lock_guard<mutex> lock(m_mutex);
+
+        glyphTypes = m_glyphTypes.load(memory_order_relaxed);
+        if (!glyphTypes) {
+            FaceLock faceLock(m_renderableFace);
+            glyphTypes = new GlyphTypeTable(m_renderableFace.ftFace());
+            m_glyphTypes.store(glyphTypes, memory_order_release);
+        }
+    }
+
+    return *glyphTypes;
+}
+
+Typeface::DefaultProperties Typeface::copyDefaults() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_defaults;
+}
+
+int32_t Typeface::defaultFamilyNameIndex() const
+{
+    setupDefaultNames();
+    return m_defaults.description.familyName;
+}
+
+int32_t Typeface::defaultStyleNameIndex() const
+{
+    setupDefaultNames();
+    return m_defaults.description.styleName;
+}
+
+int32_t Typeface::defaultFullNameIndex() const
+{
+    setupDefaultNames();
+    return m_defaults.description.fullName;
+}
+
 Typeface *Typeface::deriveVariation(const float *coordArray, size_t coordCount)
 {
     RenderableFace *renderableFace = m_renderableFace.deriveVariation(coordArray, coordCount);
@@ -338,6 +470,27 @@ void Typeface::getTableData(uint32_t tag, void *buffer)
     FT_Load_Sfnt_Table(ftFace, tag, 0, ftBuffer, nullptr);
 }
 
+const FT_Byte *Typeface::getTableBuffer(uint32_t tag, size_t &length)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    auto entry = m_tables.find(tag);
+    if (entry == m_tables.end()) {
+        /* Remember the missing tables as well so that they are not looked up again. */
+        vector<FT_Byte> data(getTableLength(tag));
+        if (!data.empty()) {
+            getTableData(tag, data.data());
+        }
+
+        entry = m_tables.emplace(tag, move(data)).first;
+    }
+
+    const auto &data = entry->second;
+    length = data.size();
+
+    return data.empty() ? nullptr : data.data();
+}
+
 int32_t Typeface::searchNameIndex(uint16_t nameID)
 {
     FaceLock lock(m_renderableFace);
@@ -396,8 +549,7 @@ float Typeface::getGlyphAdvance(uint16_t glyphID, float typeSize, bool vertical)
     FaceLock lock(m_renderableFace);
     FT_Face ftFace = m_renderableFace.ftFace();
 
-    FT_Activate_Size(ftSize());
-    FT_Set_Char_Size(ftFace, 0, toF26Dot6(typeSize), 0, 0);
+    unsafeActivateSize(typeSize);
     FT_Set_Transform(ftFace, nullptr, nullptr);
 
     FT_Fixed advance;
@@ -406,6 +558,33 @@ float Typeface::getGlyphAdvance(uint16_t glyphID, float typeSize, bool vertical)
     return f16Dot16toFloat(advance);
 }
 
+void Typeface::getGlyphAdvances(const jint *glyphIDs, size_t glyphCount, float typeSize, bool vertical, jfloat *advances)
+{
+    float scale = typeSize / unitsPerEM();
+
+    if (!vertical) {
+        /* Get the shapable face before locking as its creation takes the typeface mutex. */
+        ShapableFace &shapable = shapableFace();
+        FaceLock lock(m_renderableFace);
+
+        for (size_t i = 0; i < glyphCount; i++) {
+            auto glyphID = static_cast<uint16_t>(glyphIDs[i]);
+            advances[i] = shapable.unsafeGetAdvance(glyphID) * scale;
+        }
+    } else {
+        FaceLock lock(m_renderableFace);
+        FT_Face ftFace = m_renderableFace.ftFace();
+
+        for (size_t i = 0; i < glyphCount; i++) {
+            auto glyphID = static_cast<FT_UInt>(glyphIDs[i]);
+            FT_Fixed advance = 0;
+            FT_Get_Advance(ftFace, glyphID, FT_LOAD_NO_SCALE | FT_LOAD_VERTICAL_LAYOUT, &advance);
+
+            advances[i] = advance * scale;
+        }
+    }
+}
+
 jobject Typeface::unsafeGetGlyphPath(JavaBridge bridge, uint16_t glyphID)
 {
     jobject glyphPath = nullptr;
@@ -464,6 +643,20 @@ jobject Typeface::unsafeGetGlyphPath(JavaBridge bridge, uint16_t glyphID)
     return glyphPath;
 }
 
+const PaintGraph *Typeface::unsafeGetPaintGraph(FT_UInt glyphID)
+{
+    auto entry = m_paintGraphs.find(glyphID);
+    if (entry != m_paintGraphs.end()) {
+        return entry->second;
+    }
+
+    /* Glyphs without a paint graph are remembered as well to avoid searching them again. */
+    PaintGraph *paintGraph = PaintGraph::decode(ftFace(), glyphID);
+    m_paintGraphs[glyphID] = paintGraph;
+
+    return paintGraph;
+}
+
 jobject Typeface::getGlyphPath(JavaBridge bridge, uint16_t glyphID, float typeSize, float *transform)
 {
     FT_Matrix matrix;
@@ -491,8 +684,7 @@ jobject Typeface::getGlyphPath(JavaBridge bridge, uint16_t glyphID, float typeSi
     FaceLock lock(m_renderableFace);
     FT_Face ftFace = m_renderableFace.ftFace();
 
-    FT_Activate_Size(ftSize());
-    FT_Set_Char_Size(ftFace, 0, toF26Dot6(typeSize), 0, 0);
+    unsafeActivateSize(typeSize);
     FT_Set_Transform(ftFace, &matrix, &delta);
 
     return unsafeGetGlyphPath(bridge, glyphID);
@@ -730,44 +922,26 @@ static jbyteArray getTableData(JNIEnv *env, jobject obj, jlong typefaceHandle, j
     return dataArray;
 }
 
-static jint getUnitsPerEm(JNIEnv *env, jobject obj, jlong typefaceHandle)
+static void getMetrics(JNIEnv *env, jobject obj, jlong typefaceHandle, jintArray metrics)
 {
     auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    uint16_t unitsPerEM = typeface->unitsPerEM();
-
-    return static_cast<jint>(unitsPerEM);
-}
-
-static jint getAscent(JNIEnv *env, jobject obj, jlong typefaceHandle)
-{
-    auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    int16_t ascent = typeface->ascent();
-
-    return static_cast<jint>(ascent);
-}
-
-static jint getDescent(JNIEnv *env, jobject obj, jlong typefaceHandle)
-{
-    auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    int16_t descent = typeface->descent();
-
-    return static_cast<jint>(descent);
-}
-
-static jint getLeading(JNIEnv *env, jobject obj, jlong typefaceHandle)
-{
-    auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    int16_t leading = typeface->leading();
-
-    return static_cast<jint>(leading);
-}
+    FT_BBox bbox = typeface->ftFace()->bbox;
 
-static jint getGlyphCount(JNIEnv *env, jobject obj, jlong typefaceHandle)
-{
-    auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    int32_t glyphCount = typeface->glyphCount();
+    jint values[] = {
+        static_cast<jint>(typeface->unitsPerEM()),
+        static_cast<jint>(typeface->ascent()),
+        static_cast<jint>(typeface->descent()),
+        static_cast<jint>(typeface->leading()),
+        static_cast<jint>(typeface->glyphCount()),
+        static_cast<jint>(bbox.xMin), static_cast<jint>(bbox.yMin),
+        static_cast<jint>(bbox.xMax), static_cast<jint>(bbox.yMax),
+        static_cast<jint>(typeface->underlinePosition()),
+        static_cast<jint>(typeface->underlineThickness()),
+        static_cast<jint>(typeface->strikeoutPosition()),
+        static_cast<jint>(typeface->strikeoutThickness()),
+    };
 
-    return static_cast<jint>(glyphCount);
+    env->SetIntArrayRegion(metrics, 0, sizeof(values) / sizeof(values[0]), values);
 }
 
 static jint getGlyphId(JNIEnv *env, jobject obj, jlong typefaceHandle, jint codePoint)
@@ -788,60 +962,32 @@ static jfloat getGlyphAdvance(JNIEnv *env, jobject obj, jlong typefaceHandle,
     return typeface->getGlyphAdvance(glyphIndex, typeSize, vertical);
 }
 
-static jobject getGlyphPath(JNIEnv *env, jobject obj, jlong typefaceHandle, jint glyphId, jfloat typeSize, jfloatArray matrixArray)
+static void getGlyphAdvances(JNIEnv *env, jobject obj, jlong typefaceHandle,
+    jintArray glyphIds, jfloat typeSize, jboolean vertical, jfloatArray advances)
 {
     auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    auto glyphIndex = static_cast<uint16_t>(glyphId);
+    jsize glyphCount = env->GetArrayLength(glyphIds);
 
-    jfloat *transform = env->GetFloatArrayElements(matrixArray, nullptr);
-    jobject glyphPath = typeface->getGlyphPath(JavaBridge(env), glyphIndex, typeSize, transform);
-
-    env->ReleaseFloatArrayElements(matrixArray, transform, 0);
+    /* Copy the arrays as the face lock might be waited upon. */
+    vector<jint> glyphArray(glyphCount);
+    vector<jfloat> advanceArray(glyphCount);
 
-    return glyphPath;
+    env->GetIntArrayRegion(glyphIds, 0, glyphCount, glyphArray.data());
+    typeface->getGlyphAdvances(glyphArray.data(), glyphArray.size(), typeSize, vertical, advanceArray.data());
+    env->SetFloatArrayRegion(advances, 0, glyphCount, advanceArray.data());
 }
 
-static void getBoundingBox(JNIEnv *env, jobject obj, jlong typefaceHandle, jobject rect)
-{
-    auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    FT_Face baseFace = typeface->ftFace();
-    FT_BBox bbox = baseFace->bbox;
-
-    JavaBridge(env).Rect_set(rect,
-                             static_cast<jint>(bbox.xMin), static_cast<jint>(bbox.yMin),
-                             static_cast<jint>(bbox.xMax), static_cast<jint>(bbox.yMax));
-}
-
-static jint getUnderlinePosition(JNIEnv *env, jobject obj, jlong typefaceHandle)
-{
-    auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    int16_t underlinePosition = typeface->underlinePosition();
-
-    return static_cast<jint>(underlinePosition);
-}
-
-static jint getUnderlineThickness(JNIEnv *env, jobject obj, jlong typefaceHandle)
-{
-    auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    int16_t underlineThickness = typeface->underlineThickness();
-
-    return static_cast<jint>(underlineThickness);
-}
-
-static jint getStrikeoutPosition(JNIEnv *env, jobject obj, jlong typefaceHandle)
+static jobject getGlyphPath(JNIEnv *env, jobject obj, jlong typefaceHandle, jint glyphId, jfloat typeSize, jfloatArray matrixArray)
 {
     auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    int16_t strikeoutPosition = typeface->strikeoutPosition();
+    auto glyphIndex = static_cast<uint16_t>(glyphId);
 
-    return static_cast<jint>(strikeoutPosition);
-}
+    jfloat *transform = env->GetFloatArrayElements(matrixArray, nullptr);
+    jobject glyphPath = typeface->getGlyphPath(JavaBridge(env), glyphIndex, typeSize, transform);
 
-static jint getStrikeoutThickness(JNIEnv *env, jobject obj, jlong typefaceHandle)
-{
-    auto typeface = reinterpret_cast<Typeface *>(typefaceHandle);
-    int16_t strikeoutThickness = typeface->strikeoutThickness();
+    env->ReleaseFloatArrayElements(matrixArray, transform, 0);
 
-    return static_cast<jint>(strikeoutThickness);
+    return glyphPath;
 }
 
 static JNINativeMethod JNI_METHODS[] = {
@@ -864,19 +1010,11 @@ static JNINativeMethod JNI_METHODS[] = {
     { "nGetColorInstance", "(J[I)J", (void *)getColorInstance },
     { "nGetAssociatedColors", "(J[I)V", (void *)getAssociatedColors },
     { "nGetTableData", "(JI)[B", (void *)getTableData },
-    { "nGetUnitsPerEm", "(J)I", (void *)getUnitsPerEm },
-    { "nGetAscent", "(J)I", (void *)getAscent },
-    { "nGetDescent", "(J)I", (void *)getDescent },
-    { "nGetLeading", "(J)I", (void *)getLeading },
-    { "nGetGlyphCount", "(J)I", (void *)getGlyphCount },
+    { "nGetMetrics", "(J[I)V", (void *)getMetrics },
     { "nGetGlyphId", "(JI)I", (void *)getGlyphId },
     { "nGetGlyphAdvance", "(JIFZ)F", (void *)getGlyphAdvance },
+    { "nGetGlyphAdvances", "(J[IFZ[F)V", (void *)getGlyphAdvances },
     { "nGetGlyphPath", "(JIF[F)Landroid/graphics/Path;", (void *)getGlyphPath },
-    { "nGetBoundingBox", "(JLandroid/graphics/Rect;)V", (void *)getBoundingBox },
-    { "nGetUnderlinePosition", "(J)I", (void *)getUnderlinePosition },
-    { "nGetUnderlineThickness", "(J)I", (void *)getUnderlineThickness },
-    { "nGetStrikeoutPosition", "(J)I", (void *)getStrikeoutPosition },
-    { "nGetStrikeoutThickness", "(J)I", (void *)getStrikeoutThickness },
 };
 
 jint register_com_mta_tehreer_graphics_Typeface(JNIEnv *env)
@@ -24,15 +24,20 @@ extern "C" {
 #include FT_STROKER_H
 }
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <hb.h>
 #include <jni.h>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
+#include "CoverageSet.h"
 #include "FontFile.h"
+#include "GlyphTypeTable.h"
 #include "JavaBridge.h"
+#include "PaintGraph.h"
 #include "RenderableFace.h"
 #include "SfntTables.h"
 #include "ShapableFace.h"
@@ -68,15 +73,17 @@ public:
     inline FT_Size ftSize() const { return m_ftSize; }
     FT_Stroker ftStroker();
 
-    inline ShapableFace &shapableFace() const { return *m_shapableFace; }
+    ShapableFace &shapableFace() const;
+    const CoverageSet &coverage() const;
+    const GlyphTypeTable &glyphTypes() const;
     inline hb_font_t *hbFont() const { return shapableFace().hbFont(); }
 
     inline const CoordArray *coordinates() const { return m_renderableFace.coordinates(); }
     inline const Palette *palette() const { return m_palette.size() == 0 ? nullptr : &m_palette; }
 
-    inline int32_t defaultFamilyNameIndex() const { return m_defaults.description.familyName; }
-    inline int32_t defaultStyleNameIndex() const { return m_defaults.description.styleName; }
-    inline int32_t defaultFullNameIndex() const { return m_defaults.description.fullName; }
+    int32_t defaultFamilyNameIndex() const;
+    int32_t defaultStyleNameIndex() const;
+    int32_t defaultFullNameIndex() const;
 
     inline uint16_t defaultWeight() const { return m_defaults.description.weight; }
     inline uint16_t defaultWidth() const { return m_defaults.description.width; }
@@ -97,6 +104,7 @@ public:
 
     size_t getTableLength(uint32_t tag);
     void getTableData(uint32_t tag, void *buffer);
+    const FT_Byte *getTableBuffer(uint32_t tag, size_t &length);
 
     int32_t searchNameIndex(uint16_t nameID);
     jobject getNameRecord(const JavaBridge &javaBridge, int32_t nameIndex);
@@ -104,8 +112,11 @@ public:
 
     uint16_t getGlyphID(uint32_t codePoint);
     float getGlyphAdvance(uint16_t glyphID, float typeSize, bool vertical);
+    void getGlyphAdvances(const jint *glyphIDs, size_t glyphCount, float typeSize, bool vertical, jfloat *advances);
 
     jobject unsafeGetGlyphPath(JavaBridge bridge, uint16_t glyphID);
+    /* Returns the decoded COLRv1 paint graph of a glyph, if any. The face must be locked. */
+    const PaintGraph *unsafeGetPaintGraph(FT_UInt glyphID);
     jobject getGlyphPath(JavaBridge bridge, uint16_t glyphID, float typeSize, float *transform);
 
 private:
@@ -131,29 +142,52 @@ private:
 
     struct DefaultProperties {
         Description description;
+        bool hasNames;
+
+        DefaultProperties() {
+            hasNames = false;
+        }
     };
 
-    std::mutex m_mutex;
+    mutable std::mutex m_mutex;
 
     RenderableFace &m_renderableFace;
     FT_Size m_ftSize;
+    FT_F26Dot6 m_charSize;
     FT_Stroker m_ftStroker;
 
-    ShapableFace *m_shapableFace;
+    /*
+     * Created on first use as most of the typefaces are never shaped. The pointers are published
+     * with release stores so that the lock-free readers see fully constructed objects.
+     */
+    mutable std::atomic<ShapableFace *> m_shapableFace;
+    mutable std::atomic<CoverageSet *> m_coverage;
+    mutable std::atomic<GlyphTypeTable *> m_glyphTypes;
 
-    DefaultProperties m_defaults;
+    mutable DefaultProperties m_defaults;
+    /* Set with a release store once the default names have been searched. */
+    mutable std::atomic<bool> m_namesReady;
 
     int16_t m_strikeoutPosition;
     int16_t m_strikeoutThickness;
 
     Palette m_palette;
 
+    /* Decoded paint graphs of COLRv1 glyphs, guarded by the face lock. */
+    std::unordered_map<FT_UInt, PaintGraph *> m_paintGraphs;
+
+    /* Loaded tables which stay in place for the whole life of the typeface. */
+    std::unordered_map<uint32_t, std::vector<FT_Byte>> m_tables;
+
     Typeface(RenderableFace &renderableFace);
     Typeface(const Typeface &parent, RenderableFace &renderableFace);
     Typeface(const Typeface &parent, const FT_Color *colorArray, size_t colorCount);
 
     void setupSize();
+    void unsafeActivateSize(float typeSize);
     void setupDefaultDescription();
+    void setupDefaultNames() const;
+    DefaultProperties copyDefaults() const;
     void setupHarfBuzz(ShapableFace *parent = nullptr);
 };
 